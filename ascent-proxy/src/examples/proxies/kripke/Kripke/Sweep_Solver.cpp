@@ -79,14 +79,19 @@ void writeAscentData(Ascent &ascent, Grid_Data *grid_data, int timeStep)
     data["fields/phi/topology"] = "mesh";
     data["fields/phi/type"] = "scalar";
 
-    data["fields/phi/values"].set(conduit::DataType::float64(sdom.num_zones));
-    conduit::float64 * phi_scalars = data["fields/phi/values"].value();
-
-    // TODO can we do this with strides and not copy?
-    for(int i = 0; i < sdom.num_zones; i++)
+    // phi(0,0,z) is every zone_stride-th value of phi, so publish
+    // it as a strided view instead of copying it out
+    conduit::float64 *phi0 = sdom.phi->ptr(0,0,0);
+    conduit::index_t zone_stride = 1;
+    if(sdom.num_zones > 1)
     {
-      phi_scalars[i] = (*sdom.phi)(0,0,i);
+      zone_stride = sdom.phi->ptr(0,0,1) - phi0;
     }
+    data["fields/phi/values"].set_external(
+        conduit::DataType::float64(sdom.num_zones,
+                                   0,
+                                   zone_stride * sizeof(conduit::float64)),
+        phi0);
 
   }//each sdom
 
@@ -0,0 +1,46 @@
+import numpy as np
+
+# Same model as auto_mem.py, but the window, target, and weights live
+# in the extract's state store instead of pickles or shared memory.
+# Arrays fetched from the state are views, so updates persist in place.
+state = ascent_state()
+if not state.has_path("w"):
+    state["X"] = np.array([1.0, 0.0, 0.0, 0.0, 0.0])
+    state["y"] = np.zeros(1)
+    state["w"] = np.full(5, 0.05)
+
+X = state["X"]
+y = state["y"]
+w = state["w"]
+
+def update():
+    mesh = ascent_data().child(0)
+    e_vals = mesh["fields/velocity/values/u"]
+    n_iter = mesh["state/cycle"]
+    e_max = e_vals.max()
+
+    if n_iter < 5:
+        X[n_iter] = e_max
+    elif n_iter == 5:
+        y[0] = e_max
+    else:
+        X[0] = 1.0
+        X[1:-1] = X[2:]
+        X[-1] = y[0]
+        y[0] = e_max
+
+        if n_iter < 400:
+            # update w with SGD
+            lr = 0.0000001
+            epochs = 100
+
+            for epoch in range(epochs):
+                pred = np.dot(w, X)
+                loss_grad = pred - y[0]
+                w[:] = w[:] - lr * X * loss_grad
+
+            if n_iter % 100 == 0:
+                loss = (y[0] - np.dot(w, X))**2
+                print(f"Iteration: {n_iter}, loss: {loss}")
+
+update()
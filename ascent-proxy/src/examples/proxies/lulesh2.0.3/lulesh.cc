@@ -2793,7 +2793,10 @@ int main(int argc, char *argv[])
 #if USE_MPI
    Domain_member fieldData ;
 
-   MPI_Init(&argc, &argv) ;
+   // full thread support lets Ascent's async mode overlap
+   // the in situ pipeline with the next timesteps
+   int threadSupport ;
+   MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &threadSupport) ;
    MPI_Comm_size(MPI_COMM_WORLD, &numRanks) ;
    MPI_Comm_rank(MPI_COMM_WORLD, &myRank) ;
 #else
@@ -2921,6 +2924,8 @@ int main(int argc, char *argv[])
          ascent.execute(actions);
       }
    }
+   // finish any asynchronous executes before stopping the clock
+   ascent.wait();
    ascent.close();
 
    /*--------------------------------------------------------------------------
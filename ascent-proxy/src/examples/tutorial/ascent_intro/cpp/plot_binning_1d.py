@@ -7,9 +7,22 @@
 # ascent binning example 1
 #
 
+import os
+import subprocess
 import yaml #pip install --user pyyaml
 import matplotlib.pyplot as plt
 
+# ascent saves the session as a binary log, convert it to yaml with the
+# session2yaml utility (installed in utilities/ascent, set SESSION2YAML
+# to its path if it is not on your PATH)
+session_log = 'ascent_session.session_log'
+if os.path.isfile(session_log) and \
+   (not os.path.isfile('ascent_session.yaml') or
+    os.path.getmtime('ascent_session.yaml') < os.path.getmtime(session_log)):
+  subprocess.check_call([os.environ.get('SESSION2YAML', 'session2yaml'),
+                         '--session=ascent_session',
+                         '--output=ascent_session.yaml'])
+
 session = []
 with open(r'ascent_session.yaml') as file:
   session = yaml.load(file)
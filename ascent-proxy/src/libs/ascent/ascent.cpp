@@ -799,6 +799,48 @@ Ascent::execute(const conduit::Node &actions)
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+Ascent::wait()
+{
+    try
+    {
+        if(m_runtime != NULL)
+        {
+            m_runtime->Wait();
+            set_status("Ascent::wait completed");
+        }
+        else
+        {
+            ASCENT_ERROR("Ascent Runtime is not initialized");
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        set_status("Ascent::wait failed",
+                   e.message());
+
+        if(m_forward_exceptions)
+        {
+            throw e;
+        }
+        else
+        {
+          if(m_runtime != NULL)
+          {
+            std::stringstream msg;
+            msg << "[Error] Ascent::wait "
+                << e.message() << std::endl;
+            m_runtime->DisplayError(msg.str());
+          }
+          else
+          {
+            std::cerr<< "[Error] Ascent::wait "
+                     << e.message() << std::endl;
+          }
+        }
+    }
+}
 
 //-----------------------------------------------------------------------------
 void
@@ -49,6 +49,8 @@ public:
     void             open(const conduit::Node &options);
     void             publish(const conduit::Node &data);
     void             execute(const conduit::Node &actions);
+    // waits for pending asynchronous executes (see the async option)
+    void             wait();
     void             info(conduit::Node &info_out);
     conduit::Node   &info();
     void             close();
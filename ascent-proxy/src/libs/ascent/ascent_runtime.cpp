@@ -31,6 +31,14 @@ Runtime::~Runtime()
 
 }
 
+//-----------------------------------------------------------------------------
+void
+Runtime::Wait()
+{
+
+}
+
+//-----------------------------------------------------------------------------
 void Runtime::DisplayError(const std::string &msg)
 {
   std::cerr<<msg;
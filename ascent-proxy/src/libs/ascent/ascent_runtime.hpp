@@ -34,6 +34,9 @@ public:
 
     virtual void           Publish(const conduit::Node &data)=0;
     virtual void           Execute(const conduit::Node &actions)=0;
+    // blocks until all pending executes have finished
+    // (runtimes that execute synchronously have nothing to wait for)
+    virtual void           Wait();
 
     virtual void           Info(conduit::Node &info_out)=0;
 
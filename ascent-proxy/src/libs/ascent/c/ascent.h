@@ -51,6 +51,8 @@ void ASCENT_API ascent_publish(Ascent *c_ascent, conduit_node *data);
 
 void ASCENT_API ascent_execute(Ascent *c_ascent, conduit_node *actions);
 
+void ASCENT_API ascent_wait(Ascent *c_ascent);
+
 void ASCENT_API ascent_info(Ascent *c_ascent, conduit_node *result);
 
 conduit_node ASCENT_API *ascent_info_ref(Ascent *c_ascent);
@@ -61,6 +63,14 @@ void ASCENT_API ascent_timer_start(char *name);
 
 void ASCENT_API ascent_timer_stop(char *name);
 
+// registers a timer name once, the id based calls skip the
+// name lookup when starting and stopping
+int  ASCENT_API ascent_timer_id(char *name);
+
+void ASCENT_API ascent_timer_start_id(int timer_id);
+
+void ASCENT_API ascent_timer_stop_id(int timer_id);
+
 void ASCENT_API ascent_timer_write();
 
 
@@ -86,6 +86,14 @@ ascent_execute(Ascent *c_ascent,
     v->execute(n);
 }
 
+//---------------------------------------------------------------------------//
+void
+ascent_wait(Ascent *c_ascent)
+{
+    ascent::Ascent *v = cpp_ascent(c_ascent);
+    v->wait();
+}
+
 //---------------------------------------------------------------------------//
 void
 ascent_info(Ascent *c_ascent,
@@ -134,6 +142,27 @@ ascent_timer_stop(char *name)
     ascent::BlockTimer::StopTimer(name);
 }
 
+//---------------------------------------------------------------------------//
+int
+ascent_timer_id(char *name)
+{
+    return ascent::BlockTimer::Register(name);
+}
+
+//---------------------------------------------------------------------------//
+void
+ascent_timer_start_id(int timer_id)
+{
+    ascent::BlockTimer::StartTimer(timer_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+ascent_timer_stop_id(int timer_id)
+{
+    ascent::BlockTimer::StopTimer(timer_id);
+}
+
 //---------------------------------------------------------------------------//
 void
 ascent_timer_write()
@@ -71,6 +71,14 @@ module ascent
         type(C_PTR), value, intent(IN) ::cnode
     end subroutine ascent_execute
 
+    !--------------------------------------------------------------------------
+    subroutine ascent_wait(cascent) &
+            bind(C, name="ascent_wait")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) ::cascent
+    end subroutine ascent_wait
+
     !--------------------------------------------------------------------------
     subroutine ascent_info(cascent, cnode) &
             bind(C, name="ascent_info")
@@ -112,6 +120,31 @@ module ascent
         implicit none
         character(kind=c_char) :: timer_name(*)
     end subroutine ascent_timer_stop
+
+    !--------------------------------------------------------------------------
+    function ascent_timer_id(timer_name) result(timer_id) &
+            bind(C, name="ascent_timer_id")
+        use iso_c_binding
+        implicit none
+        character(kind=c_char) :: timer_name(*)
+        integer(C_INT) :: timer_id
+    end function ascent_timer_id
+
+    !--------------------------------------------------------------------------
+    subroutine ascent_timer_start_id(timer_id) &
+            bind(C, name="ascent_timer_start_id")
+        use iso_c_binding
+        implicit none
+        integer(C_INT), value, intent(IN) :: timer_id
+    end subroutine ascent_timer_start_id
+
+    !--------------------------------------------------------------------------
+    subroutine ascent_timer_stop_id(timer_id) &
+            bind(C, name="ascent_timer_stop_id")
+        use iso_c_binding
+        implicit none
+        integer(C_INT), value, intent(IN) :: timer_id
+    end subroutine ascent_timer_stop_id
     !--------------------------------------------------------------------------
     subroutine ascent_timer_write() &
             bind(C, name="ascent_timer_write")
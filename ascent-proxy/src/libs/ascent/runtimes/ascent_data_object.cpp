@@ -145,6 +145,7 @@ void DataObject::reset_all()
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> null_vtkh(nullptr);
   m_vtkh = null_vtkh;
+  m_vtkh_cache = nullptr;
 #endif
 
 #if defined(ASCENT_DRAY_ENABLED)
@@ -165,6 +166,7 @@ void DataObject::reset(std::shared_ptr<conduit::Node> dataset)
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> null_vtkh(nullptr);
   m_vtkh = null_vtkh;
+  m_vtkh_cache = nullptr;
 #endif
 
 #if defined(ASCENT_DRAY_ENABLED)
@@ -196,6 +198,7 @@ void DataObject::reset(conduit::Node *dataset)
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> null_vtkh(nullptr);
   m_vtkh = null_vtkh;
+  m_vtkh_cache = nullptr;
 #endif
 
 #if defined(ASCENT_DRAY_ENABLED)
@@ -218,6 +221,7 @@ void DataObject::reset(conduit::Node *dataset)
 #if defined(ASCENT_DRAY_ENABLED)
 std::shared_ptr<dray::Collection> DataObject::as_dray_collection()
 {
+  std::lock_guard<std::recursive_mutex> lock(*m_mutex);
   if(m_source == Source::INVALID)
   {
     ASCENT_ERROR("Source never initialized: default constructed");
@@ -268,6 +272,7 @@ std::shared_ptr<dray::Collection> DataObject::as_dray_collection()
 #if defined(ASCENT_VTKM_ENABLED)
 std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
 {
+  std::lock_guard<std::recursive_mutex> lock(*m_mutex);
   if(m_source == Source::INVALID)
   {
     ASCENT_ERROR("Source never initialized: default constructed");
@@ -288,6 +293,8 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
     bool zero_copy = true;
     conduit::Node n_poly;
     conduit::Node *to_vtkh = nullptr;
+    // only data that outlives this conversion can be cached
+    VTKmConversionCache *cache = nullptr;
     
     if (m_low_bp != nullptr)
     {
@@ -300,12 +307,18 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
       else
       {
         to_vtkh = &(*m_low_bp);
+        if(m_source == Source::LOW_BP)
+        {
+          cache = m_vtkh_cache;
+        }
       }
     }
 
     // convert to vtkh
     std::shared_ptr<VTKHCollection>
-      vtkh_dset(VTKHDataAdapter::BlueprintToVTKHCollection(*to_vtkh, zero_copy));
+      vtkh_dset(VTKHDataAdapter::BlueprintToVTKHCollection(*to_vtkh,
+                                                           zero_copy,
+                                                           cache));
 
     m_vtkh = vtkh_dset;
     
@@ -318,13 +331,21 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
 
 void DataObject::reset_vtkh_collection()
 {
+  std::lock_guard<std::recursive_mutex> lock(*m_mutex);
   if(m_source != Source::VTKH)
     m_vtkh.reset();
 }
+
+void DataObject::vtkh_conversion_cache(VTKmConversionCache *cache)
+{
+  std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+  m_vtkh_cache = cache;
+}
 #endif
 
 std::shared_ptr<conduit::Node>  DataObject::as_low_order_bp()
 {
+  std::lock_guard<std::recursive_mutex> lock(*m_mutex);
   if(m_source == Source::INVALID)
   {
     ASCENT_ERROR("Source never initialized: default constructed");
@@ -379,6 +400,7 @@ std::shared_ptr<conduit::Node>  DataObject::as_high_order_bp()
 
 std::shared_ptr<conduit::Node>  DataObject::as_node()
 {
+  std::lock_guard<std::recursive_mutex> lock(*m_mutex);
   if(m_source == Source::INVALID)
   {
     ASCENT_ERROR("Source never initialized: default constructed");
@@ -17,6 +17,7 @@
 #include <ascent.hpp>
 #include <conduit.hpp>
 #include <memory>
+#include <mutex>
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -62,6 +63,9 @@ public:
 
   bool                            is_vtkh_coll_exists() const { return m_vtkh != nullptr; }
   void                            reset_vtkh_collection();
+  // low order blueprint conversions reuse the topologies the cache
+  // converted before. Not owned, cleared by reset.
+  void                            vtkh_conversion_cache(VTKmConversionCache *cache);
 
 #endif
 #if defined(ASCENT_DRAY_ENABLED)
@@ -78,6 +82,7 @@ protected:
   std::shared_ptr<conduit::Node>  m_high_bp;
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> m_vtkh;
+  VTKmConversionCache            *m_vtkh_cache = nullptr;
 #endif
 #if defined(ASCENT_DRAY_ENABLED)
   std::shared_ptr<dray::Collection> m_dray;
@@ -85,6 +90,10 @@ protected:
 
   Source m_source;
   std::string m_name;
+  // guards the lazy conversions, filters executing on different
+  // threads can share an input. shared so copies stay copyable.
+  std::shared_ptr<std::recursive_mutex> m_mutex
+    = std::make_shared<std::recursive_mutex>();
 };
 
 //-----------------------------------------------------------------------------
@@ -29,6 +29,10 @@
 #endif
 
 #include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <flow_timer.hpp>
 #include <stdio.h>
 #include <stdlib.h>
@@ -58,17 +62,166 @@ namespace expressions
 conduit::Node g_function_table;
 conduit::Node g_object_table;
 
+//-----------------------------------------------------------------------------
+// a compiled expression: the flow graph built from its AST lives in its
+// own workspace, and only its execution is repeated on each evaluation
+struct ExpressionPlan
+{
+  flow::Workspace workspace;
+  conduit::Node root;
+  // the table as built, filters fill in values during execution
+  conduit::Node symbol_table;
+  // types of the cached expressions the graph was built with
+  conduit::Node identifier_types;
+};
+
+// parsed expressions keyed by text
+std::map<std::string, std::shared_ptr<const ASTNode>> g_expression_asts;
+// idle compiled plans keyed by text, name, and dataset schema. An
+// evaluation takes its plan out of the cache while it runs, so each
+// workspace is only used by one evaluation at a time (other threads,
+// runtimes, or nested evaluations of the same key build their own)
+std::multimap<std::string, std::shared_ptr<ExpressionPlan>> g_expression_plans;
+// guards both caches, and the parser and graph construction, which use
+// global state
+std::mutex g_expression_plans_mutex;
+// bound on the number of cached plans (and asts), so generated
+// expressions do not grow the caches forever
+const size_t g_max_expression_plans = 256;
+
+//-----------------------------------------------------------------------------
+// names, dtypes, and string values (types, shapes, associations, and
+// references) of a tree. Array lengths, offsets, and strides are left
+// out, they only matter when the graph executes
+void
+schema_key(const conduit::Node &node, std::stringstream &ss)
+{
+  const conduit::DataType &dtype = node.dtype();
+  if(dtype.is_object() || dtype.is_list())
+  {
+    ss << "{";
+    const int num_children = node.number_of_children();
+    for(int i = 0; i < num_children; ++i)
+    {
+      const conduit::Node &child = node.child(i);
+      ss << child.name() << ":";
+      schema_key(child, ss);
+      ss << ";";
+    }
+    ss << "}";
+  }
+  else if(dtype.is_string())
+  {
+    ss << "'" << node.as_string() << "'";
+  }
+  else
+  {
+    ss << dtype.name();
+  }
+}
+
+//-----------------------------------------------------------------------------
+// the schema of the topologies, coordsets, and fields of all domains,
+// which is what parsing and graph construction (and jit planning)
+// depend on
+std::string
+dataset_schema_key(const conduit::Node &dataset)
+{
+  std::set<std::string> domain_keys;
+  const int num_domains = dataset.number_of_children();
+  for(int i = 0; i < num_domains; ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    std::stringstream ss;
+    const char *sections[3] = {"topologies", "coordsets", "fields"};
+    for(int s = 0; s < 3; ++s)
+    {
+      if(dom.has_child(sections[s]))
+      {
+        ss << sections[s] << ":";
+        schema_key(dom[sections[s]], ss);
+      }
+    }
+    domain_keys.insert(ss.str());
+  }
+
+  std::string key;
+  for(const auto &domain_key : domain_keys)
+  {
+    key += domain_key + "|";
+  }
+  return key;
+}
+
+//-----------------------------------------------------------------------------
+// true if the cached expressions the plan's identifiers refer to still
+// have the types the graph was built with
+bool
+identifier_types_match(const ExpressionPlan &plan,
+                       const ExpressionHistories &histories)
+{
+  const conduit::Node &types = plan.identifier_types;
+  const int num_identifiers = types.number_of_children();
+  for(int i = 0; i < num_identifiers; ++i)
+  {
+    const ExpressionHistory *history = histories.find(types.child(i).name());
+    if(history == nullptr || history->size() < 1)
+    {
+      return false;
+    }
+    const conduit::Node &last = history->result(history->size() - 1);
+    const std::string type = last.has_child("type") ? last["type"].as_string()
+                                                    : "";
+    if(type != types.child(i).as_string())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// the ast of `expr`, parsed once and then shared from the cache. Callers
+// hold g_expression_plans_mutex. Throws the parser's message on errors
+std::shared_ptr<const ASTNode>
+parse_expression(const std::string &expr)
+{
+  auto ast_itr = g_expression_asts.find(expr);
+  if(ast_itr != g_expression_asts.end())
+  {
+    return ast_itr->second;
+  }
+
+  scan_string(expr.c_str());
+  std::shared_ptr<const ASTNode> root_node(get_result());
+  if(g_expression_asts.size() >= g_max_expression_plans)
+  {
+    g_expression_asts.clear();
+  }
+  g_expression_asts[expr] = root_node;
+  return root_node;
+}
+
+//-----------------------------------------------------------------------------
+// returns an idle plan to the cache
+void
+release_plan(const std::string &plan_key,
+             const std::shared_ptr<ExpressionPlan> &plan)
+{
+  std::lock_guard<std::mutex> lock(g_expression_plans_mutex);
+  if(g_expression_plans.size() >= g_max_expression_plans)
+  {
+    g_expression_plans.clear();
+  }
+  g_expression_plans.insert(std::make_pair(plan_key, plan));
+}
+
 Cache ExpressionEval::m_cache;
 
 double
 Cache::last_known_time()
 {
-  double res = 0;
-  if(m_data.has_path("last_known_time"))
-  {
-    res = m_data["last_known_time"].as_float64();
-  }
-  return res;
+  return m_last_known_time;
 }
 
 bool
@@ -80,64 +233,13 @@ Cache::filtered()
 void
 Cache::last_known_time(double time)
 {
-  m_data["last_known_time"] = time;
+  m_last_known_time = time;
 }
 
 void
 Cache::filter_time(double ftime)
 {
-  const int num_entries = m_data.number_of_children();
-  int removal_count = 0;
-  for(int i = 0; i < num_entries; ++i)
-  {
-    conduit::Node &entry = m_data.child(i);
-    if(entry.name() == "last_known_time" ||
-       entry.name() == "session_cache_info")
-    {
-      continue;
-    }
-
-    bool invalid_time = true;
-    while(invalid_time && entry.number_of_children() > 0)
-    {
-      int last = entry.number_of_children() - 1;
-
-      if(!entry.child(last).has_path("time"))
-      {
-        // if there is no time, we can reason about
-        // anything
-        entry.remove(last);
-        removal_count++;
-      }
-      else if(entry.child(last)["time"].to_float64() >= ftime)
-      {
-        entry.remove(last);
-        removal_count++;
-      }
-      else
-      {
-        invalid_time = false;
-      }
-    }
-  }
-
-  // clean up entries with no children
-  bool clean = false;
-  while(!clean)
-  {
-    const int size = m_data.number_of_children();
-    bool removed = false;
-    for(int i = 0; i < size; ++i)
-    {
-      if(m_data.child(i).number_of_children() == 0)
-      {
-        m_data.remove(i);
-        removed = true;
-        break;
-      }
-    }
-    clean = !removed;
-  }
+  const int removal_count = m_histories.truncate(ftime);
 
   time_t t;
   char curr_time[100];
@@ -148,8 +250,14 @@ Cache::filter_time(double ftime)
   msg << "Time travel detected at " << curr_time << '\n';
   msg << "Removed all expression cache entries (" << removal_count << ")"
       << " after simulation time " << ftime << ".";
-  m_data["ascent_cache_info"].append() = msg.str();
+  m_cache_info.append() = msg.str();
   m_filtered = true;
+
+  // logs can only grow, so the removed entries take a fresh start
+  for(auto &log : m_session_logs)
+  {
+    log.second.rewrite();
+  }
 }
 
 bool
@@ -171,62 +279,110 @@ Cache::load(const std::string &dir, const std::string &session)
   std::string session_file = conduit::utils::join_path(dir, file_name);
   m_session_file = session_file;
 
-  bool exists = conduit::utils::is_file(session_file);
-
-  if(m_rank == 0 && exists)
+  conduit::Node data;
+  if(!session_log(session_file).load(m_histories, data))
   {
-    m_data.load(session_file + ".yaml", "yaml");
-  }
+    // sessions saved before the log was added
+    const std::string yaml_file = session_file + ".yaml";
+    bool exists = conduit::utils::is_file(yaml_file);
+
+    if(m_rank == 0 && exists)
+    {
+      data.load(yaml_file, "yaml");
+    }
 
 #ifdef ASCENT_MPI_ENABLED
-  if(exists)
+    if(exists)
+    {
+      conduit::relay::mpi::broadcast_using_schema(data, 0, mpi_comm);
+    }
+#endif
+  }
+
+  if(data.has_child("last_known_time"))
   {
-    conduit::relay::mpi::broadcast_using_schema(m_data, 0, mpi_comm);
+    m_last_known_time = data["last_known_time"].to_float64();
+    data.remove_child("last_known_time");
   }
-#endif
+  if(data.has_child("ascent_cache_info"))
+  {
+    m_cache_info = data["ascent_cache_info"];
+    data.remove_child("ascent_cache_info");
+  }
+  m_histories.from_node(data);
   m_loaded = true;
 }
 
-void Cache::save()
+void
+Cache::to_node(conduit::Node &data) const
 {
-  // the session file can be blank during testing,
-  // since its not actually opening ascent
-  if(m_rank == 0 && !m_data.dtype().is_empty() && m_session_file != "")
+  m_histories.to_node(data);
+  if(m_histories.names().size() > 0 ||
+     m_cache_info.number_of_children() > 0)
   {
-    m_data.save(m_session_file+".yaml","yaml");
+    info_to_node(data);
   }
 }
 
-void Cache::save(const std::string &filename)
+void
+Cache::info_to_node(conduit::Node &info) const
 {
-  // the session file can be blank during testing,
-  // since its not actually opening ascent
-  if(m_rank == 0 &&
-     !m_data.dtype().is_empty())
+  info["last_known_time"] = m_last_known_time;
+  if(m_cache_info.number_of_children() > 0)
   {
-    m_data.save(filename+".yaml","yaml");
+    info["ascent_cache_info"] = m_cache_info;
   }
 }
 
-void Cache::save(const std::string &filename,
-                 const std::vector<std::string> &selection)
+SessionLog &
+Cache::session_log(const std::string &filename)
 {
-  conduit::Node data;
-  for(const auto &expr : selection)
+  auto it = m_session_logs.find(filename);
+  if(it == m_session_logs.end())
   {
-    if(m_data.has_path(expr))
-    {
-      data[expr].set_external(m_data[expr]);
-    }
+    it = m_session_logs.emplace(filename, SessionLog(filename)).first;
+  }
+  return it->second;
+}
+
+void
+Cache::reset()
+{
+  m_histories.reset();
+  m_last_known_time = 0.0;
+  m_cache_info.reset();
+  for(auto &log : m_session_logs)
+  {
+    log.second.rewrite();
   }
+}
+
+void Cache::save()
+{
   // the session file can be blank during testing,
   // since its not actually opening ascent
-  // or there might not be match
-  if(m_rank == 0 &&
-     !data.dtype().is_empty())
+  if(m_rank == 0 && m_session_file != "")
+  {
+    save(m_session_file);
+  }
+}
+
+void Cache::save(const std::string &filename)
+{
+  save(filename, std::vector<std::string>());
+}
+
+void Cache::save(const std::string &filename,
+                 const std::vector<std::string> &selection)
+{
+  if(m_rank != 0)
   {
-    data.save(filename+".yaml","yaml");
+    return;
   }
+  // only the results recorded since the last save are written
+  conduit::Node info;
+  info_to_node(info);
+  session_log(filename).append(m_histories, selection, info);
 }
 
 Cache::~Cache()
@@ -1597,71 +1753,118 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
     expr_name = expr;
   }
 
-  // stores temporary fields, topos, and coords that need to be removed after
-  // the expression runs
-  conduit::Node remove;
-  w.registry().add<conduit::Node>("remove", &remove, -1);
-
-  w.registry().add<DataObject>("dataset", &m_data_object, -1);
-  w.registry().add<conduit::Node>("cache", &m_cache.m_data, -1);
-  w.registry().add<conduit::Node>("function_table", &g_function_table, -1);
-  w.registry().add<conduit::Node>("object_table", &g_object_table, -1);
-  int cycle = get_state_var(*m_data_object.as_node().get(), "cycle").to_int32();
-  w.registry().add<int>("cycle", &cycle, -1);
+  conduit::Node *dataset = m_data_object.as_node().get();
+  const std::string plan_key = expr + "\n" + expr_name + "\n" +
+                               dataset_schema_key(*dataset);
 
-  try
+  std::shared_ptr<ExpressionPlan> plan;
   {
-    scan_string(expr.c_str());
-
+    std::lock_guard<std::mutex> lock(g_expression_plans_mutex);
+    auto plan_itr = g_expression_plans.find(plan_key);
+    if(plan_itr != g_expression_plans.end())
+    {
+      plan = plan_itr->second;
+      g_expression_plans.erase(plan_itr);
+    }
   }
-  catch(const char *msg)
+  // identifier types come from the cache, not the dataset
+  if(plan && !identifier_types_match(*plan, m_cache.m_histories))
   {
-    w.reset();
-    ASCENT_ERROR("Expression parsing error: " << msg << " in '" << expr << "'");
+    plan.reset();
   }
+  const bool plan_cached = plan != nullptr;
+  if(!plan_cached)
+  {
+    plan = std::make_shared<ExpressionPlan>();
+  }
+  ASCENT_DATA_ADD("plan cached", plan_cached ? 1 : 0);
 
-  ASTNode *root_node = get_result();
+  flow::Workspace &pw = plan->workspace;
 
-  conduit::Node root;
-  conduit::Node symbol_table;
+  // stores temporary fields, topos, and coords that need to be removed after
+  // the expression runs
+  conduit::Node remove;
+  pw.registry().add<conduit::Node>("remove", &remove, -1);
+
+  pw.registry().add<DataObject>("dataset", &m_data_object, -1);
+  pw.registry().add<ExpressionHistories>("cache", &m_cache.m_histories, -1);
+  pw.registry().add<conduit::Node>("function_table", &g_function_table, -1);
+  pw.registry().add<conduit::Node>("object_table", &g_object_table, -1);
+  int cycle = get_state_var(*dataset, "cycle").to_int32();
+  pw.registry().add<int>("cycle", &cycle, -1);
+  if(m_batched_reductions != nullptr)
+  {
+    pw.registry().add<conduit::Node>("batched_reductions",
+                                     m_batched_reductions,
+                                     -1);
+  }
 
-  try
+  if(!plan_cached)
   {
-    flow::Timer build_graph_timer;
-    // change the execution policy here
-    // change false to true to generate a graph with verbose names
-    BuildGraphVisitor build_graph(
-        w, std::make_shared<const FusePolicy>(), false);
-    // BuildGraphVisitor build_graph(
-    //     w, std::make_shared<const RoundtripPolicy>(), false);
-    root_node->accept(&build_graph);
-    root = build_graph.get_output();
-
-    symbol_table = build_graph.table();
-    w.registry().add<conduit::Node>("symbol_table", &symbol_table, -1);
-    // if root is a derived field add a JitFilter to execute it
-    if(root["type"].as_string() == "jitable")
+    std::lock_guard<std::mutex> lock(g_expression_plans_mutex);
+    std::shared_ptr<const ASTNode> root_node;
+    try
     {
-      jit_root(root, expr_name);
+      root_node = parse_expression(expr);
+    }
+    catch(const char *msg)
+    {
+      pw.reset();
+      ASCENT_ERROR("Expression parsing error: " << msg << " in '" << expr << "'");
     }
 
-    //w.graph().save_dot_html("ascent_expressions_graph.html");
-    ASCENT_DATA_ADD("build_graph time", build_graph_timer.elapsed());
+    try
+    {
+      flow::Timer build_graph_timer;
+      // change the execution policy here
+      // change false to true to generate a graph with verbose names
+      BuildGraphVisitor build_graph(
+          pw, std::make_shared<const FusePolicy>(), false);
+      // BuildGraphVisitor build_graph(
+      //     pw, std::make_shared<const RoundtripPolicy>(), false);
+      root_node->accept(&build_graph);
+      plan->root = build_graph.get_output();
+      plan->symbol_table = build_graph.table();
+      plan->identifier_types = build_graph.identifier_types();
+
+      // if root is a derived field add a JitFilter to execute it
+      if(plan->root["type"].as_string() == "jitable")
+      {
+        jit_root(pw, plan->root, expr_name);
+      }
+      ASCENT_DATA_ADD("build_graph time", build_graph_timer.elapsed());
+    }
+    catch(std::exception &e)
+    {
+      pw.reset();
+      ASCENT_ERROR("Error while executing expression '" << expr
+                                                        << "': " << e.what());
+    }
+  }
+
+  const conduit::Node &root = plan->root;
+  conduit::Node symbol_table = plan->symbol_table;
+
+  try
+  {
+    pw.registry().add<conduit::Node>("symbol_table", &symbol_table, -1);
+
+    //pw.graph().save_dot_html("ascent_expressions_graph.html");
     flow::Timer execute_timer;
-    w.execute();
+    pw.execute();
 
     ASCENT_DATA_ADD("execute time", execute_timer.elapsed());
   }
   catch(std::exception &e)
   {
-    delete root_node;
-    w.reset();
+    // a plan that failed is not returned, it is rebuilt on the next use
+    pw.reset();
     ASCENT_ERROR("Error while executing expression '" << expr
                                                       << "': " << e.what());
   }
   std::string filter_name = root["filter_name"].as_string();
 
-  conduit::Node *n_res = w.registry().fetch<conduit::Node>(filter_name);
+  conduit::Node *n_res = pw.registry().fetch<conduit::Node>(filter_name);
   conduit::Node return_val = *n_res;
 
   //return_val.print();
@@ -1669,7 +1872,6 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
 
   // remove temporary fields, topologies, and coordsets from the dataset
   // TODO: We need a way to delete the intermediate results during execution
-  conduit::Node *dataset = m_data_object.as_node().get();
   const int num_domains = dataset->number_of_children();
   for(int i = 0; i < num_domains; ++i)
   {
@@ -1691,7 +1893,7 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   //std::cout<<m_data_object.as_node()->to_summary_string()<<"\n";
 
   // add the sim time
-  conduit::Node n_time = get_state_var(*m_data_object.as_node().get(), "time");
+  conduit::Node n_time = get_state_var(*dataset, "time");
   double time = 0;
   bool valid_time = false;
   if(!n_time.dtype().is_empty())
@@ -1725,11 +1927,7 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
 
   //return_val.print();
   // add the result to the cache
-  {
-    std::stringstream cache_entry;
-    cache_entry << expr_name << "/" << cycle;
-    m_cache.m_data[cache_entry.str()] = return_val;
-  }
+  m_cache.m_histories.record(expr_name, cycle, return_val);
   // now we might have intermediate symbol, and
   // we also need to add them to the cache
   const int num_symbols = symbol_table.number_of_children();
@@ -1738,15 +1936,13 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
     const conduit::Node &symbol = symbol_table.child(i);
     if(symbol.has_path("value"))
     {
-      const std::string symbol_name = symbol.name();
-      std::stringstream cache_entry;
-      cache_entry << symbol_name << "/" << cycle;
-      m_cache.m_data[cache_entry.str()] = symbol;
+      m_cache.m_histories.record(symbol.name(), cycle, symbol);
     }
   }
 
-  delete root_node;
-  w.reset();
+  // keep the graph, only drop this evaluation's data
+  pw.registry().reset();
+  release_plan(plan_key, plan);
 #ifdef ASCENT_JIT_ENABLED
   ASCENT_DATA_ADD("Device high water mark", ArrayRegistry::high_water_mark());
   ASCENT_DATA_ADD("Current Device usage ", ArrayRegistry::device_usage());
@@ -1757,7 +1953,9 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   return return_val;
 }
 
-void ExpressionEval::jit_root(conduit::Node &root, const std::string &expr_name)
+void ExpressionEval::jit_root(flow::Workspace &w,
+                              conduit::Node &root,
+                              const std::string &expr_name)
 {
   // When the root node in the executiuon graph is a jittable
   // result, we have to complile that kernel and execute it
@@ -1782,16 +1980,27 @@ void ExpressionEval::jit_root(conduit::Node &root, const std::string &expr_name)
   }
 }
 //-----------------------------------------------------------------------------
-const conduit::Node &
-ExpressionEval::get_cache()
+void
+ExpressionEval::get_cache(conduit::Node &data)
 {
-  return m_cache.m_data;
+  data.reset();
+  m_cache.to_node(data);
 }
 
 void
 ExpressionEval::reset_cache()
 {
-  m_cache.m_data.reset();
+  m_cache.reset();
+  // identifier types in compiled plans came from the cache
+  reset_plans();
+}
+
+void
+ExpressionEval::reset_plans()
+{
+  std::lock_guard<std::mutex> lock(g_expression_plans_mutex);
+  g_expression_plans.clear();
+  g_expression_asts.clear();
 }
 
 void
@@ -1806,21 +2015,49 @@ ExpressionEval::save_cache()
   m_cache.save();
 }
 
-void ExpressionEval::get_last(conduit::Node &data)
+void
+ExpressionEval::record(const std::string &expr_name,
+                       const int cycle,
+                       const conduit::Node &result)
 {
-  data.reset();
-  const int entries = m_cache.m_data.number_of_children();
+  m_cache.m_histories.record(expr_name, cycle, result);
+}
 
-  for(int i = 0; i < entries; ++i)
+void
+ExpressionEval::batched_reductions(conduit::Node &reductions)
+{
+  m_batched_reductions = &reductions;
+}
+
+std::vector<std::string>
+ExpressionEval::reduced_fields(const std::string &expr)
+{
+  std::lock_guard<std::mutex> lock(g_expression_plans_mutex);
+  std::shared_ptr<const ASTNode> root_node;
+  try
   {
-    conduit::Node &entry = m_cache.m_data.child(i);
-    const int cycles = entry.number_of_children();
-    if(cycles > 0)
-    {
-      conduit::Node &cycle = entry.child(cycles - 1);
-      data[cycle.path()].set_external(cycle);
-    }
+    root_node = parse_expression(expr);
+  }
+  catch(const char *)
+  {
+    // evaluate reports the error
+    return std::vector<std::string>();
   }
+  ReducedFieldsVisitor visitor;
+  root_node->accept(&visitor);
+  return visitor.fields();
+}
+
+void
+ExpressionEval::history_length(const int length)
+{
+  m_cache.m_histories.capacity(length);
+}
+
+void ExpressionEval::get_last(conduit::Node &data)
+{
+  data.reset();
+  m_cache.m_histories.last_to_node(data);
 }
 void ExpressionEval::save_cache(const std::string &filename,
                                 const std::vector<std::string> &selection)
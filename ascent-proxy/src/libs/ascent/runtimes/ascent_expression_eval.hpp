@@ -16,6 +16,11 @@
 #include <conduit.hpp>
 #include <ascent_exports.h>
 #include <ascent_data_object.hpp>
+#include <expressions/ascent_expression_history.hpp>
+#include <expressions/ascent_session_log.hpp>
+
+#include <map>
+#include <vector>
 
 #include "flow_workspace.hpp"
 //-----------------------------------------------------------------------------
@@ -39,11 +44,16 @@ void ASCENT_API initialize_objects();
 
 struct Cache
 {
-  conduit::Node m_data;
-  int m_rank;
+  ExpressionHistories m_histories;
+  double m_last_known_time = 0.0;
+  // notes about edits made to the history, e.g. after time travel
+  conduit::Node m_cache_info;
+  int m_rank = 0;
   bool m_filtered = false;
   bool m_loaded = false;
   std::string m_session_file;
+  // the logs saved to so far, by session file
+  std::map<std::string, SessionLog> m_session_logs;
 
   void load(const std::string &dir,
             const std::string &session);
@@ -53,11 +63,19 @@ struct Cache
   void filter_time(double ftime);
   bool filtered();
   bool loaded();
+  // appends the results recorded since the last save to the session log
   void save();
   // allow saving with an alternative name
   void save(const std::string &filename);
   void save(const std::string &filename,
             const std::vector<std::string> &selection);
+  // the tree layout of yaml session files: expr/cycle/result plus
+  // last_known_time and ascent_cache_info
+  void to_node(conduit::Node &data) const;
+  void reset();
+  SessionLog &session_log(const std::string &filename);
+  // last_known_time and ascent_cache_info
+  void info_to_node(conduit::Node &info) const;
 
   ~Cache();
 };
@@ -68,17 +86,25 @@ class ASCENT_API ExpressionEval
 {
 protected:
   DataObject m_data_object;
-  flow::Workspace w;
+  conduit::Node *m_batched_reductions = nullptr;
   static Cache m_cache;
-  void jit_root(conduit::Node &root, const std::string &expr_name);
+  void jit_root(flow::Workspace &w,
+                conduit::Node &root,
+                const std::string &expr_name);
 public:
   ExpressionEval(DataObject &dataset);
   ExpressionEval(conduit::Node *dataset);
   DataObject& data_object();
 
-  static const conduit::Node &get_cache();
+  // builds the tree view of the whole history, prefer get_last
+  static void get_cache(conduit::Node &data);
   static void get_last(conduit::Node &data);
   static void reset_cache();
+  // max results kept per expression, 0 (default) keeps all of them
+  static void history_length(const int length);
+  // drops the parsed and compiled expressions, which are otherwise
+  // reused by every evaluation of the same expression on the same schema
+  static void reset_plans();
   static void load_cache(const std::string &dir,
                          const std::string &session);
 
@@ -88,6 +114,22 @@ public:
   static void save_cache(const std::string &filename);
   static void save_cache();
 
+  // adds a result that was not computed by evaluate (e.g. a surrogate
+  // prediction) to the cache, so history and info can see it
+  static void record(const std::string &expr_name,
+                     const int cycle,
+                     const conduit::Node &result);
+
+  // whole field reductions computed ahead of the evaluation (by the
+  // query batch), laid out like field_reductions_batched. They must
+  // outlive the calls to evaluate
+  void batched_reductions(conduit::Node &reductions);
+
+  // the fields `expr` reduces whole with max, min, sum, or avg (e.g.
+  // max(field('energy'))), once per reduction. Expressions that do not
+  // parse reduce none
+  static std::vector<std::string> reduced_fields(const std::string &expr);
+
   conduit::Node evaluate(const std::string expr, std::string exp_name = "");
 };
 
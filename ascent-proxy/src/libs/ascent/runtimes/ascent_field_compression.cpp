@@ -0,0 +1,732 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_field_compression.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_field_compression.hpp"
+
+#include <ascent_logging.hpp>
+#include <ascent_logging_old.hpp>
+#include <conduit_blueprint.hpp>
+#include <flow_workspace.hpp>
+
+#ifdef ASCENT_MPI_ENABLED
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin detail:: --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// codes are packed in blocks of this many values
+const index_t BLOCK_SIZE = 64;
+// larger quantized differences are stored as unpredictable values
+const double MAX_QUANT = 1099511627776.0; // 2^40
+
+//-----------------------------------------------------------------------------
+uint64
+zigzag(const int64 value)
+{
+  return (static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63);
+}
+
+//-----------------------------------------------------------------------------
+int64
+unzigzag(const uint64 value)
+{
+  return static_cast<int64>(value >> 1) ^ -static_cast<int64>(value & 1);
+}
+
+//-----------------------------------------------------------------------------
+int
+bit_width(uint64 value)
+{
+  int bits = 0;
+  while(value != 0)
+  {
+    bits++;
+    value >>= 1;
+  }
+  return bits;
+}
+
+//-----------------------------------------------------------------------------
+class BitWriter
+{
+public:
+  BitWriter(std::vector<uint8> &bytes)
+    : m_bytes(bytes),
+      m_used(0)
+  {}
+
+  void write(uint64 value, int bits)
+  {
+    while(bits > 0)
+    {
+      if(m_used == 0)
+      {
+        m_bytes.push_back(0);
+      }
+      const int room = 8 - m_used;
+      const int take = bits < room ? bits : room;
+      const uint64 mask = (uint64(1) << take) - 1;
+      m_bytes.back() |= static_cast<uint8>((value & mask) << m_used);
+      value >>= take;
+      bits -= take;
+      m_used = (m_used + take) % 8;
+    }
+  }
+
+private:
+  std::vector<uint8> &m_bytes;
+  int m_used;
+};
+
+//-----------------------------------------------------------------------------
+class BitReader
+{
+public:
+  BitReader(const uint8 *bytes, const index_t size)
+    : m_bytes(bytes),
+      m_size(size),
+      m_pos(0),
+      m_used(0)
+  {}
+
+  uint64 read(int bits)
+  {
+    uint64 value = 0;
+    int shift = 0;
+    while(bits > 0)
+    {
+      if(m_pos >= m_size)
+      {
+        ASCENT_ERROR("Compressed field codes end unexpectedly");
+      }
+      const int room = 8 - m_used;
+      const int take = bits < room ? bits : room;
+      const uint64 mask = (uint64(1) << take) - 1;
+      value |= ((static_cast<uint64>(m_bytes[m_pos]) >> m_used) & mask) << shift;
+      shift += take;
+      bits -= take;
+      m_used += take;
+      if(m_used == 8)
+      {
+        m_used = 0;
+        m_pos++;
+      }
+    }
+    return value;
+  }
+
+private:
+  const uint8 *m_bytes;
+  const index_t m_size;
+  index_t m_pos;
+  int m_used;
+};
+
+//-----------------------------------------------------------------------------
+// code 0 marks an unpredictable value, others are the zigzagged
+// quantized difference plus one
+template<typename T>
+void
+compress(const DataArray<T> &values,
+         const double error_bound,
+         Node &compressed)
+{
+  const index_t num_values = values.number_of_elements();
+  const double bin = 2.0 * error_bound;
+
+  std::vector<uint64> codes(num_values);
+  // kept in the source type, they are stored exactly
+  std::vector<T> unpredictable;
+  double max_error = 0.0;
+  double pred = 0.0;
+  for(index_t i = 0; i < num_values; ++i)
+  {
+    const double x = static_cast<double>(values[i]);
+    double q = 0.0;
+    if(bin > 0.0)
+    {
+      q = std::round((x - pred) / bin);
+    }
+
+    uint64 code = 0;
+    // nan and inf never pass these checks
+    if(std::abs(q) < MAX_QUANT)
+    {
+      // reconstruct exactly like decompress does, in T
+      const double recon = static_cast<double>(static_cast<T>(pred + q * bin));
+      const double error = std::abs(recon - x);
+      if(error <= error_bound)
+      {
+        code = zigzag(static_cast<int64>(q)) + 1;
+        pred = recon;
+        max_error = std::max(max_error, error);
+      }
+    }
+
+    if(code == 0)
+    {
+      unpredictable.push_back(values[i]);
+      if(std::isfinite(x))
+      {
+        pred = x;
+      }
+    }
+    codes[i] = code;
+  }
+
+  std::vector<uint8> bytes;
+  BitWriter writer(bytes);
+  for(index_t start = 0; start < num_values; start += BLOCK_SIZE)
+  {
+    const index_t end = std::min(start + BLOCK_SIZE, num_values);
+    uint64 block_max = 0;
+    for(index_t i = start; i < end; ++i)
+    {
+      block_max = std::max(block_max, codes[i]);
+    }
+    const int width = bit_width(block_max);
+    writer.write(width, 8);
+    for(index_t i = start; i < end; ++i)
+    {
+      writer.write(codes[i], width);
+    }
+  }
+
+  compressed.reset();
+  compressed["method"] = "lorenzo_quantize";
+  compressed["dtype"] = sizeof(T) == sizeof(float64) ? "float64" : "float32";
+  compressed["num_values"] = static_cast<int64>(num_values);
+  compressed["error_bound"] = error_bound;
+  compressed["max_error"] = max_error;
+  compressed["codes"].set(DataType::uint8(bytes.size()));
+  std::copy(bytes.begin(), bytes.end(), compressed["codes"].as_uint8_ptr());
+  compressed["unpredictable"].set(unpredictable);
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+decompress(const Node &compressed, T *values)
+{
+  const index_t num_values = compressed["num_values"].to_int64();
+  const double bin = 2.0 * compressed["error_bound"].to_float64();
+  const Node &n_codes = compressed["codes"];
+  // unpredictable values are few, widen float32 ones to read both
+  // types the same way (older versions always stored float64)
+  const Node *n_unpredictable = &compressed["unpredictable"];
+  Node n_unpredictable_64;
+  if(!n_unpredictable->dtype().is_float64())
+  {
+    n_unpredictable->to_float64_array(n_unpredictable_64);
+    n_unpredictable = &n_unpredictable_64;
+  }
+  const float64_array unpredictable = n_unpredictable->value();
+  const index_t num_unpredictable = unpredictable.number_of_elements();
+
+  BitReader reader(n_codes.as_uint8_ptr(),
+                   n_codes.dtype().number_of_elements());
+  index_t u = 0;
+  double pred = 0.0;
+  for(index_t start = 0; start < num_values; start += BLOCK_SIZE)
+  {
+    const index_t end = std::min(start + BLOCK_SIZE, num_values);
+    const int width = static_cast<int>(reader.read(8));
+    for(index_t i = start; i < end; ++i)
+    {
+      const uint64 code = reader.read(width);
+      if(code == 0)
+      {
+        if(u >= num_unpredictable)
+        {
+          ASCENT_ERROR("Compressed field is missing unpredictable values");
+        }
+        const double x = unpredictable[u++];
+        values[i] = static_cast<T>(x);
+        if(std::isfinite(x))
+        {
+          pred = x;
+        }
+      }
+      else
+      {
+        const double q = static_cast<double>(unzigzag(code - 1));
+        const T recon = static_cast<T>(pred + q * bin);
+        values[i] = recon;
+        pred = static_cast<double>(recon);
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+range(const DataArray<T> &values, double &min_value, double &max_value)
+{
+  const index_t num_values = values.number_of_elements();
+  for(index_t i = 0; i < num_values; ++i)
+  {
+    const double x = static_cast<double>(values[i]);
+    if(std::isfinite(x))
+    {
+      min_value = std::min(min_value, x);
+      max_value = std::max(max_value, x);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+value_range(const Node &values, double &min_value, double &max_value)
+{
+  if(values.number_of_children() > 0)
+  {
+    for(int i = 0; i < values.number_of_children(); ++i)
+    {
+      value_range(values.child(i), min_value, max_value);
+    }
+    return;
+  }
+
+  if(values.dtype().is_float64())
+  {
+    range<float64>(values.value(), min_value, max_value);
+  }
+  else if(values.dtype().is_float32())
+  {
+    range<float32>(values.value(), min_value, max_value);
+  }
+  else
+  {
+    ASCENT_ERROR("Field compression only supports float32 and float64 "
+                 "values, given "<<values.dtype().name());
+  }
+}
+
+//-----------------------------------------------------------------------------
+// compresses one field, adds its sizes and error to the stats arrays
+void
+compress_field(const Node &field,
+               const double error_bound,
+               Node &output,
+               double &original_bytes,
+               double &compressed_bytes,
+               double &max_error)
+{
+  const Node &values = field["values"];
+
+  const int num_children = field.number_of_children();
+  for(int i = 0; i < num_children; ++i)
+  {
+    if(field.child(i).name() != "values")
+    {
+      output[field.child(i).name()].set_external(field.child(i));
+    }
+  }
+
+  std::vector<const Node*> components;
+  std::vector<Node*> outputs;
+  if(values.number_of_children() == 0)
+  {
+    components.push_back(&values);
+    outputs.push_back(&output["values"]);
+  }
+  else
+  {
+    for(int i = 0; i < values.number_of_children(); ++i)
+    {
+      components.push_back(&values.child(i));
+      outputs.push_back(&output["values"][values.child(i).name()]);
+    }
+  }
+
+  for(size_t i = 0; i < components.size(); ++i)
+  {
+    compress_values(*components[i], error_bound, *outputs[i]);
+    const DataType &dtype = components[i]->dtype();
+    original_bytes += static_cast<double>(dtype.number_of_elements() *
+                                          dtype.element_bytes());
+    compressed_bytes += static_cast<double>((*outputs[i])["codes"].total_bytes_compact() +
+                                            (*outputs[i])["unpredictable"].total_bytes_compact());
+    max_error = std::max(max_error, (*outputs[i])["max_error"].to_float64());
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+decompress_field(const Node &compressed, Node &field)
+{
+  const int num_children = compressed.number_of_children();
+  for(int i = 0; i < num_children; ++i)
+  {
+    if(compressed.child(i).name() != "values")
+    {
+      field[compressed.child(i).name()].set(compressed.child(i));
+    }
+  }
+
+  const Node &values = compressed["values"];
+  if(values.has_child("method"))
+  {
+    decompress_values(values, field["values"]);
+  }
+  else
+  {
+    for(int i = 0; i < values.number_of_children(); ++i)
+    {
+      decompress_values(values.child(i), field["values"][values.child(i).name()]);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end detail:: --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+bool
+verify_compression_params(const Node &params, Node &info)
+{
+  if(!params.has_child("compression"))
+  {
+    return true;
+  }
+
+  bool res = true;
+  const Node &n_compression = params["compression"];
+  if(!n_compression.dtype().is_object())
+  {
+    info["errors"].append() = "'compression' must be a list of fields "
+                              "with 'abs_error' or 'rel_error'";
+    return false;
+  }
+
+  const int num_fields = n_compression.number_of_children();
+  for(int i = 0; i < num_fields; ++i)
+  {
+    const Node &n_field = n_compression.child(i);
+    const std::string prefix = "compression/" + n_field.name();
+    const bool has_abs = n_field.has_child("abs_error");
+    const bool has_rel = n_field.has_child("rel_error");
+    if(has_abs == has_rel)
+    {
+      info["errors"].append() = "'" + prefix + "' must have one of "
+                                "'abs_error' or 'rel_error'";
+      res = false;
+      continue;
+    }
+
+    const std::string bound = has_abs ? "abs_error" : "rel_error";
+    const Node &n_bound = n_field[bound];
+    if(!n_bound.dtype().is_number())
+    {
+      info["errors"].append() = "'" + prefix + "/" + bound + "' must be a number";
+      res = false;
+    }
+    else if(!(n_bound.to_float64() >= 0.0))
+    {
+      info["errors"].append() = "'" + prefix + "/" + bound + "' must not be negative";
+      res = false;
+    }
+
+    if(n_field.number_of_children() != 1)
+    {
+      info["errors"].append() = "'" + prefix + "' only supports 'abs_error' "
+                                "or 'rel_error'";
+      res = false;
+    }
+  }
+
+  if(res)
+  {
+    info["info"].append() = "includes 'compression'";
+  }
+  return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+compress_values(const Node &values,
+                const double error_bound,
+                Node &compressed)
+{
+  if(values.dtype().is_float64())
+  {
+    detail::compress<float64>(values.value(), error_bound, compressed);
+  }
+  else if(values.dtype().is_float32())
+  {
+    detail::compress<float32>(values.value(), error_bound, compressed);
+  }
+  else
+  {
+    ASCENT_ERROR("Field compression only supports float32 and float64 "
+                 "values, given "<<values.dtype().name());
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+decompress_values(const Node &compressed, Node &values)
+{
+  if(!compressed.has_child("method") ||
+     compressed["method"].as_string() != "lorenzo_quantize")
+  {
+    ASCENT_ERROR("Unknown field compression method");
+  }
+
+  const index_t num_values = compressed["num_values"].to_int64();
+  const std::string dtype = compressed["dtype"].as_string();
+  if(dtype == "float64")
+  {
+    values.set(DataType::float64(num_values));
+    detail::decompress<float64>(compressed, values.as_float64_ptr());
+  }
+  else if(dtype == "float32")
+  {
+    values.set(DataType::float32(num_values));
+    detail::decompress<float32>(compressed, values.as_float32_ptr());
+  }
+  else
+  {
+    ASCENT_ERROR("Unknown compressed field type '"<<dtype<<"'");
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+compress_fields(const Node &mesh,
+                const Node &options,
+                Node &output,
+                Node &stats)
+{
+  output.reset();
+  stats.reset();
+
+  // zero copy multi domain view
+  Node view;
+  blueprint::mesh::to_multi_domain(mesh, view);
+
+  const int num_fields = options.number_of_children();
+  const bool named_domains = view.dtype().is_object();
+  const int num_domains = view.number_of_children();
+
+  // rel_error bounds are relative to the range of the field over all
+  // domains and ranks, so every piece of the field gets the same bound.
+  // min and max are reduced together as min(min) and min(-max)
+  std::vector<double> ranges(num_fields * 2,
+                             std::numeric_limits<double>::max());
+  bool has_rel_error = false;
+  for(int i = 0; i < num_fields; ++i)
+  {
+    if(!options.child(i).has_child("rel_error"))
+    {
+      continue;
+    }
+    has_rel_error = true;
+    const std::string fname = options.child(i).name();
+    double min_value = std::numeric_limits<double>::max();
+    double max_value = std::numeric_limits<double>::lowest();
+    for(int d = 0; d < num_domains; ++d)
+    {
+      const Node &dom = view.child(d);
+      if(dom.has_path("fields/" + fname + "/values"))
+      {
+        detail::value_range(dom["fields"][fname]["values"],
+                            min_value,
+                            max_value);
+      }
+    }
+    ranges[i * 2] = min_value;
+    ranges[i * 2 + 1] = -max_value;
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  if(has_rel_error)
+  {
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    std::vector<double> global_ranges(ranges.size(), 0.0);
+    MPI_Allreduce(ranges.data(),
+                  global_ranges.data(),
+                  static_cast<int>(ranges.size()),
+                  MPI_DOUBLE,
+                  MPI_MIN,
+                  mpi_comm);
+    ranges.swap(global_ranges);
+  }
+#endif
+
+  std::vector<double> error_bounds(num_fields, 0.0);
+  for(int i = 0; i < num_fields; ++i)
+  {
+    const Node &n_opts = options.child(i);
+    if(n_opts.has_child("abs_error"))
+    {
+      error_bounds[i] = n_opts["abs_error"].to_float64();
+      continue;
+    }
+    const double min_value = ranges[i * 2];
+    const double max_value = -ranges[i * 2 + 1];
+    if(max_value > min_value)
+    {
+      error_bounds[i] = n_opts["rel_error"].to_float64() * (max_value - min_value);
+    }
+  }
+
+  // original bytes, compressed bytes per field
+  std::vector<double> bytes(num_fields * 2, 0.0);
+  std::vector<double> max_errors(num_fields, 0.0);
+
+  for(int d = 0; d < num_domains; ++d)
+  {
+    const Node &dom = view.child(d);
+    Node &dom_out = named_domains ? output[dom.name()] : output.append();
+    const int num_children = dom.number_of_children();
+    for(int c = 0; c < num_children; ++c)
+    {
+      const Node &child = dom.child(c);
+      if(child.name() != "fields")
+      {
+        dom_out[child.name()].set_external(child);
+        continue;
+      }
+
+      const int num_dom_fields = child.number_of_children();
+      for(int f = 0; f < num_dom_fields; ++f)
+      {
+        const Node &field = child.child(f);
+        const std::string fname = field.name();
+        if(!options.has_child(fname) || !field.has_child("values"))
+        {
+          dom_out["fields"][fname].set_external(field);
+          continue;
+        }
+
+        index_t idx = 0;
+        while(options.child(idx).name() != fname)
+        {
+          idx++;
+        }
+        detail::compress_field(field,
+                               error_bounds[idx],
+                               dom_out["compressed_fields"][fname],
+                               bytes[idx * 2],
+                               bytes[idx * 2 + 1],
+                               max_errors[idx]);
+      }
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  if(num_fields > 0)
+  {
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    std::vector<double> global_bytes(bytes.size(), 0.0);
+    std::vector<double> global_errors(max_errors.size(), 0.0);
+    MPI_Allreduce(bytes.data(),
+                  global_bytes.data(),
+                  static_cast<int>(bytes.size()),
+                  MPI_DOUBLE,
+                  MPI_SUM,
+                  mpi_comm);
+    MPI_Allreduce(max_errors.data(),
+                  global_errors.data(),
+                  static_cast<int>(max_errors.size()),
+                  MPI_DOUBLE,
+                  MPI_MAX,
+                  mpi_comm);
+    bytes.swap(global_bytes);
+    max_errors.swap(global_errors);
+  }
+#endif
+
+  for(int i = 0; i < num_fields; ++i)
+  {
+    const double original_bytes = bytes[i * 2];
+    const double compressed_bytes = bytes[i * 2 + 1];
+    if(original_bytes == 0.0)
+    {
+      // not found on any rank
+      continue;
+    }
+    Node &n_stats = stats[options.child(i).name()];
+    n_stats["original_bytes"] = static_cast<int64>(original_bytes);
+    n_stats["compressed_bytes"] = static_cast<int64>(compressed_bytes);
+    n_stats["ratio"] = compressed_bytes > 0.0 ?
+                       original_bytes / compressed_bytes : 0.0;
+    n_stats["max_error"] = max_errors[i];
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+decompress_fields(Node &mesh)
+{
+  const bool single_domain = mesh.has_child("coordsets");
+  const int num_domains = single_domain ? 1 : mesh.number_of_children();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    Node &dom = single_domain ? mesh : mesh.child(d);
+    if(!dom.has_child("compressed_fields"))
+    {
+      continue;
+    }
+
+    Node &compressed = dom["compressed_fields"];
+    const int num_fields = compressed.number_of_children();
+    for(int f = 0; f < num_fields; ++f)
+    {
+      Node &field = dom["fields"][compressed.child(f).name()];
+      field.reset();
+      detail::decompress_field(compressed.child(f), field);
+    }
+    dom.remove_child("compressed_fields");
+  }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
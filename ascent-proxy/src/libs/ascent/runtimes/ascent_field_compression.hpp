@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_field_compression.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_FIELD_COMPRESSION_HPP
+#define ASCENT_FIELD_COMPRESSION_HPP
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+// Error-bounded lossy compression of floating point fields.
+//
+// Each value is predicted from the previous reconstructed value and the
+// difference is quantized to a multiple of twice the error bound, so every
+// reconstructed value is within the bound. Values that can't be predicted
+// within the bound (or aren't finite) are kept exactly, in the type of the
+// field. The quantization codes are packed in blocks of 64, each with the
+// bit width of its largest code, so runs of well predicted values cost a
+// byte per block.
+//
+// Compressed fields move from "fields/<name>" to "compressed_fields/<name>"
+// of their domain. They keep their association and topology, and each
+// component of "values" becomes a tree with "method", "dtype",
+// "num_values", "error_bound", "codes", and "unpredictable".
+//
+// The options, per field name, hold either "abs_error" (an absolute bound)
+// or "rel_error" (relative to the value range of the field over all
+// domains and ranks):
+//
+//   compression:
+//     e:
+//       rel_error: 0.0001
+//     velocity:
+//       abs_error: 0.001
+
+// checks the "compression" entry of extract params
+bool ASCENT_API verify_compression_params(const conduit::Node &params,
+                                          conduit::Node &info);
+
+// compresses the values of a float32 or float64 leaf
+void ASCENT_API compress_values(const conduit::Node &values,
+                                const double error_bound,
+                                conduit::Node &compressed);
+
+// restores the values of a compressed leaf
+void ASCENT_API decompress_values(const conduit::Node &compressed,
+                                  conduit::Node &values);
+
+// output gets mesh (a multi domain mesh) with the fields in options
+// compressed, everything else is zero copied. stats gets
+// "<field>/ratio", "<field>/max_error", "<field>/original_bytes",
+// and "<field>/compressed_bytes", reduced over all ranks
+void ASCENT_API compress_fields(const conduit::Node &mesh,
+                                const conduit::Node &options,
+                                conduit::Node &output,
+                                conduit::Node &stats);
+
+// moves the compressed fields of mesh (single or multi domain) back
+// to "fields"
+void ASCENT_API decompress_fields(conduit::Node &mesh);
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
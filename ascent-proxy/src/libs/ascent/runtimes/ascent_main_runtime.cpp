@@ -17,6 +17,7 @@
 // standard lib includes
 #include <string.h>
 #include <algorithm>
+#include <set>
 
 //-----------------------------------------------------------------------------
 // thirdparty includes
@@ -36,6 +37,7 @@
 
 #include <flow.hpp>
 #include <utils/ascent_string_utils.hpp>
+#include <utils/ascent_hash_utils.hpp>
 #include <ascent_actions_utils.hpp>
 #include <ascent_metadata.hpp>
 #include <ascent_runtime_filters.hpp>
@@ -92,6 +94,10 @@ class InfoHandler
 
 int InfoHandler::m_rank = 0;
 
+// true on the background threads of asynchronous runtimes, which don't
+// hold the python GIL. Trigger runtimes they execute see it too.
+static thread_local bool t_async_thread = false;
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //
@@ -107,7 +113,18 @@ AscentRuntime::AscentRuntime()
  m_rank(0),
  m_default_output_dir("."),
  m_session_name("ascent_session"),
- m_field_filtering(false)
+ m_field_filtering(false),
+ m_lazy_info(false),
+ m_info_pending(false),
+ m_published_structure(false),
+ m_published_fingerprint(0),
+ m_async(false),
+ m_async_queue_depth(1),
+ m_async_comm(-1),
+ m_async_published(NULL),
+ m_async_filter_fields(false),
+ m_async_running(false),
+ m_async_stop(false)
 {
     m_ghost_fields.append() = "ascent_ghosts";
     flow::filters::register_builtin();
@@ -148,15 +165,40 @@ AscentRuntime::Initialize(const conduit::Node &options)
         ASCENT_ERROR("Missing Ascent::Open options missing MPI communicator (mpi_comm)");
     }
 
-    flow::Workspace::set_default_mpi_comm(options["mpi_comm"].to_int());
+    int comm_id = options["mpi_comm"].to_int();
+
+    if(options.has_path("async/enabled") &&
+       options["async/enabled"].as_string() == "true")
+    {
+      // the background thread issues collectives while the simulation
+      // keeps using its own communicator, so both need full thread
+      // support and the background work gets a private communicator
+      int provided = MPI_THREAD_SINGLE;
+      MPI_Query_thread(&provided);
+      if(provided < MPI_THREAD_MULTIPLE)
+      {
+        ASCENT_INFO("'async' requires MPI to be initialized with "
+                    "MPI_THREAD_MULTIPLE. Ascent will execute synchronously.");
+      }
+      else
+      {
+        MPI_Comm async_comm;
+        MPI_Comm_dup(MPI_Comm_f2c(comm_id), &async_comm);
+        comm_id = MPI_Comm_c2f(async_comm);
+        m_async_comm = comm_id;
+        m_async = true;
+      }
+    }
+
+    flow::Workspace::set_default_mpi_comm(comm_id);
 #if defined(ASCENT_VTKM_ENABLED)
     vtkh::Initialize();
-    vtkh::SetMPICommHandle(options["mpi_comm"].to_int());
+    vtkh::SetMPICommHandle(comm_id);
 #endif
 #if defined(ASCENT_DRAY_ENABLED)
-    dray::dray::mpi_comm(options["mpi_comm"].to_int());
+    dray::dray::mpi_comm(comm_id);
 #endif
-    MPI_Comm comm = MPI_Comm_f2c(options["mpi_comm"].to_int());
+    MPI_Comm comm = MPI_Comm_f2c(comm_id);
     MPI_Comm_rank(comm,&m_rank);
     InfoHandler::m_rank = m_rank;
     DataLogger::instance()->rank(m_rank);
@@ -175,6 +217,11 @@ AscentRuntime::Initialize(const conduit::Node &options)
     vtkh::Initialize();
 #endif
 
+    if(options.has_path("async/enabled") &&
+       options["async/enabled"].as_string() == "true")
+    {
+      m_async = true;
+    }
 #endif //end non-mpi
 
     // set a info handler so we only display messages on rank 0;
@@ -355,6 +402,12 @@ AscentRuntime::Initialize(const conduit::Node &options)
       m_session_name = options["session_name"].as_string();
     }
 
+    if(options.has_path("expression_history_length"))
+    {
+      runtime::expressions::ExpressionEval::history_length(
+        options["expression_history_length"].to_int32());
+    }
+
     runtime::expressions::ExpressionEval::load_cache(m_default_output_dir,
                                                      m_session_name);
 
@@ -375,6 +428,16 @@ AscentRuntime::Initialize(const conduit::Node &options)
 #endif
     }
 
+    if(options.has_path("threads"))
+    {
+      int num_threads = options["threads"].to_int32();
+      if(num_threads < 1)
+      {
+        ASCENT_ERROR("'threads' must be greater than 0");
+      }
+      m_workspace.set_num_threads(num_threads);
+    }
+
     if(options.has_path("field_filtering"))
     {
       if(options["field_filtering"].as_string() == "true")
@@ -383,6 +446,46 @@ AscentRuntime::Initialize(const conduit::Node &options)
       }
     }
 
+    if(options.has_path("lazy_info"))
+    {
+      if(options["lazy_info"].as_string() == "true")
+      {
+        m_lazy_info = true;
+      }
+    }
+
+    if(options.has_path("async/queue_depth"))
+    {
+      m_async_queue_depth = options["async/queue_depth"].to_int32();
+      if(m_async_queue_depth < 1)
+      {
+        ASCENT_ERROR("'async/queue_depth' must be greater than 0");
+      }
+    }
+
+    if(m_async)
+    {
+      // the background thread changes m_ghost_fields when it verifies
+      // them, the snapshots only read this copy of the configured names
+      m_async_ghost_fields = m_ghost_fields;
+      m_async_thread = std::thread(&AscentRuntime::AsyncLoop, this);
+    }
+
+    if(options.has_path("state/restore") &&
+       options["state/restore"].as_string() == "true")
+    {
+      std::string state_file = StateFileName();
+      if(conduit::utils::is_file(state_file))
+      {
+        m_state.load(state_file, "conduit_bin");
+      }
+      else
+      {
+        ASCENT_INFO("state restore file '"<<state_file<<"' does not exist."
+                    <<" Starting with an empty state.");
+      }
+    }
+
     Node msg;
     ascent::about(msg["about"]);
     msg["options"] = options;
@@ -396,6 +499,12 @@ AscentRuntime::Initialize(const conduit::Node &options)
 void
 AscentRuntime::Info(conduit::Node &out)
 {
+    // info describes the last execute, so let queued ones finish
+    AsyncDrain();
+    if(m_info_pending)
+    {
+      AddDeferredInfo();
+    }
     out.set(m_info);
 }
 
@@ -403,6 +512,11 @@ AscentRuntime::Info(conduit::Node &out)
 conduit::Node &
 AscentRuntime::Info()
 {
+    AsyncDrain();
+    if(m_info_pending)
+    {
+      AddDeferredInfo();
+    }
     return m_info;
 }
 
@@ -421,8 +535,28 @@ AscentRuntime::ResetInfo()
     m_info["runtime/version"]  = m_about["version"];
     m_info["runtime/git_sha1"] = m_about["git_sha1"];
     m_info["runtime/git_tag"]  = m_about["git_tag"];
+    m_info_pending = false;
+    if(!m_lazy_info)
+    {
+      m_info["runtime/options"]  = m_runtime_options;
+      m_info["registered_filter_types"] = registered_filter_types();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::AddDeferredInfo()
+{
+    // the graph outlives execute, so it can be described after the fact.
+    // (the registry has been reset by then, so flow_graph/registry
+    //  does not list the per cycle entries)
     m_info["runtime/options"]  = m_runtime_options;
     m_info["registered_filter_types"] = registered_filter_types();
+    m_workspace.info(m_info["flow_graph"]);
+    m_info["actions"] = m_previous_actions;
+    m_info["flow_graph_dot"]      = m_workspace.graph().to_dot();
+    m_info["flow_graph_dot_html"] = m_workspace.graph().to_dot_html();
+    m_info_pending = false;
 }
 
 
@@ -493,6 +627,42 @@ AscentRuntime::AddPublishedMeshInfo()
 void
 AscentRuntime::Cleanup()
 {
+    if(m_async_thread.joinable())
+    {
+        // finish everything that was queued before shutting down
+        {
+          std::lock_guard<std::mutex> lock(m_async_mutex);
+          m_async_stop = true;
+        }
+        m_async_cond.notify_all();
+        m_async_thread.join();
+        m_async_data.reset();
+
+        if(m_async_error != "")
+        {
+          std::cerr<<"[Error] Ascent asynchronous execute failed: "
+                   <<m_async_error<<"\n";
+          m_async_error = "";
+        }
+#ifdef ASCENT_MPI_ENABLED
+        if(m_async_comm != -1)
+        {
+          MPI_Comm async_comm = MPI_Comm_f2c(m_async_comm);
+          MPI_Comm_free(&async_comm);
+          m_async_comm = -1;
+        }
+#endif
+    }
+
+    // write what async relay extracts still have queued
+    m_relay_writer.reset();
+
+    // triggers' child runtimes share our communicator
+    m_trigger_cache.reset();
+#if defined(ASCENT_VTKM_ENABLED)
+    m_vtkm_cache.reset();
+#endif
+
     if(m_runtime_options.has_child("timings") &&
        m_runtime_options["timings"].as_string() == "true")
     {
@@ -511,14 +681,77 @@ AscentRuntime::Cleanup()
         ftimings << m_workspace.timing_info();
         ftimings.close();
     }
+
+    if(m_runtime_options.has_path("state/checkpoint") &&
+       m_runtime_options["state/checkpoint"].as_string() == "true")
+    {
+        m_state.save(StateFileName(), "conduit_bin");
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::string
+AscentRuntime::StateFileName() const
+{
+    std::string prefix = "ascent_state";
+    if(m_runtime_options.has_path("state/path"))
+    {
+      prefix = m_runtime_options["state/path"].as_string();
+    }
+
+    std::stringstream fname;
+    fname << prefix;
+#ifdef ASCENT_MPI_ENABLED
+    fname << "_" << m_rank;
+#endif
+    fname << ".conduit_bin";
+
+    // relative names go into the default output dir
+    std::string file, base_path;
+    conduit::utils::rsplit_file_path(fname.str(), file, base_path);
+    if(base_path == "")
+    {
+      return conduit::utils::join_file_path(m_default_output_dir, file);
+    }
+    return fname.str();
 }
 
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::Publish(const conduit::Node &data)
 {
+    if(m_async)
+    {
+      // like the synchronous path, the published data must stay valid
+      // until execute, which is where the snapshot is taken since
+      // the actions decide which fields are needed
+      AsyncCheckError();
+      m_async_published = &data;
+      return;
+    }
+
+    PublishData(data);
+}
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::PublishData(const conduit::Node &data)
+{
     blueprint::mesh::to_multi_domain(data, m_source);
+
+    // the steps below only depend on the structure of the mesh, which
+    // simulations with static meshes publish unchanged every cycle
+    if(SameStructure(StructureFingerprint(m_published_ghost_fields)))
+    {
+      ReusePublishedStructure();
+      return;
+    }
+
+    m_published_structure = false;
+    m_published_ghost_fields = m_ghost_fields;
+    const conduit::uint64 fingerprint =
+      StructureFingerprint(m_published_ghost_fields);
+
     EnsureDomainIds();
     // filter out default ghost name and
     // check if user provided ghost names are actually there
@@ -527,6 +760,118 @@ AscentRuntime::Publish(const conduit::Node &data)
     // for zones masked by finer levels. If no ghosts are present
     // we create them
     PaintNestsets();
+
+    m_published_fingerprint = fingerprint;
+    m_published_structure = true;
+}
+
+//-----------------------------------------------------------------------------
+conduit::uint64
+AscentRuntime::StructureFingerprint(const conduit::Node &ghost_fields) const
+{
+    std::set<std::string> ghosts;
+    conduit::uint64 hash = hash_seed;
+    const int num_ghosts = ghost_fields.number_of_children();
+    for(int i = 0; i < num_ghosts; ++i)
+    {
+      ghosts.insert(ghost_fields.child(i).as_string());
+      hash_string(ghost_fields.child(i).as_string(), hash);
+    }
+
+    // coordsets, topologies, and nestsets are compared by address
+    // (small values like dims by value), other fields only by layout
+    // since their values are expected to change. Ghosts are compared by
+    // value: simulations may update them in place, and nestsets paint a
+    // copy of them that would go stale. Cycle and time change every
+    // publish.
+    const int num_domains = m_source.number_of_children();
+    hash_bytes(&num_domains, sizeof(num_domains), hash);
+    for(int d = 0; d < num_domains; ++d)
+    {
+      const conduit::Node &dom = m_source.child(d);
+      const int num_children = dom.number_of_children();
+      for(int c = 0; c < num_children; ++c)
+      {
+        const conduit::Node &child = dom.child(c);
+        const std::string &name = child.name();
+        hash_string(name, hash);
+        if(name == "fields")
+        {
+          for(int f = 0; f < child.number_of_children(); ++f)
+          {
+            const conduit::Node &field = child.child(f);
+            hash_string(field.name(), hash);
+            hash_structure(field, false, hash);
+            if(ghosts.count(field.name()) > 0)
+            {
+              hash_contents(field, hash);
+            }
+          }
+        }
+        else if(name == "state")
+        {
+          for(int s = 0; s < child.number_of_children(); ++s)
+          {
+            const conduit::Node &state = child.child(s);
+            hash_string(state.name(), hash);
+            hash_structure(state, false, hash);
+            if(state.name() == "domain_id")
+            {
+              const conduit::int64 domain_id = state.to_int64();
+              hash_bytes(&domain_id, sizeof(domain_id), hash);
+            }
+          }
+        }
+        else
+        {
+          hash_structure(child, true, hash);
+        }
+      }
+    }
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+bool
+AscentRuntime::SameStructure(const conduit::uint64 fingerprint)
+{
+    int same = m_published_structure &&
+               fingerprint == m_published_fingerprint ? 1 : 0;
+#ifdef ASCENT_MPI_ENABLED
+    // the full path is collective, so one change anywhere
+    // sends every rank down it
+    int all_same = 0;
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    MPI_Allreduce(&same, &all_same, 1, MPI_INT, MPI_MIN, mpi_comm);
+    same = all_same;
+#endif
+    return same == 1;
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ReusePublishedStructure()
+{
+    // m_ghost_fields is already verified
+    const int num_domains = m_source.number_of_children();
+    for(int i = 0; i < num_domains; ++i)
+    {
+      conduit::Node &dom = m_source.child(i);
+      if(m_assigned_domain_ids[i] != -1)
+      {
+        dom["state/domain_id"] = m_assigned_domain_ids[i];
+      }
+
+      if(i < m_nestset_ghosts.number_of_children())
+      {
+        conduit::Node &painted = m_nestset_ghosts.child(i);
+        for(int g = 0; g < painted.number_of_children(); ++g)
+        {
+          conduit::Node &ghost_field = painted.child(g);
+          dom["fields/" + ghost_field.name()].set_external(ghost_field);
+        }
+      }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -632,6 +977,7 @@ AscentRuntime::EnsureDomainIds()
 #endif
 
     std::unordered_set<int> local_unique_ids;
+    m_assigned_domain_ids.assign(num_domains, -1);
     for(int i = 0; i < num_domains; ++i)
     {
       conduit::Node &dom = m_source.child(i);
@@ -639,6 +985,7 @@ AscentRuntime::EnsureDomainIds()
       if(!dom.has_path("state/domain_id"))
       {
         dom["state/domain_id"] = domain_offset + i;
+        m_assigned_domain_ids[i] = domain_offset + i;
         local_unique_ids.insert(domain_offset + i);
       }
       else
@@ -993,6 +1340,14 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
 
   std::string extract_type = extract["type"].as_string();
 
+  if(t_async_thread &&
+     (extract_type == "python" || extract_type == "jupyter"))
+  {
+    ASCENT_ERROR("'"<<extract_type<<"' extracts can't be used in "
+                 "asynchronous mode, they would run python on the "
+                 "background thread without holding the GIL");
+  }
+
   // current special case filter setup
   if(extract_type == "python")
   {
@@ -1002,6 +1357,7 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
     params["interface/module"] = "ascent_extract";
     params["interface/input"]  = "ascent_data";
     params["interface/set_output"] = "ascent_set_output";
+    params["interface/state"] = "ascent_state";
 
 #ifdef ASCENT_MPI_ENABLED
     // for MPI case, inspect args, if script is passed via file,
@@ -1013,9 +1369,31 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
      {
        std::string script_fname = params["file"].as_string();
 
+       // the graph is rebuilt every time the actions change, only
+       // re-read and re-broadcast the script when the file changed
+       // (mtime has nanosecond resolution where the file system does,
+       // the size catches rewrites within a coarser mtime tick)
+       conduit::int64 script_stamp[2] = {-1, -1};
+       if(m_rank == 0)
+       {
+         script_stamp[0] = file_modified_time(script_fname);
+         script_stamp[1] = file_size(script_fname);
+       }
+       MPI_Bcast(script_stamp, 2, MPI_INT64_T, 0, comm);
+
+       Node &n_cached_script = m_python_scripts.add_child(script_fname);
+       bool use_cached = script_stamp[0] != -1 &&
+                         n_cached_script.has_child("mtime") &&
+                         n_cached_script["mtime"].to_int64() == script_stamp[0] &&
+                         n_cached_script["size"].to_int64() == script_stamp[1];
+
        Node n_py_src;
+       if(use_cached)
+       {
+         n_py_src.set(n_cached_script["source"].as_string());
+       }
        // read script only on rank 0
-       if(m_rank == 0)
+       else if(m_rank == 0)
        {
          ostringstream py_src;
          ifstream ifs(script_fname.c_str());
@@ -1036,7 +1414,10 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
          }
        }
 
-       relay::mpi::broadcast_using_schema(n_py_src,0,comm);
+       if(!use_cached)
+       {
+         relay::mpi::broadcast_using_schema(n_py_src,0,comm);
+       }
 
        if(!n_py_src.dtype().is_string())
        {
@@ -1045,6 +1426,13 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
                       << " and broadcast source");
        }
 
+       if(!use_cached)
+       {
+         n_cached_script["mtime"] = script_stamp[0];
+         n_cached_script["size"] = script_stamp[1];
+         n_cached_script["source"] = n_py_src;
+       }
+
        // replace file param with source that includes actual script
        params.remove("file");
        params["source"] = n_py_src;
@@ -1074,6 +1462,7 @@ AscentRuntime::ConvertExtractToFlow(const conduit::Node &extract,
     params["interface/module"] = "ascent_extract";
     params["interface/input"]  = "ascent_data";
     params["interface/set_output"] = "ascent_set_output";
+    params["interface/state"] = "ascent_state";
 
      ostringstream py_src_final;
 #ifdef ASCENT_MPI_ENABLED
@@ -1162,7 +1551,26 @@ AscentRuntime::ConvertTriggerToFlow(const conduit::Node &trigger,
     pipeline = trigger["pipeline"].as_string();
   }
 
-  m_workspace.graph().add_filter("basic_trigger",
+  std::string trigger_type = "basic";
+  if(trigger.has_path("type"))
+  {
+    trigger_type = trigger["type"].as_string();
+  }
+
+  if(trigger_type == "basic")
+  {
+    filter_name = "basic_trigger";
+  }
+  else if(trigger_type == "surrogate")
+  {
+    filter_name = "surrogate_trigger";
+  }
+  else
+  {
+    ASCENT_ERROR("Unrecognized trigger type " << trigger_type);
+  }
+
+  m_workspace.graph().add_filter(filter_name,
                                  trigger_name,
                                  params);
 
@@ -1384,10 +1792,11 @@ AscentRuntime::CreateTriggers(const conduit::Node &triggers)
 
 //-----------------------------------------------------------------------------
 void
-AscentRuntime::CreateQueries(const conduit::Node &queries)
+AscentRuntime::CreateQueries(const conduit::Node &queries,
+                             const std::string &first_prev_name)
 {
   std::vector<std::string> names = queries.child_names();
-  std::string prev_name = "";
+  std::string prev_name = first_prev_name;
   for(int i = 0; i < queries.number_of_children(); ++i)
   {
     conduit::Node query = queries.child(i);
@@ -1396,6 +1805,73 @@ AscentRuntime::CreateQueries(const conduit::Node &queries)
   }
 }
 
+//-----------------------------------------------------------------------------
+// Queries on the default pipeline that reduce whole fields (max, min, sum,
+// avg) are served by one batch filter that runs ahead of the query chain,
+// so the fields are traversed once and reduced with two collectives
+// instead of several per query. The reductions are found in the parsed
+// expressions, and only the queries listed with the batch read from it.
+// Returns the batch filter name, or "" when there is nothing worth
+// batching.
+std::string
+AscentRuntime::CreateQueryBatch(const conduit::Node &queries)
+{
+  // queries on high order data each see their own low order
+  // conversion, so they would never match the batched dataset
+  if(m_data_object.source() != DataObject::Source::LOW_BP)
+  {
+    return "";
+  }
+
+  int num_reductions = 0;
+  std::vector<std::string> fields;
+  conduit::Node params;
+  for(int a = 0; a < queries.number_of_children(); ++a)
+  {
+    const conduit::Node &action_queries = queries.child(a);
+    for(int q = 0; q < action_queries.number_of_children(); ++q)
+    {
+      const conduit::Node &query = action_queries.child(q);
+      if(query.has_path("pipeline") ||
+         !query.has_path("params/expression") ||
+         !query["params/expression"].dtype().is_string())
+      {
+        continue;
+      }
+      const std::vector<std::string> reduced =
+        runtime::expressions::ExpressionEval::reduced_fields(
+          query["params/expression"].as_string());
+      if(reduced.empty())
+      {
+        continue;
+      }
+      num_reductions += reduced.size();
+      params["queries"].append() = query.name();
+      for(const std::string &field : reduced)
+      {
+        if(std::find(fields.begin(), fields.end(), field) == fields.end())
+        {
+          fields.push_back(field);
+        }
+      }
+    }
+  }
+
+  if(num_reductions < 2)
+  {
+    return "";
+  }
+
+  const std::string batch_name = "ascent_query_batch";
+  for(const std::string &field : fields)
+  {
+    params["fields"].append() = field;
+  }
+  m_workspace.graph().add_filter("query_batch", batch_name, params);
+  m_connections[batch_name] = CreateDefaultFilters()["queries"].as_string();
+  return batch_name;
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::CreateCommands(const conduit::Node &commands)
@@ -1480,6 +1956,9 @@ AscentRuntime::ConnectSource()
     conduit::Node *data_node = new conduit::Node();
     data_node->set_external(m_source);
     m_data_object.reset(data_node);
+#if defined(ASCENT_VTKM_ENABLED)
+    m_data_object.vtkh_conversion_cache(&m_vtkm_cache);
+#endif
 
     SourceFieldFilter();
 
@@ -2046,9 +2525,10 @@ AscentRuntime::BuildGraph(const conduit::Node &actions)
   {
     CreateCommands(commands.child(i));
   }
+  const std::string query_batch = CreateQueryBatch(queries);
   for(int i = 0; i < queries.number_of_children(); ++i)
   {
-    CreateQueries(queries.child(i));
+    CreateQueries(queries.child(i), query_batch);
   }
   for(int i = 0; i < triggers.number_of_children(); ++i)
   {
@@ -2068,6 +2548,206 @@ AscentRuntime::BuildGraph(const conduit::Node &actions)
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::Execute(const conduit::Node &actions)
+{
+    if(!m_async)
+    {
+      ExecuteActions(actions);
+      return;
+    }
+
+    AsyncCheckError();
+
+    AsyncJob job;
+    job.actions = actions;
+    if(m_async_published != NULL)
+    {
+      job.data = std::make_shared<conduit::Node>();
+      AsyncSnapshot(actions, *job.data);
+      m_async_published = NULL;
+    }
+
+    // back-pressure: block while the queue is full
+    {
+      std::unique_lock<std::mutex> lock(m_async_mutex);
+      m_async_cond.wait(lock, [this]
+      {
+        const int in_flight = static_cast<int>(m_async_queue.size()) +
+                              (m_async_running ? 1 : 0);
+        return in_flight < m_async_queue_depth;
+      });
+      m_async_queue.push_back(job);
+    }
+    m_async_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::Wait()
+{
+    AsyncDrain();
+    AsyncCheckError();
+    m_relay_writer.flush();
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::AsyncDrain()
+{
+    if(!m_async)
+    {
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_async_mutex);
+    m_async_cond.wait(lock, [this]
+    {
+      return m_async_queue.empty() && !m_async_running;
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::AsyncCheckError()
+{
+    std::string msg;
+    {
+      std::lock_guard<std::mutex> lock(m_async_mutex);
+      msg = m_async_error;
+      m_async_error = "";
+    }
+
+    if(msg != "")
+    {
+      ASCENT_ERROR("Asynchronous execute failed: "<<msg);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::AsyncSnapshot(const conduit::Node &actions,
+                             conduit::Node &snapshot)
+{
+    // only look for fields again if the actions changed
+    conduit::Node diff_info;
+    if(m_async_actions.diff(actions, diff_info))
+    {
+      m_async_fields.clear();
+      conduit::Node info;
+      m_async_filter_fields = field_list(actions, m_async_fields, info) &&
+                              m_async_fields.size() > 0;
+      if(m_async_filter_fields)
+      {
+        const int num_ghosts = m_async_ghost_fields.number_of_children();
+        for(int i = 0; i < num_ghosts; ++i)
+        {
+          m_async_fields.insert(m_async_ghost_fields.child(i).as_string());
+        }
+      }
+      m_async_actions = actions;
+    }
+
+    // zero copy multi domain view of what was published
+    conduit::Node view;
+    blueprint::mesh::to_multi_domain(*m_async_published, view);
+
+    const int num_domains = view.number_of_children();
+    for(int d = 0; d < num_domains; ++d)
+    {
+      const conduit::Node &src = view.child(d);
+      conduit::Node &dest = snapshot.append();
+      const int num_children = src.number_of_children();
+      for(int c = 0; c < num_children; ++c)
+      {
+        const std::string name = src.child(c).name();
+        if(name != "fields" || !m_async_filter_fields)
+        {
+          dest[name].set(src.child(c));
+          continue;
+        }
+
+        const conduit::Node &fields = src.child(c);
+        const int num_fields = fields.number_of_children();
+        for(int f = 0; f < num_fields; ++f)
+        {
+          const std::string fname = fields.child(f).name();
+          // special mfem fields are kept, see SourceFieldFilter
+          if(m_async_fields.find(fname) != m_async_fields.end() ||
+             fname.find("position") != std::string::npos ||
+             fname.find("_nodes") != std::string::npos ||
+             fname.find("_attribute") != std::string::npos ||
+             fname.find("boundary") != std::string::npos)
+          {
+            dest["fields"][fname].set(fields.child(f));
+          }
+        }
+      }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::AsyncLoop()
+{
+    t_async_thread = true;
+    while(true)
+    {
+      AsyncJob job;
+      {
+        std::unique_lock<std::mutex> lock(m_async_mutex);
+        m_async_cond.wait(lock, [this]
+        {
+          return m_async_stop || !m_async_queue.empty();
+        });
+        if(m_async_queue.empty())
+        {
+          return;
+        }
+        job = m_async_queue.front();
+        m_async_queue.pop_front();
+        m_async_running = true;
+      }
+
+      std::string error;
+      try
+      {
+        if(job.data)
+        {
+          // keep the snapshot alive, m_source refers to it
+          // until the next publish
+          m_async_data = job.data;
+          PublishData(*m_async_data);
+        }
+        ExecuteActions(job.actions);
+      }
+      catch(conduit::Error &e)
+      {
+        error = e.message();
+      }
+      catch(std::exception &e)
+      {
+        error = e.what();
+      }
+      catch(...)
+      {
+        error = "unknown exception thrown";
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_async_mutex);
+        m_async_running = false;
+        // keep the first error until the caller sees it
+        if(error != "" && m_async_error == "")
+        {
+          m_async_error = error;
+        }
+      }
+      m_async_cond.notify_all();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ExecuteActions(const conduit::Node &actions)
 {
     bool log_timings = false;
     if(m_runtime_options.has_child("timings") &&
@@ -2136,9 +2816,20 @@ AscentRuntime::Execute(const conduit::Node &actions)
         // add the source to the registry so we can access information
         // about the original mesh (like bounds)
         m_workspace.registry().add<DataObject>("source_object", &m_data_object,1);
-
-        m_workspace.info(m_info["flow_graph"]);
-        m_info["actions"] = actions;
+        // persistent extract state, never released by the registry
+        m_workspace.registry().add<conduit::Node>("_ascent_state", &m_state,-1);
+        m_workspace.registry().add<runtime::filters::TriggerCache>("_ascent_triggers",
+                                                                   &m_trigger_cache,
+                                                                   -1);
+        m_workspace.registry().add<runtime::filters::RelayIOWriter>("_ascent_relay_writer",
+                                                                    &m_relay_writer,
+                                                                    -1);
+
+        if(!m_lazy_info)
+        {
+          m_workspace.info(m_info["flow_graph"]);
+          m_info["actions"] = actions;
+        }
         // m_workspace.graph().save_dot_html("ascent_flow_graph.html");
 
 #if defined(ASCENT_VTKM_ENABLED)
@@ -2191,30 +2882,49 @@ AscentRuntime::Execute(const conduit::Node &actions)
         }
 
         // add expression results to info
-        const conduit::Node &expression_cache =
-          runtime::expressions::ExpressionEval::get_cache();
+        Node last_expressions;
+        runtime::expressions::ExpressionEval::get_last(last_expressions);
+        if(last_expressions.number_of_children() > 0)
+        {
+          m_info["expressions"].move(last_expressions);
+        }
 
-        if(expression_cache.number_of_children() > 0)
+        if(!m_lazy_info)
         {
-          runtime::expressions::ExpressionEval::get_last(m_info["expressions"]);
+          // add flow graphviz details to info
+          m_info["flow_graph_dot"]      = m_workspace.graph().to_dot();
+          m_info["flow_graph_dot_html"] = m_workspace.graph().to_dot_html();
+        }
+        else
+        {
+          // built by Info(), or below if something consumes it now
+          m_info_pending = true;
         }
 
-        // add flow graphviz details to info
-        m_info["flow_graph_dot"]      = m_workspace.graph().to_dot();
-        m_info["flow_graph_dot_html"] = m_workspace.graph().to_dot_html();
+        if(m_web_interface.Enabled())
+        {
+          if(m_info_pending)
+          {
+            AddDeferredInfo();
+          }
 
-        m_web_interface.PushRenders(render_file_names);
+          m_web_interface.PushRenders(render_file_names);
 
-        Node msg;
-        msg["info"].set_external(m_info);
-        ascent::about(msg["about"]);
-        m_web_interface.PushMessage(msg);
+          Node msg;
+          msg["info"].set_external(m_info);
+          ascent::about(msg["about"]);
+          m_web_interface.PushMessage(msg);
+        }
 
         m_workspace.registry().reset();
 
         SetStatus("Ascent::execute completed");
         if(m_save_info_actions.number_of_children() > 0)
         {
+          if(m_info_pending)
+          {
+            AddDeferredInfo();
+          }
           SaveInfo();
         }
 
@@ -2351,6 +3061,7 @@ void AscentRuntime::SourceFieldFilter()
 //-----------------------------------------------------------------------------
 void AscentRuntime::PaintNestsets()
 {
+  m_nestset_ghosts.reset();
   std::vector<std::string> ghosts;
   std::map<std::string,std::string> topo_ghosts;
   std::map<std::string,std::string> topo_nestsets;
@@ -2430,6 +3141,8 @@ void AscentRuntime::PaintNestsets()
   for(int i = 0; i < num_domains; ++i)
   {
     conduit::Node &dom = m_source.child(i);
+    // painted fields are kept so the next publish can reuse them
+    conduit::Node &painted = m_nestset_ghosts.append();
     const int num_topos = dom["topologies"].number_of_children();
     const std::vector<std::string> topo_names = dom["topologies"].child_names();
     for(auto topo_name : topo_names)
@@ -2456,17 +3169,12 @@ void AscentRuntime::PaintNestsets()
           // be bad practice to alter the data, so we will make a
           // copy and update our tree to point at the copy.
           const std::string ghost_path = "fields/" + ghost_name;
-          const std::string temp_path = "fields/" + ghost_name + "_bananas";
-
-          conduit::Node &field = dom["fields/" + ghost_name];
-          dom[temp_path].set(field);
-          dom.remove(ghost_path);
-          //dom.rename_child(temp_path, ghost_path);
-          dom["fields/"].rename_child(ghost_name+"_bananas", ghost_name);
 
-          conduit::Node &ghost_field = dom[ghost_path];
+          conduit::Node &ghost_field = painted.add_child(ghost_name);
+          ghost_field.set(dom[ghost_path]);
 
           runtime::expressions::paint_nestsets(nest_name, topo_name,  dom, ghost_field);
+          dom[ghost_path].set_external(ghost_field);
         }
         else
         {
@@ -2479,9 +3187,10 @@ void AscentRuntime::PaintNestsets()
       {
         // there are no ghosts, so we have to build a new field
         std::string ghost_name = topo_name + "_ghosts";
-        conduit::Node &field = dom["fields/" + ghost_name];
+        conduit::Node &field = painted.add_child(ghost_name);
         field.reset();
         runtime::expressions::paint_nestsets(nest_name, topo_name, dom, field);
+        dom["fields/" + ghost_name].set_external(field);
         new_ghosts.insert(ghost_name);
       }
     }
@@ -19,8 +19,18 @@
 #include <ascent_runtime.hpp>
 #include <ascent_data_object.hpp>
 #include <ascent_web_interface.hpp>
+#include <ascent_runtime_relay_filters.hpp>
+#include <ascent_runtime_trigger_filters.hpp>
+#if defined(ASCENT_VTKM_ENABLED)
+#include <ascent_vtkh_data_adapter.hpp>
+#endif
 #include <flow.hpp>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 
 //-----------------------------------------------------------------------------
@@ -42,6 +52,7 @@ public:
 
     void  Publish(const conduit::Node &data) override;
     void  Execute(const conduit::Node &actions) override;
+    void  Wait() override;
 
 
     void                 Info(conduit::Node &out) override;
@@ -88,8 +99,68 @@ private:
 
     conduit::Node     m_comments;
 
+    // persistent per-extract state, lives as long as the runtime
+    conduit::Node     m_state;
+    std::string       StateFileName() const;
+
+    // python extract sources read on rank 0, keyed by file name
+    // (holds "mtime", "size" and "source")
+    conduit::Node     m_python_scripts;
+
+    // child runtimes and actions files of triggers, kept between fires
+    runtime::filters::TriggerCache m_trigger_cache;
+    // background writes of async relay extracts
+    runtime::filters::RelayIOWriter m_relay_writer;
+
+#if defined(ASCENT_VTKM_ENABLED)
+    // vtk-m cell sets and coordinates of the published topologies,
+    // kept across cycles
+    VTKmConversionCache m_vtkm_cache;
+#endif
+
     void              ResetInfo();
     void              AddPublishedMeshInfo();
+    // graph, actions, and option details of info, which are only
+    // built on demand when lazy_info is enabled
+    void              AddDeferredInfo();
+    bool              m_lazy_info;
+    bool              m_info_pending;
+
+    // asynchronous mode: execute snapshots the published data and
+    // queues it, a background thread runs publish and execute
+    struct AsyncJob
+    {
+      std::shared_ptr<conduit::Node> data; // null if nothing was published
+      conduit::Node                  actions;
+    };
+    bool                    m_async;
+    int                     m_async_queue_depth;
+    int                     m_async_comm;
+    const conduit::Node    *m_async_published;
+    // configured ghost field names, m_ghost_fields belongs to the
+    // background thread
+    conduit::Node           m_async_ghost_fields;
+    // fields needed by m_async_actions (if they could be resolved)
+    conduit::Node           m_async_actions;
+    std::set<std::string>   m_async_fields;
+    bool                    m_async_filter_fields;
+    // snapshot m_source currently points into
+    std::shared_ptr<conduit::Node> m_async_data;
+    std::deque<AsyncJob>    m_async_queue;
+    bool                    m_async_running;
+    bool                    m_async_stop;
+    std::string             m_async_error;
+    std::mutex              m_async_mutex;
+    std::condition_variable m_async_cond;
+    std::thread             m_async_thread;
+
+    void              PublishData(const conduit::Node &data);
+    void              ExecuteActions(const conduit::Node &actions);
+    void              AsyncSnapshot(const conduit::Node &actions,
+                                    conduit::Node &snapshot);
+    void              AsyncLoop();
+    void              AsyncDrain();
+    void              AsyncCheckError();
 
     flow::Workspace   m_workspace;
     conduit::Node CreateDefaultFilters();
@@ -109,7 +180,9 @@ private:
     void CreatePipelines(const conduit::Node &pipelines);
     void CreateExtracts(const conduit::Node &extracts);
     void CreateTriggers(const conduit::Node &triggers);
-    void CreateQueries(const conduit::Node &queries);
+    void CreateQueries(const conduit::Node &queries,
+                       const std::string &first_prev_name = "");
+    std::string CreateQueryBatch(const conduit::Node &queries);
     void CreateCommands(const conduit::Node &commands);
     void CreatePlots(const conduit::Node &plots);
     std::vector<std::string> GetPipelines(const conduit::Node &plots);
@@ -121,6 +194,20 @@ private:
     void PaintNestsets();
     void VerifyGhosts();
 
+    // publishing the same mesh structure again reuses what the last full
+    // publish derived from it: domain ids, verified ghosts, nestset ghosts
+    bool              m_published_structure;
+    conduit::uint64   m_published_fingerprint;
+    // ghost names the fingerprint was taken with
+    conduit::Node     m_published_ghost_fields;
+    // per domain, the id EnsureDomainIds assigned or -1
+    std::vector<conduit::int64> m_assigned_domain_ids;
+    // per domain, the ghost fields PaintNestsets painted
+    conduit::Node     m_nestset_ghosts;
+    conduit::uint64 StructureFingerprint(const conduit::Node &ghost_fields) const;
+    bool SameStructure(const conduit::uint64 fingerprint);
+    void ReusePublishedStructure();
+
     void SaveSession();
     void SaveInfo();
 
@@ -36,7 +36,10 @@
 #include <vtkm/cont/Algorithm.h>
 #include <vtkm/cont/ArrayCopy.h>
 #include <vtkm/cont/ArrayHandle.h>
+#include <vtkm/cont/ArrayHandleCompositeVector.h>
+#include <vtkm/cont/ArrayHandleConstant.h>
 #include <vtkm/cont/ArrayHandleExtractComponent.h>
+#include <vtkm/cont/ArrayHandleStride.h>
 #include <vtkm/cont/CoordinateSystem.h>
 #include <vtkm/cont/Invoker.h>
 #include <vtkh/DataSet.hpp>
@@ -44,6 +47,7 @@
 // other ascent includes
 #include <ascent_logging.hpp>
 #include <ascent_block_timer.hpp>
+#include <ascent_hash_utils.hpp>
 #include <ascent_mpi_utils.hpp>
 #include <vtkh/utils/vtkm_array_utils.hpp>
 #include <vtkh/utils/vtkm_dataset_info.hpp>
@@ -132,6 +136,61 @@ void CopyArray(vtkm::cont::ArrayHandle<T> &vtkm_handle, const T* vals_ptr, const
   vtkm_handle = vtkm::cont::make_ArrayHandle(vals_ptr, size, copy);
 }
 
+//
+// a view of size values that are element_stride apart. The source array
+// only spans the values the stride reaches, not size * element_stride
+//
+template<typename T>
+vtkm::cont::ArrayHandleStride<T>
+StridedArray(const T* vals_ptr, const int size, const index_t element_stride, bool zero_copy)
+{
+  vtkm::CopyFlag copy = vtkm::CopyFlag::On;
+  if(zero_copy)
+  {
+    copy = vtkm::CopyFlag::Off;
+  }
+
+  const vtkm::Id extent = size > 0 ? (size - 1) * element_stride + 1 : 0;
+  vtkm::cont::ArrayHandle<T> source_array = vtkm::cont::make_ArrayHandle(vals_ptr,
+                                                                         extent,
+                                                                         copy);
+  return vtkm::cont::ArrayHandleStride<T>(source_array,
+                                          size,
+                                          element_stride,
+                                          0); // offset
+}
+
+//
+// true if x, y, and z are the components of one array of xyz tuples
+//
+bool InterleavedXYZ(const conduit::Node &n_values)
+{
+  if(!n_values.has_child("x") ||
+     !n_values.has_child("y") ||
+     !n_values.has_child("z"))
+  {
+    return false;
+  }
+
+  const conduit::Node &x = n_values["x"];
+  const conduit::Node &y = n_values["y"];
+  const conduit::Node &z = n_values["z"];
+  const index_t element_bytes = x.dtype().element_bytes();
+  const char *x_ptr = static_cast<const char*>(x.data_ptr()) + x.dtype().offset();
+  const char *y_ptr = static_cast<const char*>(y.data_ptr()) + y.dtype().offset();
+  const char *z_ptr = static_cast<const char*>(z.data_ptr()) + z.dtype().offset();
+
+  return y.dtype().id() == x.dtype().id() &&
+         z.dtype().id() == x.dtype().id() &&
+         x.dtype().stride() == 3 * element_bytes &&
+         y.dtype().stride() == 3 * element_bytes &&
+         z.dtype().stride() == 3 * element_bytes &&
+         y.dtype().number_of_elements() == x.dtype().number_of_elements() &&
+         z.dtype().number_of_elements() == x.dtype().number_of_elements() &&
+         y_ptr == x_ptr + element_bytes &&
+         z_ptr == x_ptr + 2 * element_bytes;
+}
+
 
 template<typename T>
 void
@@ -220,57 +279,59 @@ GetExplicitCoordinateSystem(const conduit::Node &n_coords,
     }
       
     int nverts = n_coords["values/x"].dtype().number_of_elements();
-    //bool is_interleaved = blueprint::mcarray::is_interleaved(n_coords["values"]);
-
-    // some interleaved cases aren't working
-    // disabling this path until we find out what is going wrong.
-    //is_interleaved = false;
-
-    vtkm::cont::ArrayHandle<T> x_coords_handle;
-    vtkm::cont::ArrayHandle<T> y_coords_handle;
-    vtkm::cont::ArrayHandle<T> z_coords_handle;
-
-    ndims = 2;
 
-    if(x_element_stride == 1)
+    // xyz tuples already have the layout of a vtkm::Vec array
+    if(z_element_stride == 3 && InterleavedXYZ(n_coords["values"]))
     {
-      const T *x_verts_ptr = n_coords["values/x"].value();
-      detail::CopyArray(x_coords_handle, x_verts_ptr, nverts, zero_copy);
+      ndims = 3;
+      using Vec3 = vtkm::Vec<T,3>;
+      const T *xyz_ptr = n_coords["values/x"].value();
+      return vtkm::cont::CoordinateSystem(name,
+                                          vtkm::cont::make_ArrayHandle(
+                                            reinterpret_cast<const Vec3*>(xyz_ptr),
+                                            nverts,
+                                            copy));
     }
-    else
+
+    // separate strided components (e.g. x, y, and z of different
+    // arrays of structs) are viewed in place, no copy
+    if(x_element_stride != 1 ||
+       y_element_stride != 1 ||
+       (z_element_stride != 0 && z_element_stride != 1))
     {
-      int x_verts_expanded = nverts * x_element_stride;
       const T *x_verts_ptr = n_coords["values/x"].value();
-      vtkm::cont::ArrayHandle<T> x_source_array = vtkm::cont::make_ArrayHandle<T>(x_verts_ptr,
-                                                                                  x_verts_expanded,
-                                                                                  copy);
-      vtkm::cont::ArrayHandleStride<T> x_stride_handle(x_source_array,
-                                                       nverts,
-                                                       x_element_stride,
-                                                       0); // offset
+      const T *y_verts_ptr = n_coords["values/y"].value();
+      auto x_handle = StridedArray(x_verts_ptr, nverts, x_element_stride, zero_copy);
+      auto y_handle = StridedArray(y_verts_ptr, nverts, y_element_stride, zero_copy);
+      if(z_element_stride == 0)
+      {
+        ndims = 2;
+        return vtkm::cont::CoordinateSystem(name,
+                 vtkm::cont::make_ArrayHandleCompositeVector(
+                   x_handle,
+                   y_handle,
+                   vtkm::cont::make_ArrayHandleConstant(T(0), nverts)));
+      }
 
-      vtkm::cont::Algorithm::Copy(x_stride_handle, x_coords_handle);
+      ndims = 3;
+      const T *z_verts_ptr = n_coords["values/z"].value();
+      auto z_handle = StridedArray(z_verts_ptr, nverts, z_element_stride, zero_copy);
+      return vtkm::cont::CoordinateSystem(name,
+               vtkm::cont::make_ArrayHandleCompositeVector(x_handle,
+                                                           y_handle,
+                                                           z_handle));
     }
 
-    if(y_element_stride == 1)
-    {
-      const T *y_verts_ptr = n_coords["values/y"].value();
-      detail::CopyArray(y_coords_handle, y_verts_ptr, nverts, zero_copy);
-    }
-    else
-    {
-      int y_verts_expanded = nverts * y_element_stride;
-      const T *y_verts_ptr = n_coords["values/y"].value();
-      vtkm::cont::ArrayHandle<T> y_source_array = vtkm::cont::make_ArrayHandle<T>(y_verts_ptr,
-                                                                                  y_verts_expanded,
-                                                                                  copy);
-      vtkm::cont::ArrayHandleStride<T> y_stride_handle(y_source_array,
-                                                       nverts,
-                                                       y_element_stride,
-                                                       0); // offset
+    vtkm::cont::ArrayHandle<T> x_coords_handle;
+    vtkm::cont::ArrayHandle<T> y_coords_handle;
+    vtkm::cont::ArrayHandle<T> z_coords_handle;
 
-      vtkm::cont::Algorithm::Copy(y_stride_handle, y_coords_handle);
-    }
+    ndims = 2;
+
+    const T *x_verts_ptr = n_coords["values/x"].value();
+    detail::CopyArray(x_coords_handle, x_verts_ptr, nverts, zero_copy);
+    const T *y_verts_ptr = n_coords["values/y"].value();
+    detail::CopyArray(y_coords_handle, y_verts_ptr, nverts, zero_copy);
 
     if(z_element_stride == 0)
     {
@@ -280,26 +341,11 @@ GetExplicitCoordinateSystem(const conduit::Node &n_coords,
       T *z = vtkh::GetVTKMPointer(z_coords_handle);
       memset(z, 0, nverts * sizeof(T));
     }
-    else if(z_element_stride == 1)
-    {
-      ndims = 3;
-      const T *z_verts_ptr = n_coords["values/z"].value();
-      detail::CopyArray(z_coords_handle, z_verts_ptr, nverts, zero_copy);
-    }
     else
     {
       ndims = 3;
-      int z_verts_expanded = nverts * z_element_stride;
       const T *z_verts_ptr = n_coords["values/z"].value();
-      vtkm::cont::ArrayHandle<T> z_source_array = vtkm::cont::make_ArrayHandle<T>(z_verts_ptr,
-                                                                                  z_verts_expanded,
-                                                                                  copy);
-      vtkm::cont::ArrayHandleStride<T> z_stride_handle(z_source_array,
-                                                       nverts,
-                                                       z_element_stride,
-                                                       0); // offset
-
-      vtkm::cont::Algorithm::Copy(z_stride_handle, z_coords_handle);
+      detail::CopyArray(z_coords_handle, z_verts_ptr, nverts, zero_copy);
     }
 
     return vtkm::cont::CoordinateSystem(name,
@@ -360,21 +406,12 @@ vtkm::cont::Field GetField(const conduit::Node &node,
       //
       // use ArrayHandleStride to create new field
       //
-
-      // NOTE: In this case, the num_vals, needs to be
-      // the full extent of the strided area3
-
-      int num_vals_expanded = num_vals * element_stride;
-      vtkm::cont::ArrayHandle<T> source_array = vtkm::cont::make_ArrayHandle(values_ptr,
-                                                                             num_vals_expanded,
-                                                                             copy);
-      vtkm::cont::ArrayHandleStride<T> stride_array(source_array,
-                                                    num_vals,
-                                                    element_stride,
-                                                    0);
       field =  vtkm::cont::Field(field_name,
                                  vtkm_assoc,
-                                 stride_array);
+                                 StridedArray(values_ptr,
+                                              num_vals,
+                                              element_stride,
+                                              zero_copy));
   }
 
   return field;
@@ -434,8 +471,6 @@ void ExtractVector(vtkm::cont::DataSet *dset,
                    const std::string &topo_name,
                    bool zero_copy)
 {
-  // TODO: Do we need to fix this for striding?
-  // GetField<T> expects compact
   if(dims != 2 && dims != 3)
   {
     ASCENT_ERROR("Extract vector: only 2 and 3 dims supported given "<<dims);
@@ -456,21 +491,25 @@ void ExtractVector(vtkm::cont::DataSet *dset,
                  <<assoc_str<<" field_name "<<field_name);
   }
 
-  if(dims == 2)
+  // components may be strided views into a larger array, so each one
+  // is read through a strided handle while interleaving
+  const index_t x_stride = u.dtype().stride() / sizeof(T);
+  const index_t y_stride = v.dtype().stride() / sizeof(T);
+  if(u.dtype().stride() % sizeof(T) != 0 ||
+     v.dtype().stride() % sizeof(T) != 0)
   {
-    const T *x_ptr = GetNodePointer<T>(u);
-    const T *y_ptr = GetNodePointer<T>(v);
-
-    vtkm::cont::ArrayHandle<T> x_handle;
-    vtkm::cont::ArrayHandle<T> y_handle;
-
-    // always zero copy because we are about to make a copy
-    detail::CopyArray(x_handle, x_ptr, num_vals, true);
-    detail::CopyArray(y_handle, y_ptr, num_vals, true);
+    ASCENT_ERROR("Extract vector: component stride is not a multiple of "
+                 "the component size for field "<<field_name);
+  }
 
+  // always zero copy because we are about to make a copy
+  auto x_handle = StridedArray(GetNodePointer<T>(u), num_vals, x_stride, true);
+  auto y_handle = StridedArray(GetNodePointer<T>(v), num_vals, y_stride, true);
 
-    auto composite  = make_ArrayHandleSOA(x_handle,
-                                          y_handle);
+  if(dims == 2)
+  {
+    auto composite  = vtkm::cont::make_ArrayHandleCompositeVector(x_handle,
+                                                                  y_handle);
 
     vtkm::cont::ArrayHandle<vtkm::Vec<T,2>> interleaved_handle;
     interleaved_handle.Allocate(num_vals);
@@ -486,22 +525,17 @@ void ExtractVector(vtkm::cont::DataSet *dset,
 
   if(dims == 3)
   {
-    const T *x_ptr = GetNodePointer<T>(u);
-    const T *y_ptr = GetNodePointer<T>(v);
-    const T *z_ptr = GetNodePointer<T>(w);
-
-    vtkm::cont::ArrayHandle<T> x_handle;
-    vtkm::cont::ArrayHandle<T> y_handle;
-    vtkm::cont::ArrayHandle<T> z_handle;
-
-    // always zero copy because we are about to make a copy
-    detail::CopyArray(x_handle, x_ptr, num_vals, true);
-    detail::CopyArray(y_handle, y_ptr, num_vals, true);
-    detail::CopyArray(z_handle, z_ptr, num_vals, true);
+    const index_t z_stride = w.dtype().stride() / sizeof(T);
+    if(w.dtype().stride() % sizeof(T) != 0)
+    {
+      ASCENT_ERROR("Extract vector: component stride is not a multiple of "
+                   "the component size for field "<<field_name);
+    }
+    auto z_handle = StridedArray(GetNodePointer<T>(w), num_vals, z_stride, true);
 
-    auto composite  = make_ArrayHandleSOA(x_handle,
-                                          y_handle,
-                                          z_handle);
+    auto composite  = vtkm::cont::make_ArrayHandleCompositeVector(x_handle,
+                                                                  y_handle,
+                                                                  z_handle);
 
     vtkm::cont::ArrayHandle<vtkm::Vec<T,3>> interleaved_handle;
     interleaved_handle.Allocate(num_vals);
@@ -575,6 +609,136 @@ bool allEqual(std::vector<T> const &v)
   return std::adjacent_find(v.begin(), v.end(), std::not_equal_to<T>()) == v.end();
 }
 
+//-----------------------------------------------------------------------------
+conduit::uint64 MeshFingerprint(const conduit::Node &n_coords,
+                                const conduit::Node &n_topo,
+                                bool zero_copy)
+{
+  conduit::uint64 hash = hash_seed;
+  hash_bytes(&zero_copy, sizeof(zero_copy), hash);
+  hash_structure(n_coords, true, hash);
+  hash_structure(n_topo, true, hash);
+  return hash;
+}
+
+//-----------------------------------------------------------------------------
+// true if converting n_topo gives a cell set that stays valid while the
+// topology keeps its layout and addresses
+bool CellsAliasBlueprint(const conduit::Node &n_topo,
+                         bool zero_copy)
+{
+  if(n_topo["type"].as_string() != "unstructured")
+  {
+    // the cells follow from the dims, which are hashed by value
+    return true;
+  }
+  if(!zero_copy)
+  {
+    return false;
+  }
+
+  const conduit::Node &n_eles = n_topo["elements"];
+  // mixed shapes always build a copy of the offsets
+  if(n_eles.has_child("shapes") || n_topo.has_child("subelements"))
+  {
+    return false;
+  }
+  // connectivity that does not match vtkm::Id is converted into a copy
+  const conduit::Node &n_conn = n_eles["connectivity"];
+  const conduit::DataType &dtype = n_conn.dtype();
+  return n_conn.is_compact() &&
+         ((sizeof(vtkm::Id) == 8 && dtype.is_int64()) ||
+          (sizeof(vtkm::Id) == 4 && dtype.is_int32()));
+}
+
+//-----------------------------------------------------------------------------
+// true if converting n_coords gives a coordinate system that stays valid
+// while the coordset keeps its layout and addresses
+bool CoordinatesAliasBlueprint(const conduit::Node &n_coords,
+                               bool zero_copy)
+{
+  const std::string coords_type = n_coords["type"].as_string();
+  if(coords_type == "uniform")
+  {
+    return true;
+  }
+  if(!zero_copy)
+  {
+    return false;
+  }
+
+  const conduit::Node &n_values = n_coords["values"];
+  if(coords_type == "explicit" && InterleavedXYZ(n_values) &&
+     (n_values["x"].dtype().is_float64() || n_values["x"].dtype().is_float32()))
+  {
+    return true;
+  }
+  for(int i = 0; i < n_values.number_of_children(); ++i)
+  {
+    const conduit::DataType &dtype = n_values.child(i).dtype();
+    if(!(dtype.is_float64() || dtype.is_float32()))
+    {
+      return false;
+    }
+    // strided rectilinear values are copied into compact arrays,
+    // strided explicit values are viewed in place
+    if(coords_type == "rectilinear" &&
+       (!dtype.is_float64() || dtype.stride() != dtype.element_bytes()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// the coordinate system of an explicit coordset, the same way the
+// structured, points, and unstructured conversions build it
+vtkm::cont::CoordinateSystem
+ExplicitCoordinateSystem(const conduit::Node &n_coords,
+                         const std::string &coords_name,
+                         int &ndims,
+                         bool zero_copy)
+{
+    vtkm::cont::CoordinateSystem coords;
+    const conduit::DataType &x_dtype = n_coords["values/x"].dtype();
+    if(!x_dtype.is_float64() && !x_dtype.is_float32())
+    {
+      ASCENT_ERROR("Coordinate system must be floating point values");
+    }
+
+    const index_t element_bytes = x_dtype.element_bytes();
+    index_t x_element_stride = x_dtype.stride() / element_bytes;
+    index_t y_element_stride = n_coords["values/y"].dtype().stride() / element_bytes;
+    index_t z_element_stride = 0;
+    if(n_coords.has_path("values/z"))
+    {
+      z_element_stride = n_coords["values/z"].dtype().stride() / element_bytes;
+    }
+
+    if(x_dtype.is_float64())
+    {
+      coords = GetExplicitCoordinateSystem<float64>(n_coords,
+                                                    coords_name,
+                                                    ndims,
+                                                    x_element_stride,
+                                                    y_element_stride,
+                                                    z_element_stride,
+                                                    zero_copy);
+    }
+    else
+    {
+      coords = GetExplicitCoordinateSystem<float32>(n_coords,
+                                                    coords_name,
+                                                    ndims,
+                                                    x_element_stride,
+                                                    y_element_stride,
+                                                    z_element_stride,
+                                                    zero_copy);
+    }
+    return coords;
+}
+
 
 
 template<typename T, typename S>
@@ -781,13 +945,66 @@ void GetMatSetFields(const conduit::Node &node, //materials["matset"]
 // -- end detail:: --
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// VTKmConversionCache
+//-----------------------------------------------------------------------------
+
+struct VTKmConversionCache::Entry
+{
+    conduit::uint64              m_fingerprint = 0;
+    vtkm::cont::UnknownCellSet   m_cell_set;
+    vtkm::cont::CoordinateSystem m_coords;
+    // false if m_coords is a copy that can go stale
+    bool                         m_keep_coords = false;
+    // false if m_cell_set is a copy that can go stale
+    bool                         m_keep_cells = false;
+    int                          m_neles = 0;
+    int                          m_nverts = 0;
+};
+
+//-----------------------------------------------------------------------------
+VTKmConversionCache::VTKmConversionCache()
+  : m_hits(0),
+    m_misses(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+VTKmConversionCache::~VTKmConversionCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKmConversionCache::reset()
+{
+    m_entries.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+//-----------------------------------------------------------------------------
+int
+VTKmConversionCache::hits() const
+{
+    return m_hits;
+}
+
+//-----------------------------------------------------------------------------
+int
+VTKmConversionCache::misses() const
+{
+    return m_misses;
+}
+
 //-----------------------------------------------------------------------------
 // VTKHDataAdapter public methods
 //-----------------------------------------------------------------------------
 
 VTKHCollection*
 VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
-                                           bool zero_copy)
+                                           bool zero_copy,
+                                           VTKmConversionCache *cache)
 {
     // We must separate different topologies into
     // different vtkh data sets
@@ -803,6 +1020,12 @@ VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
     double time = 0;
     std::vector<vtkm::UInt64> allCycles;
     std::vector<double> allTimes;
+    std::map<std::string, std::shared_ptr<VTKmConversionCache::Entry>> cached;
+    if(cache != nullptr)
+    {
+      cache->m_hits = 0;
+      cache->m_misses = 0;
+    }
 
     for(int i = 0; i < num_domains; ++i)
     {
@@ -830,12 +1053,28 @@ VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
       for(int t = 0; t < topo_names.size(); ++t)
       {
         const std::string topo_name = topo_names[t];
-        vtkm::cont::DataSet *dset = BlueprintToVTKmDataSet(dom, zero_copy, topo_name);
+        vtkm::cont::DataSet *dset = nullptr;
+        if(cache != nullptr)
+        {
+          const std::string domain_key = std::to_string(domain_id) + "/" + topo_name;
+          dset = CachedBlueprintToVTKmDataSet(dom, domain_key, zero_copy, topo_name, *cache);
+          cached[domain_key] = cache->m_entries[domain_key];
+        }
+        else
+        {
+          dset = BlueprintToVTKmDataSet(dom, zero_copy, topo_name);
+        }
         datasets[topo_name].AddDomain(*dset,domain_id);
         delete dset;
       }
     }
 
+    if(cache != nullptr)
+    {
+      // drop entries of domains that are gone
+      cache->m_entries.swap(cached);
+    }
+
     //check to make sure there is data to grab
     if(num_domains > 0)
     {
@@ -914,7 +1153,28 @@ VTKHDataAdapter::VTKmDataSetToVTKHDataSet(vtkm::cont::DataSet *dset)
 vtkm::cont::DataSet *
 VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
                                         bool zero_copy,
-                                        const std::string &topo_name_str)
+                                        const std::string &topo_name)
+{
+    int neles  = 0;
+    int nverts = 0;
+
+    vtkm::cont::DataSet *result = BlueprintToVTKmMesh(node,
+                                                      zero_copy,
+                                                      topo_name,
+                                                      neles,
+                                                      nverts);
+
+    AddFieldsAndMatsets(node, topo_name, neles, nverts, result, zero_copy);
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+vtkm::cont::DataSet *
+VTKHDataAdapter::BlueprintToVTKmMesh(const Node &node,
+                                     bool zero_copy,
+                                     const std::string &topo_name_str,
+                                     int &neles,
+                                     int &nverts)
 {
     vtkm::cont::DataSet * result = NULL;
 
@@ -935,9 +1195,6 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
     const Node &n_coords = node["coordsets"][coords_name];
 
 
-    int neles  = 0;
-    int nverts = 0;
-
     if( mesh_type ==  "uniform")
     {
         result = UniformBlueprintToVTKmDataSet(coords_name,
@@ -993,7 +1250,91 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
         ASCENT_ERROR("Unsupported topology/type:" << mesh_type);
     }
 
+    return result;
+}
 
+//-----------------------------------------------------------------------------
+vtkm::cont::DataSet *
+VTKHDataAdapter::CachedBlueprintToVTKmDataSet(const Node &node,
+                                              const std::string &domain_key,
+                                              bool zero_copy,
+                                              const std::string &topo_name,
+                                              VTKmConversionCache &cache)
+{
+    if(!node["topologies"].has_child(topo_name))
+    {
+        ASCENT_ERROR("Invalid topology name: " << topo_name);
+    }
+
+    const Node &n_topo   = node["topologies"][topo_name];
+    const std::string coords_name = n_topo["coordset"].as_string();
+    const Node &n_coords = node["coordsets"][coords_name];
+
+    const conduit::uint64 fingerprint = detail::MeshFingerprint(n_coords,
+                                                                n_topo,
+                                                                zero_copy);
+
+    std::shared_ptr<VTKmConversionCache::Entry> &entry = cache.m_entries[domain_key];
+    vtkm::cont::DataSet *result = nullptr;
+
+    const std::string coords_type = n_coords["type"].as_string();
+    // stale coordinates can only be rebuilt on their own when explicit
+    if(entry != nullptr &&
+       entry->m_fingerprint == fingerprint &&
+       entry->m_keep_cells &&
+       (entry->m_keep_coords || coords_type == "explicit"))
+    {
+        cache.m_hits++;
+        result = new vtkm::cont::DataSet();
+        if(entry->m_keep_coords)
+        {
+            result->AddCoordinateSystem(entry->m_coords);
+        }
+        else
+        {
+            // the coordinates may have moved, only the cells are kept
+            int ndims = 0;
+            result->AddCoordinateSystem(
+              detail::ExplicitCoordinateSystem(n_coords, coords_name, ndims, zero_copy));
+        }
+        result->SetCellSet(entry->m_cell_set);
+    }
+    else
+    {
+        cache.m_misses++;
+        std::shared_ptr<VTKmConversionCache::Entry> converted =
+          std::make_shared<VTKmConversionCache::Entry>();
+        result = BlueprintToVTKmMesh(node,
+                                     zero_copy,
+                                     topo_name,
+                                     converted->m_neles,
+                                     converted->m_nverts);
+        converted->m_fingerprint = fingerprint;
+        converted->m_cell_set = result->GetCellSet();
+        converted->m_coords = result->GetCoordinateSystem();
+        converted->m_keep_coords = detail::CoordinatesAliasBlueprint(n_coords, zero_copy);
+        converted->m_keep_cells = detail::CellsAliasBlueprint(n_topo, zero_copy);
+        entry = converted;
+    }
+
+    AddFieldsAndMatsets(node,
+                        topo_name,
+                        entry->m_neles,
+                        entry->m_nverts,
+                        result,
+                        zero_copy);
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::AddFieldsAndMatsets(const Node &node,
+                                     const std::string &topo_name,
+                                     int neles,
+                                     int nverts,
+                                     vtkm::cont::DataSet *dset,
+                                     bool zero_copy)
+{
     if(node.has_child("fields"))
     {
         // add all of the fields:
@@ -1022,7 +1363,7 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
                          topo_name,
                          neles,
                          nverts,
-                         result,
+                         dset,
                          zero_copy);
             }
             else if(num_children == 2 )
@@ -1032,7 +1373,7 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
                              topo_name,
                              neles,
                              nverts,
-                             result,
+                             dset,
                              2,
                              zero_copy);
             }
@@ -1043,7 +1384,7 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
                              topo_name,
                              neles,
                              nverts,
-                             result,
+                             dset,
                              3,
                              zero_copy);
             }
@@ -1072,12 +1413,11 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
                      n_matset,
                      topo_name,
                      neles,
-                     result,
+                     dset,
                      zero_copy);
 
         }
     }
-    return result;
 }
 
 
@@ -2382,7 +2722,9 @@ VTKHDataAdapter::AddVectorField(const std::string &field_name,
     int num_components = n_field["values"].number_of_children();
 
     const conduit::Node &u = n_field["values"].child(0);
-    bool interleaved = conduit::blueprint::mcarray::is_interleaved(n_vals);
+    // tuples with padding between them are read like separate components
+    bool interleaved = conduit::blueprint::mcarray::is_interleaved(n_vals) &&
+                       u.dtype().stride() == dims * u.dtype().element_bytes();
     try
     {
         bool supported_type = false;
@@ -2460,7 +2802,7 @@ VTKHDataAdapter::AddVectorField(const std::string &field_name,
         }
         else
         {
-          // we have a vector with 2/3 separate arrays
+          // we have a vector with 2/3 separate (possibly strided) arrays
           // While vtkm supports ArrayHandleCompositeVectors for
           // coordinate systems, it does not support composites
           // for fields. Thus we have to copy the data.
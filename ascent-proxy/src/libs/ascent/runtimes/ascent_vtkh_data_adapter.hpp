@@ -38,6 +38,10 @@ class DataSet;
 // conduit includes
 #include <conduit.hpp>
 
+#include <map>
+#include <memory>
+#include <string>
+
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -45,6 +49,36 @@ class DataSet;
 namespace ascent
 {
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Keeps the cell sets and coordinate systems converted from blueprint
+// topologies between collection conversions, keyed by domain id and
+// topology name. An entry is reused while the topology and coordset it
+// was built from keep their layout and data addresses, so only fields
+// are converted again. Coordinate systems are only kept when they alias
+// the blueprint data (zero copy) or are implicit, since simulations
+// commonly move their coordinates in place.
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+class ASCENT_API VTKmConversionCache
+{
+public:
+    VTKmConversionCache();
+    ~VTKmConversionCache();
+
+    void reset();
+    // topologies reused / converted by the last collection conversion
+    int hits() const;
+    int misses() const;
+
+private:
+    friend class VTKHDataAdapter;
+    struct Entry;
+    std::map<std::string, std::shared_ptr<Entry>> m_entries;
+    int m_hits;
+    int m_misses;
+};
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 // Class that Handles Blueprint to vtk-h, VTKm Data Transforms
@@ -59,8 +93,11 @@ public:
     // Convert a multi-domain blueprint data set to a VTKHCollection
     //  assumes: conduit::blueprint::mesh::verify(n,info) == true
     //
+    // with a cache, topologies converted by a previous call are reused
+    //
     static VTKHCollection* BlueprintToVTKHCollection(const conduit::Node &n,
-                                                     bool zero_copy);
+                                                     bool zero_copy,
+                                                     VTKmConversionCache *cache = nullptr);
     // convert blueprint data to a vtkh Data Set
     // assumes "n" conforms to the mesh blueprint
     //
@@ -98,6 +135,26 @@ public:
                                                               conduit::Node &node,
                                                               bool zero_copy = false);
 private:
+    // converts the coordset and topology, without fields
+    static vtkm::cont::DataSet  *BlueprintToVTKmMesh(const conduit::Node &n,
+                                                     bool zero_copy,
+                                                     const std::string &topo_name,
+                                                     int &neles,
+                                                     int &nverts);
+
+    static vtkm::cont::DataSet  *CachedBlueprintToVTKmDataSet(const conduit::Node &n,
+                                                              const std::string &domain_key,
+                                                              bool zero_copy,
+                                                              const std::string &topo_name,
+                                                              VTKmConversionCache &cache);
+
+    static void                  AddFieldsAndMatsets(const conduit::Node &n,
+                                                     const std::string &topo_name,
+                                                     int neles,
+                                                     int nverts,
+                                                     vtkm::cont::DataSet *dset,
+                                                     bool zero_copy);
+
     // helpers for specific conversion cases
     static vtkm::cont::DataSet  *UniformBlueprintToVTKmDataSet(const std::string &coords_name,
                                                                const conduit::Node &n_coords,
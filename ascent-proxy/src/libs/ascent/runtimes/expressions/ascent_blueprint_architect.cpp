@@ -25,8 +25,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <vector>
 
 #include <flow_workspace.hpp>
 
@@ -992,6 +994,243 @@ field_histogram(const conduit::Node &dataset,
   return res;
 }
 
+conduit::Node
+field_features(const conduit::Node &dataset,
+               const conduit::Node &features)
+{
+  const int num_entries = features.number_of_children();
+
+  // local moments per entry, one pass over each field
+  // max section: [max, -min] per entry, sum section: [sum, sum_sq, count]
+  std::vector<double> max_section(2 * num_entries, 0.0);
+  std::vector<double> sum_section(3 * num_entries, 0.0);
+
+  std::vector<std::string> fields(num_entries);
+  std::vector<std::string> components(num_entries);
+  for(int e = 0; e < num_entries; ++e)
+  {
+    const conduit::Node &entry = features.child(e);
+    if(!entry.has_child("field"))
+    {
+      ASCENT_ERROR("field_features: entry " << e << " is missing 'field'");
+    }
+    fields[e] = entry["field"].as_string();
+    if(entry.has_child("component"))
+    {
+      components[e] = entry["component"].as_string();
+    }
+
+    max_section[2 * e] = std::numeric_limits<double>::lowest();
+    max_section[2 * e + 1] = std::numeric_limits<double>::lowest();
+
+    const std::string path = "fields/" + fields[e];
+    for(int i = 0; i < dataset.number_of_children(); ++i)
+    {
+      const conduit::Node &dom = dataset.child(i);
+      if(!dom.has_path(path))
+      {
+        continue;
+      }
+      conduit::Node res = field_reduction_moments(dom[path], components[e]);
+      max_section[2 * e] = std::max(max_section[2 * e],
+                                    res["max"].to_float64());
+      max_section[2 * e + 1] = std::max(max_section[2 * e + 1],
+                                        -res["min"].to_float64());
+      sum_section[3 * e]     += res["sum"].to_float64();
+      sum_section[3 * e + 1] += res["sum_sq"].to_float64();
+      sum_section[3 * e + 2] += res["count"].to_float64();
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  // one reduction per op for all entries
+  MPI_Allreduce(MPI_IN_PLACE,
+                max_section.data(),
+                (int) max_section.size(),
+                MPI_DOUBLE,
+                MPI_MAX,
+                mpi_comm);
+  MPI_Allreduce(MPI_IN_PLACE,
+                sum_section.data(),
+                (int) sum_section.size(),
+                MPI_DOUBLE,
+                MPI_SUM,
+                mpi_comm);
+#endif
+
+  // percentiles need the global range, so they are binned in a second
+  // pass and all histograms share one reduction
+  std::vector<int> hist_offsets(num_entries, -1);
+  std::vector<int> hist_bins(num_entries, 0);
+  int hist_size = 0;
+  for(int e = 0; e < num_entries; ++e)
+  {
+    const conduit::Node &entry = features.child(e);
+    if(!entry.has_child("stats"))
+    {
+      continue;
+    }
+    conduit::NodeConstIterator itr = entry["stats"].children();
+    while(itr.has_next())
+    {
+      if(itr.next().as_string()[0] == 'p')
+      {
+        hist_bins[e] = entry.has_child("num_bins") ?
+                       entry["num_bins"].to_int32() : 256;
+        hist_offsets[e] = hist_size;
+        hist_size += hist_bins[e];
+        break;
+      }
+    }
+  }
+
+  std::vector<double> hists(hist_size, 0.0);
+  for(int e = 0; e < num_entries; ++e)
+  {
+    if(hist_offsets[e] == -1 || sum_section[3 * e + 2] == 0.0)
+    {
+      continue;
+    }
+    const double min_val = -max_section[2 * e + 1];
+    // pad the max so it lands in the last bin
+    const double max_val = max_section[2 * e] +
+                           std::max(std::abs(max_section[2 * e]), 1.0) * 1e-12;
+    const std::string path = "fields/" + fields[e];
+    for(int i = 0; i < dataset.number_of_children(); ++i)
+    {
+      const conduit::Node &dom = dataset.child(i);
+      if(!dom.has_path(path))
+      {
+        continue;
+      }
+      conduit::Node res = field_reduction_histogram(dom[path],
+                                                    min_val,
+                                                    max_val,
+                                                    hist_bins[e],
+                                                    components[e]);
+      const double *dom_hist = res["value"].value();
+      double *hist = &hists[hist_offsets[e]];
+      for(int b = 0; b < hist_bins[e]; ++b)
+      {
+        hist[b] += dom_hist[b];
+      }
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  if(hist_size > 0)
+  {
+    MPI_Allreduce(MPI_IN_PLACE,
+                  &hists[0],
+                  hist_size,
+                  MPI_DOUBLE,
+                  MPI_SUM,
+                  mpi_comm);
+  }
+#endif
+
+  std::vector<double> values;
+  conduit::Node res;
+  conduit::Node &names = res["names"];
+  for(int e = 0; e < num_entries; ++e)
+  {
+    const conduit::Node &entry = features.child(e);
+    const double max_val = max_section[2 * e];
+    const double min_val = -max_section[2 * e + 1];
+    const double sum = sum_section[3 * e];
+    const double sum_sq = sum_section[3 * e + 1];
+    const double count = sum_section[3 * e + 2];
+    const double mean = count > 0.0 ? sum / count : 0.0;
+
+    std::vector<std::string> stats;
+    if(entry.has_child("stats"))
+    {
+      conduit::NodeConstIterator itr = entry["stats"].children();
+      while(itr.has_next())
+      {
+        stats.push_back(itr.next().as_string());
+      }
+    }
+    else
+    {
+      stats.push_back("max");
+    }
+
+    std::string prefix = fields[e];
+    if(!components[e].empty())
+    {
+      prefix += "/" + components[e];
+    }
+
+    for(const std::string &stat : stats)
+    {
+      double value = 0.0;
+      if(count == 0.0)
+      {
+        value = 0.0;
+      }
+      else if(stat == "max")
+      {
+        value = max_val;
+      }
+      else if(stat == "min")
+      {
+        value = min_val;
+      }
+      else if(stat == "sum")
+      {
+        value = sum;
+      }
+      else if(stat == "mean")
+      {
+        value = mean;
+      }
+      else if(stat == "l2")
+      {
+        value = std::sqrt(sum_sq);
+      }
+      else if(stat == "std")
+      {
+        value = std::sqrt(std::max(sum_sq / count - mean * mean, 0.0));
+      }
+      else if(stat.size() > 1 && stat[0] == 'p')
+      {
+        const double percent = std::atof(stat.c_str() + 1);
+        if(percent < 0.0 || percent > 100.0)
+        {
+          ASCENT_ERROR("field_features: invalid percentile '" << stat << "'");
+        }
+        const int num_bins = hist_bins[e];
+        const double *hist = &hists[hist_offsets[e]];
+        const double bin_size = (max_val - min_val) / double(num_bins);
+        const double target = percent / 100.0 * count;
+        double cumulative = 0.0;
+        value = max_val;
+        for(int b = 0; b < num_bins; ++b)
+        {
+          if(hist[b] > 0.0 && cumulative + hist[b] >= target)
+          {
+            const double frac = (target - cumulative) / hist[b];
+            value = min_val + (b + frac) * bin_size;
+            break;
+          }
+          cumulative += hist[b];
+        }
+      }
+      else
+      {
+        ASCENT_ERROR("field_features: unknown stat '" << stat << "'");
+      }
+      values.push_back(value);
+      names.append() = prefix + "/" + stat;
+    }
+  }
+
+  res["values"].set(values);
+  return res;
+}
+
 //Take in an array of fields
 //add new field that is field1 + .. + fieldn
 void
@@ -2563,7 +2802,7 @@ field_max(const conduit::Node &dataset, const std::string &field)
 
   if(domain != -1)
   {
-    const std::string assoc_str =
+    assoc_str =
         dataset.child(domain)["fields/" + field + "/association"].as_string();
 
     const std::string topo_str =
@@ -2624,6 +2863,179 @@ field_max(const conduit::Node &dataset, const std::string &field)
   return res;
 }
 
+namespace detail
+{
+// fills [x, y, z, domain_id, index, assoc] for an entry of a field
+void
+pack_reduction_location(const conduit::Node &dataset,
+                        const std::string &field,
+                        const int domain,
+                        const int index,
+                        double *packed)
+{
+  packed[0] = packed[1] = packed[2] = 0.;
+  packed[3] = -1.;
+  packed[4] = index;
+  packed[5] = 0.;
+  if(domain == -1)
+  {
+    return;
+  }
+
+  const conduit::Node &dom = dataset.child(domain);
+  const std::string assoc_str =
+      dom["fields/" + field + "/association"].as_string();
+  const std::string topo_str =
+      dom["fields/" + field + "/topology"].as_string();
+
+  conduit::Node loc;
+  if(assoc_str == "vertex")
+  {
+    loc = vert_location(dom, index, topo_str);
+    packed[5] = 1.;
+  }
+  else if(assoc_str == "element")
+  {
+    loc = element_location(dom, index, topo_str);
+  }
+  else
+  {
+    ASCENT_ERROR("Location for " << assoc_str << " not implemented");
+  }
+  const double *ploc = loc.as_float64_ptr();
+  packed[0] = ploc[0];
+  packed[1] = ploc[1];
+  packed[2] = ploc[2];
+  packed[3] = dom["state/domain_id"].to_int32();
+}
+} // namespace detail
+
+conduit::Node
+field_reductions_batched(const conduit::Node &dataset,
+                         const std::vector<std::string> &fields)
+{
+  const int num_fields = fields.size();
+  int rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  MPI_Comm_rank(mpi_comm, &rank);
+#endif
+
+  struct ValueRank
+  {
+    double value;
+    int rank;
+  };
+
+  // [max, -min] per field so both extrema share one MAXLOC reduction
+  std::vector<ValueRank> extrema(2 * num_fields);
+  std::vector<int> domains(2 * num_fields, -1);
+  std::vector<int> indices(2 * num_fields, -1);
+  // summed section: [sum, count, scalar] per field followed by
+  // [x, y, z, domain_id, index, assoc] per extremum, which only the
+  // owning rank fills in
+  std::vector<double> packed(15 * num_fields, 0.0);
+  double *locations = &packed[3 * num_fields];
+
+  for(int f = 0; f < num_fields; ++f)
+  {
+    extrema[2 * f] = {std::numeric_limits<double>::lowest(), rank};
+    extrema[2 * f + 1] = {std::numeric_limits<double>::lowest(), rank};
+
+    const std::string path = "fields/" + fields[f];
+    bool has_field = false;
+    for(int i = 0; i < dataset.number_of_children(); ++i)
+    {
+      const conduit::Node &dom = dataset.child(i);
+      if(!dom.has_path(path))
+      {
+        continue;
+      }
+      const int num_children = dom[path + "/values"].number_of_children();
+      if(!has_field)
+      {
+        // same rule as is_scalar_field: the first domain decides
+        has_field = true;
+        packed[3 * f + 2] = num_children <= 1 ? 1. : 0.;
+      }
+      if(num_children > 1)
+      {
+        continue;
+      }
+
+      conduit::Node res = field_reduction_extrema(dom[path]);
+      const double a_max = res["max/value"].to_float64();
+      if(a_max > extrema[2 * f].value)
+      {
+        extrema[2 * f].value = a_max;
+        domains[2 * f] = i;
+        indices[2 * f] = res["max/index"].to_int32();
+      }
+      const double a_min = res["min/value"].to_float64();
+      if(-a_min > extrema[2 * f + 1].value)
+      {
+        extrema[2 * f + 1].value = -a_min;
+        domains[2 * f + 1] = i;
+        indices[2 * f + 1] = res["min/index"].to_int32();
+      }
+      packed[3 * f] += res["sum"].to_float64();
+      packed[3 * f + 1] += res["count"].to_float64();
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE,
+                &extrema[0],
+                2 * num_fields,
+                MPI_DOUBLE_INT,
+                MPI_MAXLOC,
+                mpi_comm);
+#endif
+
+  for(int e = 0; e < 2 * num_fields; ++e)
+  {
+    if(extrema[e].rank == rank)
+    {
+      detail::pack_reduction_location(dataset,
+                                      fields[e / 2],
+                                      domains[e],
+                                      indices[e],
+                                      &locations[6 * e]);
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Allreduce(MPI_IN_PLACE,
+                &packed[0],
+                (int) packed.size(),
+                MPI_DOUBLE,
+                MPI_SUM,
+                mpi_comm);
+#endif
+
+  conduit::Node res;
+  for(int f = 0; f < num_fields; ++f)
+  {
+    conduit::Node &n_field = res.add_child(fields[f]);
+    for(int m = 0; m < 2; ++m)
+    {
+      const int e = 2 * f + m;
+      const double *loc = &locations[6 * e];
+      conduit::Node &n_ext = n_field[m == 0 ? "max" : "min"];
+      n_ext["rank"] = extrema[e].rank;
+      n_ext["domain_id"] = (int) loc[3];
+      n_ext["index"] = (int) loc[4];
+      n_ext["assoc"] = loc[5] == 1. ? "vertex" : "element";
+      n_ext["position"].set(loc, 3);
+      n_ext["value"] = m == 0 ? extrema[e].value : -extrema[e].value;
+    }
+    n_field["sum/value"] = packed[3 * f];
+    n_field["sum/count"] = (long long int) packed[3 * f + 1];
+    n_field["scalar"] = packed[3 * f + 2] > 0. ? 1 : 0;
+  }
+  return res;
+}
+
 conduit::Node
 get_state_var(const conduit::Node &dataset, const std::string &var_name)
 {
@@ -78,6 +78,26 @@ conduit::Node field_histogram(const conduit::Node &dataset,
                               const double &max_val,
                               const int &num_bins);
 
+// Computes a vector of statistics over several fields. `features` is a
+// list, each entry names a `field`, an optional `component`, an optional
+// list of `stats` (max, min, sum, mean, l2, std, or pNN for the NNth
+// percentile; default max) and optional `num_bins` for percentiles.
+// All fields are traversed once and the global reductions are packed
+// into one max and one sum collective (percentiles add one histogram
+// pass).
+// Returns "values" (float64 array) and "names" (list of strings).
+ASCENT_API
+conduit::Node field_features(const conduit::Node &dataset,
+                             const conduit::Node &features);
+
+// Computes field_max, field_min, and field_sum of several scalar fields
+// with one traversal per field and domain and two collectives in total.
+// Returns one child per field holding "max", "min", and "sum" (laid out
+// like the single field versions) and "scalar" (is_scalar_field).
+ASCENT_API
+conduit::Node field_reductions_batched(const conduit::Node &dataset,
+                                       const std::vector<std::string> &fields);
+
 ASCENT_API
 conduit::Node histogram_entropy(const conduit::Node &hist);
 
@@ -180,15 +180,15 @@ struct DeviceAccessor
 {
   const T *m_values;
   const index_t m_size;
-  const index_t m_offset;
   const index_t m_stride;
 
   //==---------------------------------------------------------------------==//
+  // values points at the first element (conduit's typed pointers already
+  // include the offset), so only the stride of dtype is applied
   DeviceAccessor(const T *values, const conduit::DataType &dtype)
     : m_values(values),
       m_size(dtype.number_of_elements()),
-      // conduit strides and offsets are in terms of bytes
-      m_offset(dtype.offset() / sizeof(T)),
+      // conduit strides are in terms of bytes
       m_stride(dtype.stride() / sizeof(T))
   {
 
@@ -198,7 +198,7 @@ struct DeviceAccessor
   ASCENT_EXEC
   T operator[](const index_t index) const
   {
-    return m_values[m_offset + m_stride * index];
+    return m_values[m_stride * index];
   }
 protected:
   DeviceAccessor(){};
@@ -300,18 +300,10 @@ public:
     //}
     std::string path;
     const T * ptr = raw_ptr(component,path);
-    // elemen_index is extremely missleading. Its actually the byte offset to
-    // the element. 2 hours to learn this
+    // ptr already points at element 0, so step by the stride alone
+    // (element_index would add the offset a second time)
     T val;
-    index_t el_idx = 0;
-    if(path != "")
-    {
-        el_idx = m_src_node[path].dtype().element_index(idx) / sizeof(T);
-    }
-    else
-    {
-        el_idx = m_src_node.dtype().element_index(idx) / sizeof(T);
-    }
+    const index_t el_idx = idx * element_stride(component);
 
     if(DeviceMemory::is_device_ptr(ptr))
     {
@@ -328,6 +320,25 @@ public:
     return val;
   }
 
+  //==---------------------------------------------------------------------==//
+  // distance between values of a component in elements of T
+  index_t element_stride(int component)
+  {
+    const std::string leaf_path = component_path(component);
+    const conduit::Node &n_leaf = leaf_path != "" ? m_src_node[leaf_path]
+                                                  : m_src_node;
+    return n_leaf.dtype().stride() / sizeof(T);
+  }
+
+  //==---------------------------------------------------------------------==//
+  // number of T a strided component spans, which is what a copy of it
+  // has to hold for accessors to keep using the source stride
+  index_t extent(int component)
+  {
+    const index_t size = m_sizes[component];
+    return size > 0 ? (size - 1) * element_stride(component) + 1 : 0;
+  }
+
   //==---------------------------------------------------------------------==//
   std::string component_path(int component)
   {
@@ -422,7 +433,7 @@ public:
         conduit::Node &n_device = m_tmps[d_path];
         n_device.set_allocator(AllocationManager::conduit_device_allocator_id());
         //std::cout<<"setting...\n";
-        n_device.set(ptr, m_sizes[component]);
+        n_device.set(ptr, extent(component));
         //std::cout<<"set\n";
       }
       //else std::cout<<"already device_values\n";
@@ -474,7 +485,7 @@ public:
         //std::cout<<"Creating host pointer\n";
         conduit::Node &n_host = m_tmps[h_path];
         n_host.set_allocator(AllocationManager::conduit_host_allocator_id());
-        n_host.set(ptr, m_sizes[component]);
+        n_host.set(ptr, extent(component));
       }
       //else std::cout<<"already host_values\n";
       return conduit_ptr<T>(m_tmps[h_path]);
@@ -141,6 +141,76 @@ struct SumFunctor
   }
 };
 
+// min, max, sum, and sum of squares in a single pass
+struct MomentsFunctor
+{
+  template<typename T, typename Exec>
+  conduit::Node operator()(const DeviceAccessor<T> accessor,
+                           const Exec &) const
+  {
+    const int size = accessor.m_size;
+    using for_policy = typename Exec::for_policy;
+    using reduce_policy = typename Exec::reduce_policy;
+
+    ascent::ReduceMin<reduce_policy,double> min_reducer(std::numeric_limits<double>::max());
+    ascent::ReduceMax<reduce_policy,double> max_reducer(std::numeric_limits<double>::lowest());
+    ascent::ReduceSum<reduce_policy,double> sum(0.0);
+    ascent::ReduceSum<reduce_policy,double> sum_sq(0.0);
+    ascent::forall<for_policy>(0, size, [=] ASCENT_LAMBDA(index_t i)
+    {
+      const double val = static_cast<double>(accessor[i]);
+      min_reducer.min(val);
+      max_reducer.max(val);
+      sum += val;
+      sum_sq += val * val;
+    });
+    ASCENT_DEVICE_ERROR_CHECK();
+
+    conduit::Node res;
+    res["min"] = min_reducer.get();
+    res["max"] = max_reducer.get();
+    res["sum"] = sum.get();
+    res["sum_sq"] = sum_sq.get();
+    res["count"] = size;
+    return res;
+  }
+};
+
+// max and min locations, sum, and count in a single pass
+struct ExtremaFunctor
+{
+  template<typename T, typename Exec>
+  conduit::Node operator()(const DeviceAccessor<T> accessor,
+                           const Exec &) const
+  {
+    const int size = accessor.m_size;
+    using for_policy = typename Exec::for_policy;
+    using reduce_policy = typename Exec::reduce_policy;
+
+    ascent::ReduceMaxLoc<reduce_policy,T> max_reducer(std::numeric_limits<T>::lowest(),-1);
+    ascent::ReduceMinLoc<reduce_policy,T> min_reducer(std::numeric_limits<T>::max(),-1);
+    // summed in double so integer fields do not overflow
+    ascent::ReduceSum<reduce_policy,double> sum(0.0);
+    ascent::forall<for_policy>(0, size, [=] ASCENT_LAMBDA(index_t i)
+    {
+      const T val = accessor[i];
+      max_reducer.maxloc(val,i);
+      min_reducer.minloc(val,i);
+      sum += static_cast<double>(val);
+    });
+    ASCENT_DEVICE_ERROR_CHECK();
+
+    conduit::Node res;
+    res["max/value"] = max_reducer.get();
+    res["max/index"] = max_reducer.getLoc();
+    res["min/value"] = min_reducer.get();
+    res["min/index"] = min_reducer.getLoc();
+    res["sum"] = sum.get();
+    res["count"] = size;
+    return res;
+  }
+};
+
 struct DFAddFunctor
 {
     template<typename T, typename Exec>
@@ -416,6 +486,114 @@ struct HistogramFunctor
   }
 };
 
+// one fused step of a per element autoregressive model. For every
+// element: train its weights on the new value (normalized LMS), push
+// the value into the lag ring buffer, and predict its next value.
+// history is slot major (slot * size + i) and weights are term major
+// (term * size + i) so neighboring elements are contiguous
+struct FieldSurrogateFunctor
+{
+  double *m_history;
+  double *m_weights;
+  double *m_prediction;
+  index_t m_size;
+  int m_lags;
+  int m_next;
+  bool m_full;
+  bool m_train;
+  double m_step_size;
+
+  template<typename T, typename Exec>
+  conduit::Node operator()(const DeviceAccessor<T> accessor,
+                           const Exec &) const
+  {
+    const int size = accessor.m_size;
+    if(size != m_size)
+    {
+      ASCENT_ERROR("field surrogate: field has "<<size<<" values but the "
+                   <<"model was sized for "<<m_size);
+    }
+    // need to avoid capturing 'this'
+    const int lags = m_lags;
+    const int next = m_next;
+    const bool full = m_full;
+    const bool train = m_train;
+    const double step_size = m_step_size;
+    // the window is full after this value is pushed
+    const bool ready = full || next == lags - 1;
+
+    Array<double> history(m_history, lags * size);
+    Array<double> weights(m_weights, (lags + 1) * size);
+    Array<double> prediction(m_prediction, size);
+
+    double *history_ptr = history.get_ptr(Exec::memory_space);
+    double *weights_ptr = weights.get_ptr(Exec::memory_space);
+    double *prediction_ptr = prediction.get_ptr(Exec::memory_space);
+
+    using for_policy = typename Exec::for_policy;
+    using reduce_policy = typename Exec::reduce_policy;
+
+    ascent::ReduceSum<reduce_policy,double> sum_sq_err(0.0);
+    ascent::forall<for_policy>(0, size, [=] ASCENT_LAMBDA(index_t i)
+    {
+      const double value = static_cast<double>(accessor[i]);
+      if(full)
+      {
+        // the oldest observation is in slot `next`
+        double pred = weights_ptr[i];
+        double norm = 1.0;
+        for(int k = 0; k < lags; ++k)
+        {
+          const double x = history_ptr[((next + k) % lags) * size + i];
+          pred += weights_ptr[(k + 1) * size + i] * x;
+          norm += x * x;
+        }
+        const double err = value - pred;
+        sum_sq_err += err * err;
+        if(train)
+        {
+          const double scale = step_size * err / norm;
+          weights_ptr[i] += scale;
+          for(int k = 0; k < lags; ++k)
+          {
+            weights_ptr[(k + 1) * size + i]
+              += scale * history_ptr[((next + k) % lags) * size + i];
+          }
+        }
+      }
+
+      history_ptr[next * size + i] = value;
+
+      if(ready)
+      {
+        double pred = weights_ptr[i];
+        for(int k = 0; k < lags; ++k)
+        {
+          pred += weights_ptr[(k + 1) * size + i]
+                  * history_ptr[((next + 1 + k) % lags) * size + i];
+        }
+        prediction_ptr[i] = pred;
+      }
+      else
+      {
+        // persistence until the window fills
+        prediction_ptr[i] = value;
+      }
+    });
+    ASCENT_DEVICE_ERROR_CHECK();
+
+    // synch the values back to the host
+    (void) history.get_host_ptr();
+    (void) weights.get_host_ptr();
+    (void) prediction.get_host_ptr();
+
+    conduit::Node res;
+    res["sum_sq_err"] = sum_sq_err.get();
+    res["count"] = full ? size : 0;
+    return res;
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////
 // TODO THIS NEEDS TO BE RAJAFIED
 struct HistoryGradientRangeFunctor
@@ -493,6 +671,18 @@ field_reduction_sum(const conduit::Node &field, const std::string &component)
   return exec_dispatch_mcarray_component(field["values"], component, detail::SumFunctor());
 }
 
+conduit::Node
+field_reduction_moments(const conduit::Node &field, const std::string &component)
+{
+  return exec_dispatch_mcarray_component(field["values"], component, detail::MomentsFunctor());
+}
+
+conduit::Node
+field_reduction_extrema(const conduit::Node &field, const std::string &component)
+{
+  return exec_dispatch_mcarray_component(field["values"], component, detail::ExtremaFunctor());
+}
+
 conduit::Node
 field_reduction_nan_count(const conduit::Node &field, const std::string &component)
 {
@@ -572,6 +762,36 @@ array_sum(const conduit::Node &array,
   return res;
 }
 
+conduit::Node
+field_surrogate_step(const conduit::Node &field,
+                     conduit::Node &model,
+                     const double &step_size,
+                     const bool train,
+                     const std::string &component)
+{
+  const int lags = model["lags"].to_int32();
+  const int next = model["next"].to_int32();
+  const int count = model["count"].to_int32();
+
+  detail::FieldSurrogateFunctor func;
+  func.m_history = model["history"].value();
+  func.m_weights = model["weights"].value();
+  func.m_prediction = model["prediction"].value();
+  func.m_size = model["prediction"].dtype().number_of_elements();
+  func.m_lags = lags;
+  func.m_next = next;
+  func.m_full = count == lags;
+  func.m_train = train;
+  func.m_step_size = step_size;
+
+  conduit::Node res = exec_dispatch_mcarray_component(field["values"],
+                                                      component,
+                                                      func);
+  model["next"] = (next + 1) % lags;
+  model["count"] = count < lags ? count + 1 : lags;
+  return res;
+}
+
 conduit::Node
 derived_field_binary_add(const conduit::Node &l_field,
                          const conduit::Node &r_field,
@@ -69,6 +69,14 @@ conduit::Node ASCENT_API field_reduction_min(const conduit::Node &field,
 conduit::Node ASCENT_API field_reduction_sum(const conduit::Node &field,
                                   const std::string &component = "");
 
+// min, max, sum, sum_sq, and count from one traversal
+conduit::Node ASCENT_API field_reduction_moments(const conduit::Node &field,
+                                      const std::string &component = "");
+
+// max and min (with their indices), sum, and count from one traversal
+conduit::Node ASCENT_API field_reduction_extrema(const conduit::Node &field,
+                                      const std::string &component = "");
+
 conduit::Node ASCENT_API field_reduction_nan_count(const conduit::Node &field,
                                         const std::string &component = "");
 
@@ -82,6 +90,20 @@ conduit::Node ASCENT_API field_reduction_histogram(const conduit::Node &field,
                                         const int &num_bins,
                                         const std::string &component = "");
 
+//----------------------
+// field surrogates
+//----------------------
+// one fused train / push / predict step of a per element
+// autoregressive model. model holds "lags", "next" (ring slot to
+// write), "count" (observations in the ring), "history" (lags * n),
+// "weights" ((lags + 1) * n), and "prediction" (n). Returns the
+// summed squared error of the pre-update predictions and its count.
+conduit::Node ASCENT_API field_surrogate_step(const conduit::Node &field,
+                                              conduit::Node &model,
+                                              const double &step_size,
+                                              const bool train,
+                                              const std::string &component = "");
+
 //----------------------
 // derived fields
 //----------------------
@@ -23,6 +23,7 @@
 // ascent includes
 //-----------------------------------------------------------------------------
 #include "ascent_blueprint_architect.hpp"
+#include "ascent_expression_history.hpp"
 #include "ascent_data_binning.hpp"
 #include "ascent_blueprint_device_reductions.hpp"
 #include "ascent_execution_manager.hpp"
@@ -266,7 +267,7 @@ logic_op(const bool lhs, const bool rhs, const std::string &op)
 
 
 void get_first_and_last_index(const string &operator_name,
-                              const conduit::Node &history,
+                              const ExpressionHistory &history,
                               const int &entries,
                               const conduit::Node *n_first_index,
                               const conduit::Node *n_last_index,
@@ -338,19 +339,17 @@ void get_first_and_last_index(const string &operator_name,
                    <<"greater than the last_absolute_time.");
     }
 
-    string time_path = "time";
-
     double time;
     last_index = 0;
     for(int index = 0; index < entries; index++)
     {
-      if(history.child(index).has_path(time_path))
+      if(history.has_time(index))
       {
-        time = history.child(index)[time_path].to_float64();
+        time = history.time(index);
       }
       else
       {
-        ASCENT_ERROR(operator_name << ": internal error. missing " << time_path
+        ASCENT_ERROR(operator_name << ": internal error. missing time"
                      << " value for time point in retrieval window (for the"
                      <<" calculation at absolute index: " + to_string(index) + ")." );
       }
@@ -391,18 +390,10 @@ void get_first_and_last_index(const string &operator_name,
       ASCENT_ERROR(operator_name + ": the first_absolute_cycle must not be greater than the last_absolute_cycle.");
     }
 
-    vector<string> child_names = history.child_names();
-    if(child_names.size() != entries)
-    {
-      ASCENT_ERROR(operator_name + ": internal error. number of history entries: "
-                   <<to_string(entries) << ", but number of history child names: "
-                   << to_string(child_names.size()));
-    }
-
-    unsigned long long cycle;
+    long long cycle;
     for(int index = 0; index < entries; index++)
     {
-      cycle = stoull(child_names[index]);
+      cycle = history.cycle(index);
       if(first_index == -1 && cycle >= first_cycle)
       {
         first_index = index;
@@ -422,7 +413,7 @@ void get_first_and_last_index(const string &operator_name,
 }
 
 void set_values_from_history(const string &operator_name,
-                             const conduit::Node &history,
+                             const ExpressionHistory &history,
                              int first_index,
                              int return_size,
                              bool return_history_index,
@@ -433,68 +424,52 @@ void set_values_from_history(const string &operator_name,
 
   bool gradient = (return_history_index || return_simulation_time || return_simulation_cycle);
 
-  string value_path = "";
-  vector<string> value_paths = {"value", "attrs/value/value"};
-  for(const string &path : value_paths)
-  {
-    if(history.child(first_index).has_path(path))
-    {
-      value_path = path;
-      break;
-    }
-  }
-
-
-  if(value_path.size() == 0)
+  const conduit::index_t dtype_id = history.value_dtype(first_index);
+  if(dtype_id == conduit::DataType::EMPTY_ID)
   {
     ASCENT_ERROR(operator_name + " internal error. first index does not have one of the expected value paths");
   }
 
-  conduit::DataType dtype = history.child(first_index)[value_path].dtype();
-
-  if(dtype.is_float32())
+  if(dtype_id == conduit::DataType::FLOAT32_ID)
   {
-    float *array = new float[return_size];
+    (*output)["value"].set(conduit::DataType::float32(return_size));
+    conduit::float32 *array = (*output)["value"].value();
     for(int i = 0; i < return_size; ++i)
     {
-      array[i] = history.child(first_index+i)[value_path].to_float32();
+      array[i] = static_cast<conduit::float32>(history.value(first_index + i));
     }
-    (*output)["value"].set(array, return_size);
-    delete[] array;
   }
-  else if(dtype.is_float64())
+  else if(dtype_id == conduit::DataType::FLOAT64_ID)
   {
-    double *array = new double[return_size];
+    (*output)["value"].set(conduit::DataType::float64(return_size));
+    conduit::float64 *array = (*output)["value"].value();
     for(int i = 0; i < return_size; ++i)
     {
-      array[i] = history.child(first_index+i)[value_path].to_float64();
+      array[i] = history.value(first_index + i);
     }
-    (*output)["value"].set(array, return_size);
-    delete[] array;
   }
-  else if(dtype.is_int32())
+  else if(dtype_id == conduit::DataType::INT32_ID)
   {
-    int *array = new int[return_size];
+    (*output)["value"].set(conduit::DataType::int32(return_size));
+    conduit::int32 *array = (*output)["value"].value();
     for(int i = 0; i < return_size; ++i)
     {
-      array[i] = history.child(first_index+i)[value_path].to_int32();
+      array[i] = static_cast<conduit::int32>(history.value(first_index + i));
     }
-    (*output)["value"].set(array, return_size);
-    delete[] array;
   }
-  else if(dtype.is_int64())
+  else if(dtype_id == conduit::DataType::INT64_ID)
   {
-    long long *array = new long long[return_size];
+    (*output)["value"].set(conduit::DataType::int64(return_size));
+    conduit::int64 *array = (*output)["value"].value();
     for(int i = 0; i < return_size; ++i)
     {
-      array[i] = history.child(first_index+i)[value_path].to_int64();
+      array[i] = static_cast<conduit::int64>(history.value(first_index + i));
     }
-    (*output)["value"].set(array, return_size);
-    delete[] array;
   }
   else
   {
-    ASCENT_ERROR(operator_name + ": unsupported array type "<< dtype.to_string());
+    ASCENT_ERROR(operator_name + ": unsupported array type "
+                 << conduit::DataType::id_to_name(dtype_id));
   }
   (*output)["type"] = "array";
 
@@ -516,7 +491,7 @@ void set_values_from_history(const string &operator_name,
       for(int i = 0; i < return_size-1; ++i)
       {
         simulation_time_array[i]
-          = history.child(first_index + i + 1)["time"].to_float64() - history.child(first_index + i)["time"].to_float64();
+          = history.time(first_index + i + 1) - history.time(first_index + i);
 
       }
       (*output)["time"].set(simulation_time_array, return_size-1);
@@ -524,11 +499,10 @@ void set_values_from_history(const string &operator_name,
     }
     else if(return_simulation_cycle)
     {
-      vector<string> child_names = history.child_names();
       long long *cycle_array = new long long[return_size];
       for(int i = 0; i < return_size-1; ++i)
       {
-          cycle_array[i] = stoll(child_names[first_index + i + 1]) - stoll(child_names[first_index + i]);
+          cycle_array[i] = history.cycle(first_index + i + 1) - history.cycle(first_index + i);
       }
       (*output)["time"].set(cycle_array, return_size-1);
       delete[] cycle_array;
@@ -538,7 +512,7 @@ void set_values_from_history(const string &operator_name,
 
 
 conduit::Node *
-range_values_helper(const conduit::Node &history,
+range_values_helper(const ExpressionHistory &history,
                     const conduit::Node *n_first_absolute_index,
                     const conduit::Node *n_last_absolute_index,
                     const conduit::Node *n_first_relative_index,
@@ -606,7 +580,7 @@ range_values_helper(const conduit::Node &history,
     n_last_index = n_last_absolute_time;
   }
 
-  const int entries = history.number_of_children();
+  const int entries = history.size();
   if(entries <= 0)
   {
     ASCENT_ERROR(
@@ -660,6 +634,25 @@ range_values_helper(const conduit::Node &history,
   return output;
 }
 
+// the reductions of `field` the query batch computed ahead of this
+// evaluation (see field_reductions_batched), or nullptr. Only scalar
+// fields are batched
+const conduit::Node *
+batched_reductions(flow::Graph &graph, const std::string &field)
+{
+  flow::Registry &registry = graph.workspace().registry();
+  if(!registry.has_entry("batched_reductions"))
+  {
+    return nullptr;
+  }
+  const conduit::Node *reductions =
+    registry.fetch<conduit::Node>("batched_reductions");
+  if(!reductions->has_child(field))
+  {
+    return nullptr;
+  }
+  return &reductions->child(field);
+}
 
 } // namespace detail
 
@@ -1256,20 +1249,16 @@ ExprIdentifier::execute()
   conduit::Node *output = new conduit::Node();
   std::string i_name = params()["value"].as_string();
 
-  const conduit::Node *const cache =
-      graph().workspace().registry().fetch<Node>("cache");
-  if(!cache->has_path(i_name))
+  const ExpressionHistories *const cache =
+      graph().workspace().registry().fetch<ExpressionHistories>("cache");
+  const ExpressionHistory *history = cache->find(i_name);
+  if(history == nullptr)
   {
     ASCENT_ERROR("Unknown expression identifier: '" << i_name << "'");
   }
 
-  const int entries = (*cache)[i_name].number_of_children();
-  if(entries < 1)
-  {
-    ASCENT_ERROR("Expression identifier: needs at least one entry");
-  }
   // grab the last one calculated so we have type info
-  (*output) = (*cache)[i_name].child(entries - 1);
+  (*output) = history->result(history->size() - 1);
   // we need to keep the name to retrieve the cache
   // if history is called.
   (*output)["name"] = i_name;
@@ -2438,14 +2427,14 @@ ExprHistory::execute()
 
   const std::string expr_name  = (*input<Node>("expr_name"))["name"].as_string();
 
-  const conduit::Node *const cache =
-      graph().workspace().registry().fetch<Node>("cache");
+  const ExpressionHistories *const cache =
+      graph().workspace().registry().fetch<ExpressionHistories>("cache");
 
-  if(!cache->has_path(expr_name))
+  if(cache->find(expr_name) == nullptr)
   {
     ASCENT_ERROR("History: unknown identifier "<<  expr_name);
   }
-  const conduit::Node &history = (*cache)[expr_name];
+  const ExpressionHistory &history = *cache->find(expr_name);
 
   const conduit::Node *n_absolute_index = input<Node>("absolute_index");
   const conduit::Node *n_relative_index = input<Node>("relative_index");
@@ -2459,7 +2448,7 @@ ExprHistory::execute()
   }
 
 
-  const int entries = history.number_of_children();
+  const int entries = history.size();
   if(!n_relative_index->dtype().is_empty())
   {
     int relative_index = (*n_relative_index)["value"].to_int32();
@@ -2473,7 +2462,7 @@ ExprHistory::execute()
       ASCENT_ERROR("History: relative_index must be a non-negative integer.");
     }
     // grab the value from relative_index cycles ago
-    (*output) = history.child(entries - relative_index - 1);
+    (*output) = history.result(entries - relative_index - 1);
   }
   else
   {
@@ -2497,7 +2486,7 @@ ExprHistory::execute()
       ASCENT_ERROR("History: absolute_index must be a non-negative integer.");
     }
 
-    (*output) = history.child(absolute_index);
+    (*output) = history.result(absolute_index);
   }
 
   resolve_symbol_result(graph(), output, this->name());
@@ -2555,14 +2544,14 @@ ExprHistoryRange::execute()
   const string operator_name = "HistoryRange";
   const std::string expr_name  = (*input<conduit::Node>("expr_name"))["name"].as_string();
 
-  const conduit::Node *const cache =
-      graph().workspace().registry().fetch<conduit::Node>("cache");
+  const ExpressionHistories *const cache =
+      graph().workspace().registry().fetch<ExpressionHistories>("cache");
 
-  if(!cache->has_path(expr_name))
+  if(cache->find(expr_name) == nullptr)
   {
     ASCENT_ERROR(operator_name + ": unknown identifier "<<  expr_name);
   }
-  const conduit::Node &history = (*cache)[expr_name];
+  const ExpressionHistory &history = *cache->find(expr_name);
 
   const conduit::Node *n_first_absolute_index = input<conduit::Node>("first_absolute_index");
   const conduit::Node *n_last_absolute_index  = input<conduit::Node>("last_absolute_index");
@@ -2633,10 +2622,10 @@ ExprHistoryGradient::execute()
   conduit::Node &n_window_length = *input<Node>("window_length");
   conduit::Node &n_window_length_unit = *input<Node>("window_length_unit");
 
-  const conduit::Node *const cache =
-      graph().workspace().registry().fetch<Node>("cache");
+  const ExpressionHistories *const cache =
+      graph().workspace().registry().fetch<ExpressionHistories>("cache");
 
-  if(!cache->has_path(expr_name))
+  if(cache->find(expr_name) == nullptr)
   {
     ASCENT_ERROR("ScalarGradient: unknown identifier "<<  expr_name);
   }
@@ -2673,9 +2662,9 @@ ExprHistoryGradient::execute()
      ASCENT_ERROR("HistoryGradient: window_length must be at least 1 if the window length unit is \"index\" or \"cycle\"." );
   }
 
-  const conduit::Node &history = (*cache)[expr_name];
+  const ExpressionHistory &history = *cache->find(expr_name);
 
-  const int entries = history.number_of_children();
+  const int entries = history.size();
   if(entries < 2)
   {
     (*output)["value"] = -std::numeric_limits<double>::infinity();
@@ -2700,23 +2689,22 @@ ExprHistoryGradient::execute()
   }
   else if(time)
   {
-   string time_path = "time";
-   if(!history.child(current_index).has_path(time_path))
+    if(!history.has_time(current_index))
     {
-      ASCENT_ERROR("HistoryGradient: internal error. current time point does not have the child " + time_path);
+      ASCENT_ERROR("HistoryGradient: internal error. current time point does not have the child time");
     }
-    const double current_time = history.child(current_index)[time_path].to_float64();
+    const double current_time = history.time(current_index);
     const double first_time = current_time - window_length;
     double time;
     for(int index = 0; index < entries; index++)
     {
-      if(history.child(index).has_path(time_path))
+      if(history.has_time(index))
       {
-        time = history.child(index)[time_path].to_float64();
+        time = history.time(index);
       }
       else
       {
-        ASCENT_ERROR("HistoryGradient: a time point in evaluation window (for the calculation at absolute index: " + to_string(index) + ") does not have the child " + time_path );
+        ASCENT_ERROR("HistoryGradient: a time point in evaluation window (for the calculation at absolute index: " + to_string(index) + ") does not have the child time");
       }
       if(time >= first_time) {
         first_index = index;
@@ -2728,21 +2716,13 @@ ExprHistoryGradient::execute()
   }
   else if(cycles)
   {
-    vector<string> child_names = history.child_names();
-    if(child_names.size() != entries)
-    {
-      ASCENT_ERROR("HistoryGradient: internal error. number of history "
-                   <<"entries: " << to_string(entries)
-                   <<", but number of history child names: "
-                   <<to_string(child_names.size()));
-    }
-    const unsigned long long current_cycle = stoull(child_names[current_index]);
-    const unsigned long long first_cycle = current_cycle - window_length;
+    const long long current_cycle = history.cycle(current_index);
+    const long long first_cycle = current_cycle - window_length;
 
-    unsigned long long cycle;
+    long long cycle;
     for(int index = 0; index < entries; index++)
     {
-      cycle = stoull(child_names[index]);
+      cycle = history.cycle(index);
       if(cycle >= first_cycle)
       {
         first_index = index;
@@ -2753,22 +2733,12 @@ ExprHistoryGradient::execute()
     }
   }
 
-  string value_path = "";
-  vector<string> value_paths = {"value", "attrs/value/value"};
   if(current_index < 0 || current_index >= entries)
   {
     ASCENT_ERROR("HistoryGradient: bad current index: "<<current_index);
   }
-  for(const string &path : value_paths)
-  {
-    if(history.child(current_index).has_path(path))
-    {
-      value_path = path;
-      break;
-    }
-  }
 
-  if(value_path.size() == 0)
+  if(history.value_dtype(current_index) == conduit::DataType::EMPTY_ID)
   {
     ASCENT_ERROR("HistoryGradient: internal error. current index does not "
                   <<"have one of the expected value paths");
@@ -2779,8 +2749,8 @@ ExprHistoryGradient::execute()
     ASCENT_ERROR("HistoryGradient: bad first index: "<<first_index);
   }
 
-  double first_value = history.child(first_index)[value_path].to_float64();
-  double current_value = history.child(current_index)[value_path].to_float64();
+  double first_value = history.value(first_index);
+  double current_value = history.value(current_index);
 
   // dy / dx
   double gradient = (current_value - first_value) / window_length;
@@ -2841,14 +2811,14 @@ ExprHistoryGradientRange::execute()
 
   const std::string expr_name  = (*input<conduit::Node>("expr_name"))["name"].as_string();
 
-  const conduit::Node *const cache =
-      graph().workspace().registry().fetch<conduit::Node>("cache");
+  const ExpressionHistories *const cache =
+      graph().workspace().registry().fetch<ExpressionHistories>("cache");
 
-  if(!cache->has_path(expr_name))
+  if(cache->find(expr_name) == nullptr)
   {
     ASCENT_ERROR(operator_name + ": unknown identifier "<<  expr_name);
   }
-  const conduit::Node &history = (*cache)[expr_name];
+  const ExpressionHistory &history = *cache->find(expr_name);
 
   const conduit::Node *n_first_absolute_index = input<conduit::Node>("first_absolute_index");
   const conduit::Node *n_last_absolute_index = input<conduit::Node>("last_absolute_index");
@@ -4017,14 +3987,22 @@ ExprMeshFieldReductionMin::execute()
     graph().workspace().registry().fetch<DataObject>("dataset");
   const conduit::Node *const dataset = data_object->as_low_order_bp().get();
 
-  if(!is_scalar_field(*dataset, field))
+  conduit::Node n_min;
+  const conduit::Node *batched = detail::batched_reductions(graph(), field);
+  if(batched != nullptr)
   {
-    ASCENT_ERROR("ExprFieldReductionMin: field '"
-                 << field << "' is not a scalar field");
+    n_min = (*batched)["min"];
+  }
+  else
+  {
+    if(!is_scalar_field(*dataset, field))
+    {
+      ASCENT_ERROR("ExprFieldReductionMin: field '"
+                   << field << "' is not a scalar field");
+    }
+    // TODO
+    n_min = field_min(*dataset, field);
   }
-
-  // TODO
-  conduit::Node n_min = field_min(*dataset, field);
 
   (*output)["type"] = "value_position";
   (*output)["attrs/value/value"] = n_min["value"];
@@ -4091,12 +4069,20 @@ ExprMeshFieldReductionMax::execute()
     graph().workspace().registry().fetch<DataObject>("dataset");
   const conduit::Node *const dataset = data_object->as_low_order_bp().get();
 
-  if(!is_scalar_field(*dataset, field))
+  conduit::Node n_max;
+  const conduit::Node *batched = detail::batched_reductions(graph(), field);
+  if(batched != nullptr)
   {
-    ASCENT_ERROR("FieldMax: field '" << field << "' is not a scalar field");
+    n_max = (*batched)["max"];
+  }
+  else
+  {
+    if(!is_scalar_field(*dataset, field))
+    {
+      ASCENT_ERROR("FieldMax: field '" << field << "' is not a scalar field");
+    }
+    n_max = field_max(*dataset, field);
   }
-
-  conduit::Node n_max = field_max(*dataset, field);
 
   (*output)["type"] = "value_position";
   (*output)["attrs/value/value"] = n_max["value"];
@@ -4161,14 +4147,22 @@ ExprMeshFieldReductionAvg::execute()
     graph().workspace().registry().fetch<DataObject>("dataset");
   const conduit::Node *const dataset = data_object->as_low_order_bp().get();
 
-  if(!is_scalar_field(*dataset, field))
+  const conduit::Node *batched = detail::batched_reductions(graph(), field);
+  if(batched != nullptr)
   {
-    ASCENT_ERROR("FieldAvg: field '" << field << "' is not a scalar field");
+    const conduit::Node &n_sum = (*batched)["sum"];
+    (*output)["value"] = n_sum["value"].to_float64() /
+                         n_sum["count"].to_float64();
+  }
+  else
+  {
+    if(!is_scalar_field(*dataset, field))
+    {
+      ASCENT_ERROR("FieldAvg: field '" << field << "' is not a scalar field");
+    }
+    conduit::Node n_avg = field_avg(*dataset, field);
+    (*output)["value"] = n_avg["value"];
   }
-
-  conduit::Node n_avg = field_avg(*dataset, field);
-
-  (*output)["value"] = n_avg["value"];
   (*output)["type"] = "double";
 
   resolve_symbol_result(graph(), output, this->name());
@@ -4220,7 +4214,15 @@ ExprMeshFieldReductionSum::execute()
   const conduit::Node *const dataset = data_object->as_low_order_bp().get();
 
   conduit::Node *output = new conduit::Node();
-  (*output)["value"] = field_sum(*dataset, field)["value"];
+  const conduit::Node *batched = detail::batched_reductions(graph(), field);
+  if(batched != nullptr)
+  {
+    (*output)["value"] = (*batched)["sum/value"];
+  }
+  else
+  {
+    (*output)["value"] = field_sum(*dataset, field)["value"];
+  }
   (*output)["type"] = "double";
 
   resolve_symbol_result(graph(), output, this->name());
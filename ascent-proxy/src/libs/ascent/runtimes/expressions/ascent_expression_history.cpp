@@ -0,0 +1,452 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_expression_history.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_expression_history.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+namespace expressions
+{
+
+//-----------------------------------------------------------------------------
+ExpressionHistory::ExpressionHistory()
+  : m_last_sequence(0),
+    m_head(0),
+    m_size(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+int
+ExpressionHistory::size() const
+{
+  return m_size;
+}
+
+//-----------------------------------------------------------------------------
+int
+ExpressionHistory::slot(const int index) const
+{
+  return (m_head + index) % (int) m_cycles.size();
+}
+
+//-----------------------------------------------------------------------------
+const conduit::Node &
+ExpressionHistory::result(const int index) const
+{
+  return *m_results[slot(index)];
+}
+
+//-----------------------------------------------------------------------------
+conduit::int64
+ExpressionHistory::cycle(const int index) const
+{
+  return m_cycles[slot(index)];
+}
+
+//-----------------------------------------------------------------------------
+bool
+ExpressionHistory::has_time(const int index) const
+{
+  return !std::isnan(m_times[slot(index)]);
+}
+
+//-----------------------------------------------------------------------------
+double
+ExpressionHistory::time(const int index) const
+{
+  return m_times[slot(index)];
+}
+
+//-----------------------------------------------------------------------------
+double
+ExpressionHistory::value(const int index) const
+{
+  return m_values[slot(index)];
+}
+
+//-----------------------------------------------------------------------------
+conduit::index_t
+ExpressionHistory::value_dtype(const int index) const
+{
+  return m_value_dtypes[slot(index)];
+}
+
+//-----------------------------------------------------------------------------
+conduit::uint64
+ExpressionHistory::sequence(const int index) const
+{
+  return m_sequences[slot(index)];
+}
+
+//-----------------------------------------------------------------------------
+conduit::uint64
+ExpressionHistory::last_sequence() const
+{
+  return m_size > 0 ? m_last_sequence : 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistory::set_slot(const int slot,
+                            const conduit::int64 cycle,
+                            const conduit::Node &result,
+                            const conduit::uint64 sequence)
+{
+  m_cycles[slot] = cycle;
+  m_sequences[slot] = sequence;
+  m_last_sequence = std::max(m_last_sequence, sequence);
+  m_results[slot]->set(result);
+
+  m_times[slot] = result.has_path("time") ?
+                  result.fetch_existing("time").to_float64() :
+                  std::numeric_limits<double>::quiet_NaN();
+
+  // same lookup order the history functions always used
+  const conduit::Node *n_value = nullptr;
+  if(result.has_path("value"))
+  {
+    n_value = &result.fetch_existing("value");
+  }
+  else if(result.has_path("attrs/value/value"))
+  {
+    n_value = &result.fetch_existing("attrs/value/value");
+  }
+
+  if(n_value != nullptr && n_value->dtype().is_number())
+  {
+    m_values[slot] = n_value->to_float64();
+    m_value_dtypes[slot] = n_value->dtype().id();
+  }
+  else
+  {
+    m_values[slot] = std::numeric_limits<double>::quiet_NaN();
+    m_value_dtypes[slot] = conduit::DataType::EMPTY_ID;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistory::linearize()
+{
+  if(m_head != 0)
+  {
+    std::rotate(m_cycles.begin(), m_cycles.begin() + m_head, m_cycles.end());
+    std::rotate(m_times.begin(), m_times.begin() + m_head, m_times.end());
+    std::rotate(m_values.begin(), m_values.begin() + m_head, m_values.end());
+    std::rotate(m_value_dtypes.begin(),
+                m_value_dtypes.begin() + m_head,
+                m_value_dtypes.end());
+    std::rotate(m_results.begin(), m_results.begin() + m_head, m_results.end());
+    std::rotate(m_sequences.begin(),
+                m_sequences.begin() + m_head,
+                m_sequences.end());
+    m_head = 0;
+  }
+  m_cycles.resize(m_size);
+  m_times.resize(m_size);
+  m_values.resize(m_size);
+  m_value_dtypes.resize(m_size);
+  m_results.resize(m_size);
+  m_sequences.resize(m_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistory::trim(const int capacity)
+{
+  if(capacity <= 0 || m_size <= capacity)
+  {
+    return;
+  }
+  linearize();
+  const int drop = m_size - capacity;
+  m_cycles.erase(m_cycles.begin(), m_cycles.begin() + drop);
+  m_times.erase(m_times.begin(), m_times.begin() + drop);
+  m_values.erase(m_values.begin(), m_values.begin() + drop);
+  m_value_dtypes.erase(m_value_dtypes.begin(), m_value_dtypes.begin() + drop);
+  m_results.erase(m_results.begin(), m_results.begin() + drop);
+  m_sequences.erase(m_sequences.begin(), m_sequences.begin() + drop);
+  m_size = capacity;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistory::record(const conduit::int64 cycle,
+                          const conduit::Node &result,
+                          const int capacity,
+                          const conduit::uint64 sequence)
+{
+  // an expression evaluated again in the same cycle replaces its entry.
+  // cycles only go backwards when a simulation restarts without time
+  if(m_size > 0 && cycle <= this->cycle(m_size - 1))
+  {
+    for(int i = m_size - 1; i >= 0; --i)
+    {
+      if(this->cycle(i) == cycle)
+      {
+        set_slot(slot(i), cycle, result, sequence);
+        return;
+      }
+    }
+  }
+
+  trim(capacity);
+
+  if(capacity > 0 && m_size == capacity)
+  {
+    // full ring, the newest entry takes the place of the oldest
+    if((int) m_cycles.size() != m_size)
+    {
+      linearize();
+    }
+    set_slot(m_head, cycle, result, sequence);
+    m_head = (m_head + 1) % m_size;
+    return;
+  }
+
+  if(m_size < (int) m_cycles.size())
+  {
+    // reuse a slot freed by truncate
+    set_slot(slot(m_size), cycle, result, sequence);
+    m_size++;
+    return;
+  }
+
+  linearize();
+  m_cycles.push_back(cycle);
+  m_times.push_back(0.);
+  m_values.push_back(0.);
+  m_value_dtypes.push_back(conduit::DataType::EMPTY_ID);
+  m_results.push_back(std::unique_ptr<conduit::Node>(new conduit::Node()));
+  m_sequences.push_back(0);
+  set_slot(m_size, cycle, result, sequence);
+  m_size++;
+}
+
+//-----------------------------------------------------------------------------
+int
+ExpressionHistory::truncate(const double ftime)
+{
+  int removed = 0;
+  while(m_size > 0)
+  {
+    const int last = slot(m_size - 1);
+    // entries without a time can't be reasoned about, so they go too
+    if(!std::isnan(m_times[last]) && m_times[last] < ftime)
+    {
+      break;
+    }
+    m_results[last]->reset();
+    m_size--;
+    removed++;
+  }
+  return removed;
+}
+
+//-----------------------------------------------------------------------------
+ExpressionHistories::ExpressionHistories()
+  : m_sequence(0),
+    m_capacity(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+const ExpressionHistory *
+ExpressionHistories::find(const std::string &name) const
+{
+  auto it = m_histories.find(name);
+  if(it == m_histories.end() || it->second.size() == 0)
+  {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+//-----------------------------------------------------------------------------
+const std::vector<std::string> &
+ExpressionHistories::names() const
+{
+  return m_names;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::record(const std::string &name,
+                            const conduit::int64 cycle,
+                            const conduit::Node &result)
+{
+  auto it = m_histories.find(name);
+  if(it == m_histories.end())
+  {
+    m_names.push_back(name);
+    it = m_histories.emplace(name, ExpressionHistory()).first;
+  }
+  it->second.record(cycle, result, m_capacity, ++m_sequence);
+}
+
+//-----------------------------------------------------------------------------
+conduit::uint64
+ExpressionHistories::sequence() const
+{
+  return m_sequence;
+}
+
+//-----------------------------------------------------------------------------
+int
+ExpressionHistories::capacity() const
+{
+  return m_capacity;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::capacity(const int capacity)
+{
+  m_capacity = std::max(capacity, 0);
+  for(auto &history : m_histories)
+  {
+    history.second.trim(m_capacity);
+  }
+}
+
+//-----------------------------------------------------------------------------
+int
+ExpressionHistories::truncate(const double ftime)
+{
+  int removed = 0;
+  std::vector<std::string> names;
+  for(const std::string &name : m_names)
+  {
+    ExpressionHistory &history = m_histories[name];
+    removed += history.truncate(ftime);
+    if(history.size() == 0)
+    {
+      m_histories.erase(name);
+    }
+    else
+    {
+      names.push_back(name);
+    }
+  }
+  m_names.swap(names);
+  return removed;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::reset()
+{
+  m_names.clear();
+  m_histories.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::to_node(conduit::Node &data) const
+{
+  to_node(data, m_names);
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::to_node(conduit::Node &data,
+                             const std::vector<std::string> &selection) const
+{
+  for(const std::string &name : selection)
+  {
+    const ExpressionHistory *history = find(name);
+    if(history == nullptr)
+    {
+      continue;
+    }
+    conduit::Node &n_history = data[name];
+    for(int i = 0; i < history->size(); ++i)
+    {
+      n_history[std::to_string(history->cycle(i))].set(history->result(i));
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::last_to_node(conduit::Node &data) const
+{
+  for(const std::string &name : m_names)
+  {
+    const ExpressionHistory *history = find(name);
+    if(history == nullptr)
+    {
+      continue;
+    }
+    const int last = history->size() - 1;
+    data[name][std::to_string(history->cycle(last))].set(history->result(last));
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+ExpressionHistories::from_node(const conduit::Node &data)
+{
+  for(int i = 0; i < data.number_of_children(); ++i)
+  {
+    const conduit::Node &n_history = data.child(i);
+    for(int c = 0; c < n_history.number_of_children(); ++c)
+    {
+      const conduit::Node &n_result = n_history.child(c);
+      const std::string cycle_str = n_result.name();
+      char *end = nullptr;
+      const conduit::int64 cycle = std::strtoll(cycle_str.c_str(), &end, 10);
+      if(cycle_str.empty() || *end != '\0')
+      {
+        continue;
+      }
+      record(n_history.name(), cycle, n_result);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
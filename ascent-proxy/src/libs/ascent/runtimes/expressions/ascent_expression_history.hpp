@@ -0,0 +1,168 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_expression_history.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_EXPRESSION_HISTORY_HPP
+#define ASCENT_EXPRESSION_HISTORY_HPP
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+namespace expressions
+{
+
+// The past results of one expression. Cycles, times, and scalar values
+// live in contiguous columns next to the full result records, all laid
+// out as one ring. Index 0 is the oldest retained entry and size() - 1
+// the newest, so relative lookups and range slices never walk a tree.
+class ASCENT_API ExpressionHistory
+{
+public:
+  ExpressionHistory();
+  ExpressionHistory(ExpressionHistory &&) = default;
+  ExpressionHistory(const ExpressionHistory &) = delete;
+  ExpressionHistory &operator=(const ExpressionHistory &) = delete;
+
+  int size() const;
+
+  const conduit::Node &result(const int index) const;
+  conduit::int64 cycle(const int index) const;
+  bool has_time(const int index) const;
+  double time(const int index) const;
+  // the scalar found at "value" or "attrs/value/value" of a result,
+  // value_dtype is DataType::EMPTY_ID when the result has no number there
+  double value(const int index) const;
+  conduit::index_t value_dtype(const int index) const;
+  // when the entry was recorded, see ExpressionHistories::sequence
+  conduit::uint64 sequence(const int index) const;
+  // the newest sequence of any entry, 0 if there are none
+  conduit::uint64 last_sequence() const;
+
+  // replaces the entry for cycle if present, otherwise appends one.
+  // A capacity > 0 drops the oldest entries beyond it.
+  void record(const conduit::int64 cycle,
+              const conduit::Node &result,
+              const int capacity,
+              const conduit::uint64 sequence);
+
+  // drops the oldest entries beyond capacity (if > 0)
+  void trim(const int capacity);
+
+  // drops the newest entries until one has a time before ftime,
+  // returns the number of dropped entries
+  int truncate(const double ftime);
+
+private:
+  int slot(const int index) const;
+  void linearize();
+  void set_slot(const int slot,
+                const conduit::int64 cycle,
+                const conduit::Node &result,
+                const conduit::uint64 sequence);
+
+  std::vector<conduit::int64> m_cycles;
+  std::vector<double> m_times;
+  std::vector<double> m_values;
+  std::vector<conduit::index_t> m_value_dtypes;
+  std::vector<std::unique_ptr<conduit::Node>> m_results;
+  std::vector<conduit::uint64> m_sequences;
+  conduit::uint64 m_last_sequence;
+  int m_head;
+  int m_size;
+};
+
+// All expression histories, in the order they were first recorded.
+class ASCENT_API ExpressionHistories
+{
+public:
+  ExpressionHistories();
+  ExpressionHistories(const ExpressionHistories &) = delete;
+  ExpressionHistories &operator=(const ExpressionHistories &) = delete;
+
+  // nullptr if nothing was recorded under name
+  const ExpressionHistory *find(const std::string &name) const;
+  const std::vector<std::string> &names() const;
+
+  void record(const std::string &name,
+              const conduit::int64 cycle,
+              const conduit::Node &result);
+  // counts every record, so anything with a larger sequence
+  // than a previous value was recorded after it was taken.
+  // Never goes back, not even on reset
+  conduit::uint64 sequence() const;
+
+  // max entries kept per expression, 0 keeps everything
+  int capacity() const;
+  void capacity(const int capacity);
+
+  // drops all entries at or after ftime (or without a time) and the
+  // histories left empty, returns the number of dropped entries
+  int truncate(const double ftime);
+  void reset();
+
+  // the tree layout used by session files and info: name/cycle/result
+  void to_node(conduit::Node &data) const;
+  void to_node(conduit::Node &data,
+               const std::vector<std::string> &selection) const;
+  // name/cycle with the newest result of every expression
+  void last_to_node(conduit::Node &data) const;
+  // records every name/cycle/result in data
+  void from_node(const conduit::Node &data);
+
+private:
+  std::vector<std::string> m_names;
+  std::unordered_map<std::string, ExpressionHistory> m_histories;
+  conduit::uint64 m_sequence;
+  int m_capacity;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "ascent_expressions_ast.hpp"
 #include "ascent_expression_jit_filters.hpp"
 #include "ascent_expression_filters.hpp"
+#include "ascent_expression_history.hpp"
 #include "ascent_expressions_parser.hpp"
 #include <array>
 #include <typeinfo>
@@ -369,6 +370,139 @@ PrintVisitor::visit(const ASTExpressionList &list)
 }
 //}}}
 
+//-----------------------------------------------------------------------------
+// -- ReducedFieldsVisitor
+//-----------------------------------------------------------------------------
+//{{{
+
+void
+ReducedFieldsVisitor::visit(const ASTBlock &block)
+{
+  for(auto stmt : *block.stmts)
+  {
+    stmt->accept(this);
+  }
+  block.expr->accept(this);
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTExpression &expr)
+{
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTInteger &expr)
+{
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTDouble &expr)
+{
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTIdentifier &expr)
+{
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTNamedExpression &expr)
+{
+  expr.value->accept(this);
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTMethodCall &call)
+{
+  const ASTArguments &args = *call.arguments;
+  const std::string &name = call.m_id->m_name;
+  if((name == "max" || name == "min" || name == "sum" || name == "avg") &&
+     args.pos_args != nullptr && args.pos_args->exprs.size() == 1 &&
+     (args.named_args == nullptr || args.named_args->empty()))
+  {
+    // only a literal field name can be reduced ahead of the evaluation
+    const ASTMethodCall *field_call =
+      dynamic_cast<const ASTMethodCall *>(args.pos_args->exprs[0]);
+    if(field_call != nullptr && field_call->m_id->m_name == "field")
+    {
+      const ASTArguments &field_args = *field_call->arguments;
+      if(field_args.pos_args != nullptr &&
+         field_args.pos_args->exprs.size() == 1 &&
+         (field_args.named_args == nullptr || field_args.named_args->empty()))
+      {
+        const ASTString *field_name =
+          dynamic_cast<const ASTString *>(field_args.pos_args->exprs[0]);
+        if(field_name != nullptr)
+        {
+          m_fields.push_back(
+            detail::strip_single_quotes(field_name->m_name));
+          return;
+        }
+      }
+    }
+  }
+
+  if(args.pos_args != nullptr)
+  {
+    args.pos_args->accept(this);
+  }
+  if(args.named_args != nullptr)
+  {
+    for(auto named_arg : *args.named_args)
+    {
+      named_arg->accept(this);
+    }
+  }
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTIfExpr &expr)
+{
+  expr.m_condition->accept(this);
+  expr.m_if->accept(this);
+  expr.m_else->accept(this);
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTBinaryOp &expr)
+{
+  expr.m_lhs->accept(this);
+  expr.m_rhs->accept(this);
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTString &expr)
+{
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTBoolean &expr)
+{
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTArrayAccess &expr)
+{
+  expr.array->accept(this);
+  expr.index->accept(this);
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTDotAccess &expr)
+{
+  expr.obj->accept(this);
+}
+
+void
+ReducedFieldsVisitor::visit(const ASTExpressionList &list)
+{
+  for(auto expr : list.exprs)
+  {
+    expr->accept(this);
+  }
+}
+//}}}
+
 //-----------------------------------------------------------------------------
 // -- BuildGraphVisitor
 //-----------------------------------------------------------------------------
@@ -504,13 +638,15 @@ BuildGraphVisitor::visit(const ASTIdentifier &expr)
   }
 
   // get identifier type from cache
-  conduit::Node *cache = w.registry().fetch<conduit::Node>("cache");
-  if(!cache->has_path(expr.m_name))
+  const ExpressionHistories *cache =
+    w.registry().fetch<ExpressionHistories>("cache");
+  const ExpressionHistory *history = cache->find(expr.m_name);
+  if(history == nullptr)
   {
     ASCENT_ERROR("Unknown expression identifier: '" << expr.m_name << "'");
   }
 
-  const int entries = (*cache)[expr.m_name].number_of_children();
+  const int entries = history->size();
   if(entries < 1)
   {
     ASCENT_ERROR("Expression identifier: needs a non-zero number of entries: "
@@ -524,8 +660,12 @@ BuildGraphVisitor::visit(const ASTIdentifier &expr)
 
   output["filter_name"] = name;
   // grab the last one calculated
-  output["type"] = (*cache)[expr.m_name].child(entries - 1)["type"];
+  const conduit::Node &last = history->result(history->size() - 1);
+  output["type"] = last.has_child("type") ? last["type"] : conduit::Node();
   subexpr_cache[name] = output;
+  // names are not paths, so don't let conduit split them
+  identifiers.add_child(expr.m_name) =
+    last.has_child("type") ? last["type"].as_string() : "";
 }
 
 //-----------------------------------------------------------------------------
@@ -330,6 +330,35 @@ public:
 //-----------------------------------------------------------------------------
 // main visitor that builds a flow graph from a parsed AST
 //-----------------------------------------------------------------------------
+// collects the fields reduced whole by max, min, sum, or avg calls on a
+// field literal, e.g. max(field('energy')), once per call
+class ReducedFieldsVisitor final : public ASTVisitor
+{
+public:
+  void visit(const ASTBlock &block) override;
+  void visit(const ASTExpression &expr) override;
+  void visit(const ASTInteger &expr) override;
+  void visit(const ASTDouble &expr) override;
+  void visit(const ASTIdentifier &expr) override;
+  void visit(const ASTNamedExpression &expr) override;
+  void visit(const ASTMethodCall &call) override;
+  void visit(const ASTIfExpr &expr) override;
+  void visit(const ASTBinaryOp &expr) override;
+  void visit(const ASTString &expr) override;
+  void visit(const ASTBoolean &expr) override;
+  void visit(const ASTArrayAccess &expr) override;
+  void visit(const ASTDotAccess &expr) override;
+  void visit(const ASTExpressionList &list) override;
+
+  const std::vector<std::string> &fields() const
+  {
+    return m_fields;
+  }
+
+private:
+  std::vector<std::string> m_fields;
+};
+
 class BuildGraphVisitor final : public ASTVisitor
 {
 public:
@@ -364,6 +393,13 @@ public:
     //return subexpr_cache;
   }
 
+  // the types the identifiers of cached expressions had when the
+  // graph was built, keyed by identifier name
+  const conduit::Node &identifier_types() const
+  {
+    return identifiers;
+  }
+
 private:
   flow::Workspace &w;
   const bool verbose;
@@ -375,6 +411,7 @@ private:
   const std::shared_ptr<const expressions::JitExecutionPolicy> exec_policy;
   // we only have one scope so no need for a stack of symbol tables
   conduit::Node symbol_table;
+  conduit::Node identifiers;
 };
 
 #endif
@@ -0,0 +1,644 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_session_log.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_session_log.hpp"
+
+#include <ascent_config.h>
+#include <ascent_logging_old.hpp>
+#include <flow_workspace.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#if !defined(ASCENT_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef ASCENT_MPI_ENABLED
+#include <conduit_relay_mpi.hpp>
+#include <mpi.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+namespace expressions
+{
+
+namespace detail
+{
+
+const char log_magic[8] = {'A', 'S', 'C', 'N', 'T', 'L', 'O', 'G'};
+const conduit::uint32 log_version = 1;
+
+struct LogHeader
+{
+  char magic[8];
+  conduit::uint32 version;
+  conduit::uint32 reserved;
+};
+
+enum EntryKind : conduit::uint32
+{
+  SCHEMA_ENTRY = 1,
+  RECORD_ENTRY = 2
+};
+
+// followed by text (schema json or expression name) and data,
+// each padded to 8 bytes
+struct EntryHeader
+{
+  conduit::uint32 kind;
+  conduit::uint32 schema_id;
+  conduit::int64 cycle;
+  conduit::uint64 text_bytes;
+  conduit::uint64 data_bytes;
+};
+
+conduit::uint64
+padded(const conduit::uint64 bytes)
+{
+  return (bytes + 7) & ~conduit::uint64(7);
+}
+
+// a read only view of a whole file, memory mapped where we can
+class MappedFile
+{
+public:
+  MappedFile()
+    : m_data(nullptr),
+      m_size(0)
+  {
+  }
+
+  ~MappedFile()
+  {
+    close();
+  }
+
+  bool open(const std::string &path)
+  {
+    close();
+#if defined(ASCENT_PLATFORM_WINDOWS)
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if(!in.is_open())
+    {
+      return false;
+    }
+    m_buffer.resize((size_t) in.tellg());
+    in.seekg(0);
+    in.read((char *) m_buffer.data(), m_buffer.size());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return m_size > 0;
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+      return false;
+    }
+    struct stat file_info;
+    if(fstat(fd, &file_info) != 0 || file_info.st_size == 0)
+    {
+      ::close(fd);
+      return false;
+    }
+    void *data = mmap(nullptr, file_info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(data == MAP_FAILED)
+    {
+      return false;
+    }
+    m_data = (const conduit::uint8 *) data;
+    m_size = file_info.st_size;
+    return true;
+#endif
+  }
+
+  void close()
+  {
+#if defined(ASCENT_PLATFORM_WINDOWS)
+    m_buffer.clear();
+#else
+    if(m_data != nullptr)
+    {
+      munmap(const_cast<conduit::uint8 *>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  const conduit::uint8 *data() const
+  {
+    return m_data;
+  }
+
+  conduit::uint64 size() const
+  {
+    return m_size;
+  }
+
+private:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+#if defined(ASCENT_PLATFORM_WINDOWS)
+  std::vector<conduit::uint8> m_buffer;
+#endif
+  const conduit::uint8 *m_data;
+  conduit::uint64 m_size;
+};
+
+conduit::uint64
+file_size(const std::string &path)
+{
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if(!in.is_open())
+  {
+    return 0;
+  }
+  return (conduit::uint64) in.tellg();
+}
+
+void
+note_record(conduit::Node &expressions,
+            const std::string &name,
+            const conduit::int64 cycle)
+{
+  conduit::Node &n_expr = expressions.add_child(name);
+  conduit::int64 entries = 0;
+  if(n_expr.has_child("entries"))
+  {
+    entries = n_expr["entries"].to_int64();
+  }
+  n_expr["entries"] = entries + 1;
+  n_expr["last_cycle"] = cycle;
+}
+
+conduit::uint64
+write_entry(std::ofstream &out,
+            const conduit::uint32 kind,
+            const conduit::uint32 schema_id,
+            const conduit::int64 cycle,
+            const std::string &text,
+            const std::vector<conduit::uint8> &data)
+{
+  static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  EntryHeader header;
+  header.kind = kind;
+  header.schema_id = schema_id;
+  header.cycle = cycle;
+  header.text_bytes = text.size();
+  header.data_bytes = data.size();
+  out.write((const char *) &header, sizeof(header));
+  out.write(text.data(), text.size());
+  out.write(zeros, padded(text.size()) - text.size());
+  out.write((const char *) data.data(), data.size());
+  out.write(zeros, padded(data.size()) - data.size());
+  return sizeof(header) + padded(text.size()) + padded(data.size());
+}
+
+// what a replayed log leaves behind for appending to it
+struct LogState
+{
+  std::map<std::string, conduit::uint32> schema_ids;
+  conduit::Node expressions;
+  conduit::uint64 bytes = 0;
+  conduit::uint64 entries = 0;
+};
+
+// records every complete entry in the first size bytes of a log.
+// The results are read in place, only their schemas are parsed
+bool
+replay(const conduit::uint8 *data,
+       const conduit::uint64 size,
+       ExpressionHistories &histories,
+       LogState &state)
+{
+  LogHeader header;
+  if(data == nullptr || size < sizeof(header))
+  {
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if(std::memcmp(header.magic, log_magic, sizeof(log_magic)) != 0 ||
+     header.version != log_version)
+  {
+    return false;
+  }
+
+  std::vector<conduit::Schema> schemas;
+  conduit::uint64 offset = sizeof(header);
+  while(offset + sizeof(EntryHeader) <= size)
+  {
+    EntryHeader entry;
+    std::memcpy(&entry, data + offset, sizeof(entry));
+    const conduit::uint64 text_offset = offset + sizeof(entry);
+    const conduit::uint64 data_offset = text_offset + padded(entry.text_bytes);
+    const conduit::uint64 next = data_offset + padded(entry.data_bytes);
+    if(next > size)
+    {
+      // an append that did not finish
+      break;
+    }
+
+    const std::string text((const char *) data + text_offset, entry.text_bytes);
+    if(entry.kind == SCHEMA_ENTRY)
+    {
+      state.schema_ids[text] = (conduit::uint32) schemas.size();
+      schemas.push_back(conduit::Schema(text));
+    }
+    else if(entry.kind == RECORD_ENTRY && entry.schema_id < schemas.size())
+    {
+      conduit::Node result;
+      result.set_external(schemas[entry.schema_id],
+                          const_cast<conduit::uint8 *>(data + data_offset));
+      histories.record(text, entry.cycle, result);
+      note_record(state.expressions, text, entry.cycle);
+      state.entries++;
+    }
+    else
+    {
+      break;
+    }
+    offset = next;
+  }
+  state.bytes = offset;
+  return true;
+}
+
+// the log bytes the index says are complete (at most size) and the
+// cache metadata it holds
+conduit::uint64
+read_index(const std::string &session,
+           const conduit::uint64 size,
+           conduit::Node &info)
+{
+  info.reset();
+  const std::string index_path = SessionLog::index_file(session);
+  if(!conduit::utils::is_file(index_path))
+  {
+    return size;
+  }
+  conduit::Node index;
+  index.load(index_path, "json");
+  conduit::uint64 committed = size;
+  if(index.has_child("committed_bytes"))
+  {
+    committed = std::min(size, index["committed_bytes"].to_uint64());
+  }
+  if(index.has_child("last_known_time"))
+  {
+    info["last_known_time"] = index["last_known_time"].to_float64();
+  }
+  if(index.has_child("ascent_cache_info"))
+  {
+    info["ascent_cache_info"] = index["ascent_cache_info"];
+  }
+  return committed;
+}
+
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+SessionLog::SessionLog(const std::string &session)
+  : m_session(session),
+    m_bytes(0),
+    m_entries(0),
+    m_sequence(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+std::string
+SessionLog::log_file(const std::string &session)
+{
+  return session + ".session_log";
+}
+
+//-----------------------------------------------------------------------------
+std::string
+SessionLog::index_file(const std::string &session)
+{
+  return session + ".session_index.json";
+}
+
+//-----------------------------------------------------------------------------
+bool
+SessionLog::load(ExpressionHistories &histories, conduit::Node &info)
+{
+  int rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  MPI_Comm_rank(mpi_comm, &rank);
+#endif
+
+  info.reset();
+  detail::MappedFile log;
+  const conduit::uint8 *data = nullptr;
+  conduit::uint64 size = 0;
+  if(rank == 0 && log.open(log_file(m_session)))
+  {
+    data = log.data();
+    size = detail::read_index(m_session, log.size(), info);
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  // one read of the file, the other ranks get the raw bytes
+  std::vector<conduit::uint8> buffer;
+  MPI_Bcast(&size, 1, MPI_UINT64_T, 0, mpi_comm);
+  if(size > 0)
+  {
+    if(rank != 0)
+    {
+      buffer.resize(size);
+      data = buffer.data();
+    }
+    const conduit::uint64 chunk = conduit::uint64(1) << 30;
+    for(conduit::uint64 offset = 0; offset < size; offset += chunk)
+    {
+      const int count = (int) std::min(chunk, size - offset);
+      MPI_Bcast(const_cast<conduit::uint8 *>(data) + offset,
+                count,
+                MPI_BYTE,
+                0,
+                mpi_comm);
+    }
+    conduit::relay::mpi::broadcast_using_schema(info, 0, mpi_comm);
+  }
+#endif
+
+  detail::LogState state;
+  if(size == 0 || !detail::replay(data, size, histories, state))
+  {
+    info.reset();
+    return false;
+  }
+
+  // appends continue where the log left off
+  m_selection.clear();
+  m_schema_ids.swap(state.schema_ids);
+  m_expressions.set(state.expressions);
+  m_bytes = state.bytes;
+  m_entries = state.entries;
+  m_sequence = histories.sequence();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+SessionLog::rewrite()
+{
+  m_schema_ids.clear();
+  m_expressions.reset();
+  m_bytes = 0;
+  m_entries = 0;
+  m_sequence = 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+SessionLog::append(const ExpressionHistories &histories,
+                   const std::vector<std::string> &selection,
+                   const conduit::Node &info)
+{
+  if(selection != m_selection)
+  {
+    m_selection = selection;
+    rewrite();
+  }
+  const std::vector<std::string> &names =
+    selection.empty() ? histories.names() : selection;
+
+  conduit::uint64 retained = 0;
+  for(const std::string &name : names)
+  {
+    const ExpressionHistory *history = histories.find(name);
+    if(history != nullptr)
+    {
+      retained += history->size();
+    }
+  }
+
+  const std::string log_path = log_file(m_session);
+  // bounded histories forget old entries but the log does not,
+  // so start over once most of it is gone from memory. Also start
+  // over if the file is not what we last wrote (e.g. a torn append)
+  if((histories.capacity() > 0 && m_entries > 2 * retained) ||
+     (m_bytes > 0 && detail::file_size(log_path) != m_bytes))
+  {
+    rewrite();
+  }
+
+  struct Pending
+  {
+    conduit::uint64 sequence;
+    const std::string *name;
+    const ExpressionHistory *history;
+    int index;
+  };
+  std::vector<Pending> pending;
+  for(const std::string &name : names)
+  {
+    const ExpressionHistory *history = histories.find(name);
+    if(history == nullptr || history->last_sequence() <= m_sequence)
+    {
+      continue;
+    }
+    for(int i = 0; i < history->size(); ++i)
+    {
+      if(history->sequence(i) > m_sequence)
+      {
+        pending.push_back({history->sequence(i), &name, history, i});
+      }
+    }
+  }
+  // replaying in record order gives back the same histories
+  std::sort(pending.begin(),
+            pending.end(),
+            [](const Pending &a, const Pending &b)
+            { return a.sequence < b.sequence; });
+
+  const bool fresh = m_bytes == 0;
+  if(fresh && pending.empty() && !info.has_child("ascent_cache_info"))
+  {
+    // nothing to save
+    return;
+  }
+
+  std::ofstream out(log_path,
+                    fresh ? std::ios::binary | std::ios::trunc
+                          : std::ios::binary | std::ios::app);
+  if(!out.is_open())
+  {
+    ASCENT_ERROR("Failed to open session log '" << log_path << "'");
+  }
+
+  if(fresh)
+  {
+    detail::LogHeader header;
+    std::memcpy(header.magic, detail::log_magic, sizeof(header.magic));
+    header.version = detail::log_version;
+    header.reserved = 0;
+    out.write((const char *) &header, sizeof(header));
+    m_bytes = sizeof(header);
+  }
+
+  const std::vector<conduit::uint8> no_data;
+  std::vector<conduit::uint8> data;
+  for(const Pending &entry : pending)
+  {
+    const conduit::Node &result = entry.history->result(entry.index);
+    const conduit::int64 cycle = entry.history->cycle(entry.index);
+
+    conduit::Schema schema;
+    result.schema().compact_to(schema);
+    const std::string schema_json = schema.to_json();
+    auto schema_id = m_schema_ids.find(schema_json);
+    if(schema_id == m_schema_ids.end())
+    {
+      const conduit::uint32 id = (conduit::uint32) m_schema_ids.size();
+      m_bytes += detail::write_entry(out,
+                                     detail::SCHEMA_ENTRY,
+                                     id,
+                                     0,
+                                     schema_json,
+                                     no_data);
+      schema_id = m_schema_ids.emplace(schema_json, id).first;
+    }
+
+    data.clear();
+    result.serialize(data);
+    m_bytes += detail::write_entry(out,
+                                   detail::RECORD_ENTRY,
+                                   schema_id->second,
+                                   cycle,
+                                   *entry.name,
+                                   data);
+    detail::note_record(m_expressions, *entry.name, cycle);
+    m_entries++;
+  }
+
+  out.close();
+  if(out.fail())
+  {
+    ASCENT_ERROR("Failed to write session log '" << log_path << "'");
+  }
+
+  m_sequence = histories.sequence();
+  write_index(info);
+}
+
+//-----------------------------------------------------------------------------
+void
+SessionLog::write_index(const conduit::Node &info) const
+{
+  conduit::Node index;
+  index["format"] = "ascent_session_log";
+  index["version"] = detail::log_version;
+  index["committed_bytes"] = m_bytes;
+  index["entries"] = m_entries;
+  if(m_expressions.number_of_children() > 0)
+  {
+    index["expressions"].set(m_expressions);
+  }
+  if(info.has_child("last_known_time"))
+  {
+    index["last_known_time"] = info["last_known_time"];
+  }
+  if(info.has_child("ascent_cache_info"))
+  {
+    index["ascent_cache_info"] = info["ascent_cache_info"];
+  }
+
+  // swap in the new index, readers never see a partial one
+  const std::string index_path = index_file(m_session);
+  const std::string tmp_path = index_path + ".tmp";
+  index.save(tmp_path, "json");
+  if(std::rename(tmp_path.c_str(), index_path.c_str()) != 0)
+  {
+    ASCENT_ERROR("Failed to write session index '" << index_path << "'");
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool
+SessionLog::to_yaml(const std::string &session, const std::string &yaml_file)
+{
+  detail::MappedFile log;
+  if(!log.open(log_file(session)))
+  {
+    return false;
+  }
+
+  conduit::Node info;
+  const conduit::uint64 size = detail::read_index(session, log.size(), info);
+
+  ExpressionHistories histories;
+  detail::LogState state;
+  if(!detail::replay(log.data(), size, histories, state))
+  {
+    return false;
+  }
+
+  conduit::Node data;
+  histories.to_node(data);
+  if(info.has_child("last_known_time"))
+  {
+    data["last_known_time"] = info["last_known_time"];
+  }
+  if(info.has_child("ascent_cache_info"))
+  {
+    data["ascent_cache_info"] = info["ascent_cache_info"];
+  }
+  data.save(yaml_file, "yaml");
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
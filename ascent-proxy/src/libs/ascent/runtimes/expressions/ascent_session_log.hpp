@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_session_log.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_SESSION_LOG_HPP
+#define ASCENT_SESSION_LOG_HPP
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+#include <expressions/ascent_expression_history.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+namespace expressions
+{
+
+// The session file: an append-only binary log of expression results
+// (<session>.session_log) and a small json index next to it
+// (<session>.session_index.json).
+//
+// The log is a header followed by entries. A schema entry holds the json
+// of a compact result schema, and a record entry holds the expression
+// name, the cycle, the id of its schema, and the raw result data. Each
+// distinct schema is written once per log, so a record costs its data
+// plus a fixed size header. Data is 8 byte aligned and native endian.
+//
+// The index is rewritten after each append. It has the number of log bytes
+// that are complete (anything past that is ignored when loading), the last
+// cycle of each expression, and the cache metadata (last_known_time and
+// ascent_cache_info).
+class ASCENT_API SessionLog
+{
+public:
+  SessionLog(const std::string &session);
+
+  static std::string log_file(const std::string &session);
+  static std::string index_file(const std::string &session);
+
+  // replays the log of the session into histories and returns the cache
+  // metadata in info. Rank 0 memory maps the log and broadcasts it.
+  // Returns false if the session has no log.
+  bool load(ExpressionHistories &histories, conduit::Node &info);
+
+  // appends the entries of the selected expressions (all of them if
+  // selection is empty) recorded since the last append, and rewrites the
+  // index with info. The first append, and the first after rewrite() or
+  // a change of selection, starts a new log with everything retained.
+  void append(const ExpressionHistories &histories,
+              const std::vector<std::string> &selection,
+              const conduit::Node &info);
+
+  // the next append starts a new log, used when entries were removed
+  void rewrite();
+
+  // writes a session log as the yaml tree (expr/cycle/result) that
+  // session files used to be, for humans and scripts
+  static bool to_yaml(const std::string &session,
+                      const std::string &yaml_file);
+
+private:
+  void write_index(const conduit::Node &info) const;
+
+  std::string m_session;
+  std::vector<std::string> m_selection;
+  // schema json -> id of the schema entry in the log
+  std::map<std::string, conduit::uint32> m_schema_ids;
+  // per expression entries and last cycle, for the index
+  conduit::Node m_expressions;
+  conduit::uint64 m_bytes;
+  conduit::uint64 m_entries;
+  // the histories sequence covered by the log
+  conduit::uint64 m_sequence;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
@@ -19,6 +19,12 @@
 //-----------------------------------------------------------------------------
 #include <flow_workspace.hpp>
 
+//-----------------------------------------------------------------------------
+// ascent includes
+//-----------------------------------------------------------------------------
+#include <ascent_runtime_utils.hpp>
+#include <expressions/ascent_blueprint_architect.hpp>
+
 using namespace conduit;
 using namespace std;
 
@@ -53,6 +59,7 @@ AscentPythonScript::declare_interface(Node &i)
     i["type_name"] = "ascent_python_script";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 
@@ -71,7 +78,44 @@ AscentPythonScript::execute()
 
     conduit::Node *n_input = data_object->as_node().get();
 
-    execute_python(n_input);
+    // state persists across cycles, namespaced by extract name
+    conduit::Node &state = filter_state(graph().workspace(), name());
+
+    // optional fused field statistics, handed to the script as one
+    // contiguous array in ascent_state()["features"]
+    if(params().has_child("features"))
+    {
+        conduit::Node features = expressions::field_features(*n_input,
+                                                             params()["features"]);
+        conduit::Node &n_features = state["features"];
+        const conduit::Node &n_values = features["values"];
+        const conduit::index_t num_values = n_values.dtype().number_of_elements();
+        // update in place when the layout is unchanged, so the state
+        // isn't reallocated every cycle
+        if(n_features.has_child("values") &&
+           n_features["values"].dtype().is_float64() &&
+           n_features["values"].dtype().number_of_elements() == num_values)
+        {
+            const conduit::float64_array src = n_values.value();
+            conduit::float64_array dst = n_features["values"].value();
+            for(conduit::index_t i = 0; i < num_values; ++i)
+            {
+                dst[i] = src[i];
+            }
+
+            conduit::Node diff_info;
+            if(n_features["names"].diff(features["names"], diff_info))
+            {
+                n_features["names"].set(features["names"]);
+            }
+        }
+        else
+        {
+            n_features.set(features);
+        }
+    }
+
+    execute_python(n_input, &state);
 }
 
 //-----------------------------------------------------------------------------
@@ -114,6 +114,7 @@ ADIOS2::declare_interface(Node &i)
     i["type_name"]   = "adios2";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -42,6 +42,7 @@ void ascent::runtime::filters::BFlowCompose::declare_interface(conduit::Node &i)
   i["type_name"] = "bflow_comp";
   i["port_names"].append() = "in";
   i["output_port"] = "false";  // true -- means filter, false -- means extract
+  i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -530,6 +530,7 @@ void ascent::runtime::filters::BFlowIso::declare_interface(conduit::Node &i)
   i["type_name"] = "bflow_iso";
   i["port_names"].append() = "in";
   i["output_port"] = "false";  // true -- means filter, false -- means extract
+  i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
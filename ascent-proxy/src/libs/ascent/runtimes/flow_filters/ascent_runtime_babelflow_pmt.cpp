@@ -1464,6 +1464,7 @@ void ascent::runtime::filters::BFlowPmt::declare_interface(conduit::Node &i)
   i["type_name"] = "bflow_pmt";
   i["port_names"].append() = "in";
   i["output_port"] = "true";  // true -- means filter, false -- means extract
+  i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -29,6 +29,7 @@
 #include <ascent_logging.hpp>
 #include <ascent_metadata.hpp>
 #include <runtimes/ascent_data_object.hpp>
+#include <runtimes/ascent_field_compression.hpp>
 #include <ascent_runtime_param_check.hpp>
 #include "expressions/ascent_expression_filters.hpp"
 #include "expressions/ascent_blueprint_architect.hpp"
@@ -103,6 +104,7 @@ BlueprintVerify::declare_interface(Node &i)
     i["type_name"]   = "blueprint_verify";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -239,6 +241,7 @@ ConduitExtract::declare_interface(Node &i)
     i["type_name"]   = "conduit_extract";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -247,9 +250,7 @@ ConduitExtract::verify_params(const conduit::Node &params,
                               conduit::Node &info)
 {
     info.reset();
-    bool res = true;
-
-    // so far, no params
+    bool res = verify_compression_params(params, info);
 
     return res;
 }
@@ -282,7 +283,19 @@ ConduitExtract::execute()
 
     Node &einfo = extract_list->append();
     einfo["type"] = "conduit";
-    einfo["data"].set(*n_input);
+    if(params().has_path("compression"))
+    {
+        Node compressed;
+        compress_fields(*n_input,
+                        params()["compression"],
+                        compressed,
+                        einfo["compression"]);
+        einfo["data"].set(compressed);
+    }
+    else
+    {
+        einfo["data"].set(*n_input);
+    }
 }
 
 
@@ -310,6 +323,7 @@ BlueprintPartition::declare_interface(Node &i)
     i["type_name"]   = "blueprint_data_partition";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -467,6 +481,7 @@ DataBinning::declare_interface(Node &i)
     i["type_name"]   = "data_binning";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -794,6 +809,7 @@ AddFields::declare_interface(Node &i)
     i["type_name"]   = "add_fields";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -902,6 +918,7 @@ PowerOfField::declare_interface(Node &i)
     i["type_name"]   = "power_of_field";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
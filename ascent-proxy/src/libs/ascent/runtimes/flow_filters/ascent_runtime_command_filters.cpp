@@ -78,6 +78,7 @@ Command::declare_interface(Node &i)
     i["type_name"] = "command";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
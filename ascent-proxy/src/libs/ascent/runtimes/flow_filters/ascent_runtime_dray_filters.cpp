@@ -1271,6 +1271,7 @@ DRayPseudocolor::declare_interface(Node &i)
     i["type_name"]   = "dray_pseudocolor";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1456,6 +1457,7 @@ DRay3Slice::declare_interface(Node &i)
     i["type_name"]   = "dray_3slice";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1851,6 +1853,7 @@ DRayVolume::declare_interface(Node &i)
     i["type_name"]   = "dray_volume";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -2065,6 +2068,7 @@ DRayReflect::declare_interface(Node &i)
     i["type_name"]   = "dray_reflect";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -2177,6 +2181,7 @@ DRayProject2d::declare_interface(Node &i)
     i["type_name"]   = "dray_project_2d";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -2365,6 +2370,7 @@ DRayProjectColors2d::declare_interface(Node &i)
     i["type_name"]   = "dray_project_colors_2d";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -2508,6 +2514,7 @@ DRayVectorComponent::declare_interface(Node &i)
     i["type_name"]   = "dray_vector_component";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -27,6 +27,7 @@
 #include <ascent_runtime_query_filters.hpp>
 #include <ascent_runtime_command_filters.hpp>
 #include <ascent_runtime_steering_filters.hpp>
+#include <ascent_runtime_surrogate_filters.hpp>
 
 #if defined(ASCENT_VTKM_ENABLED)
     #include <ascent_runtime_vtkh_filters.hpp>
@@ -97,10 +98,15 @@ register_builtin()
 #endif
 
     AscentRuntime::register_filter_type<BasicTrigger>();
+    AscentRuntime::register_filter_type<SurrogateTrigger>();
     AscentRuntime::register_filter_type<BasicQuery>();
+    AscentRuntime::register_filter_type<QueryBatch>();
     AscentRuntime::register_filter_type<FilterQuery>("transforms","expression");
     AscentRuntime::register_filter_type<Command>();
     AscentRuntime::register_filter_type<Steering>("extracts");
+    AscentRuntime::register_filter_type<Surrogate>("extracts","surrogate");
+    AscentRuntime::register_filter_type<FieldSurrogate>("transforms","field_surrogate");
+    AscentRuntime::register_filter_type<POD>("extracts","pod");
     AscentRuntime::register_filter_type<DataBinning>("transforms","binning");
     AscentRuntime::register_filter_type<BlueprintPartition>("transforms","partition");
     AscentRuntime::register_filter_type<AddFields>("transforms","add_fields");
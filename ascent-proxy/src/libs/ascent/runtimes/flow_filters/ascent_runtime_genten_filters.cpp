@@ -233,6 +233,7 @@ Learn::declare_interface(Node &i)
     i["type_name"]   = "blueprint_learn";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 
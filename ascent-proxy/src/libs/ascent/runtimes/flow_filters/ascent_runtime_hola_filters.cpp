@@ -76,6 +76,7 @@ HolaMPIExtract::declare_interface(Node &i)
     i["type_name"]   = "hola_mpi";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -659,6 +659,7 @@ HTGIOSave::declare_interface(Node &i)
     i["type_name"]   = "htg_io_save";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -25,6 +25,7 @@
 // ascent includes
 //-----------------------------------------------------------------------------
 #include <ascent_expression_eval.hpp>
+#include <expressions/ascent_blueprint_architect.hpp>
 #include <ascent_logging.hpp>
 #include <ascent_data_object.hpp>
 #include <ascent_runtime_param_check.hpp>
@@ -81,6 +82,7 @@ BasicQuery::declare_interface(Node &i)
     // adding an output port to chain queries together
     // so they execute in order of declaration
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -122,14 +124,135 @@ BasicQuery::execute()
 
     Node v_info;
 
+    // the chain passes the query batch's reductions along, they are
+    // only valid for the queries the batch was planned for
+    conduit::Node *batch = nullptr;
+    if(input("dummy").check_type<conduit::Node>())
+    {
+        batch = input<conduit::Node>("dummy");
+    }
+
     // The mere act of a query stores the results
     runtime::expressions::ExpressionEval eval(*data_object);
+    if(batch != nullptr && batch->has_child("queries"))
+    {
+        NodeConstIterator itr = (*batch)["queries"].children();
+        while(itr.has_next())
+        {
+            if(itr.next().as_string() == this->name())
+            {
+                eval.batched_reductions((*batch)["fields"]);
+                break;
+            }
+        }
+    }
     conduit::Node res = eval.evaluate(expression, name);
 
     // we never actually use the output port
     // since we only use it to chain ordering
-    conduit::Node *dummy =  new conduit::Node();
-    set_output<conduit::Node>(dummy);
+    if(batch != nullptr)
+    {
+        set_output<conduit::Node>(batch);
+    }
+    else
+    {
+        conduit::Node *dummy =  new conduit::Node();
+        set_output<conduit::Node>(dummy);
+    }
+}
+
+//-----------------------------------------------------------------------------
+QueryBatch::QueryBatch()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+QueryBatch::~QueryBatch()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+QueryBatch::declare_interface(Node &i)
+{
+    i["type_name"]   = "query_batch";
+    i["port_names"].append() = "in";
+    // the first query of the chain is connected to this output
+    i["output_port"] = "true";
+    i["thread_safe"] = "false";
+}
+
+//-----------------------------------------------------------------------------
+bool
+QueryBatch::verify_params(const conduit::Node &params,
+                          conduit::Node &info)
+{
+    info.reset();
+    bool res = true;
+    if(!params.has_child("fields") ||
+       !params["fields"].dtype().is_list())
+    {
+        info["errors"].append() = "Missing required list of strings 'fields'";
+        res = false;
+    }
+    if(!params.has_child("queries") ||
+       !params["queries"].dtype().is_list())
+    {
+        info["errors"].append() = "Missing required list of strings 'queries'";
+        res = false;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+QueryBatch::execute()
+{
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("Query batch input must be a data object");
+    }
+
+    DataObject *data_object = input<DataObject>(0);
+    // the output travels down the query chain, the queries listed in
+    // "queries" read their reductions from "fields"
+    conduit::Node *batch = new conduit::Node();
+    // only low order sources hand every query the same dataset
+    if(data_object->is_valid() &&
+       data_object->source() == DataObject::Source::LOW_BP)
+    {
+        const conduit::Node *dataset = data_object->as_low_order_bp().get();
+
+        std::vector<std::string> fields;
+        NodeConstIterator itr = params()["fields"].children();
+        while(itr.has_next())
+        {
+            fields.push_back(itr.next().as_string());
+        }
+
+        Node reductions =
+          runtime::expressions::field_reductions_batched(*dataset, fields);
+
+        // only keep fields every query would accept, the rest take the
+        // regular path and report their own errors
+        Node &scalar_reductions = (*batch)["fields"];
+        scalar_reductions.set(DataType::object());
+        for(size_t f = 0; f < fields.size(); ++f)
+        {
+            const Node &n_field = reductions.child(fields[f]);
+            if(n_field["scalar"].to_int32() == 1)
+            {
+                scalar_reductions.add_child(fields[f]) = n_field;
+            }
+        }
+        (*batch)["queries"] = params()["queries"];
+    }
+
+    set_output<conduit::Node>(batch);
 }
 
 //-----------------------------------------------------------------------------
@@ -152,6 +275,7 @@ FilterQuery::declare_interface(Node &i)
     i["type_name"]   = "expression";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
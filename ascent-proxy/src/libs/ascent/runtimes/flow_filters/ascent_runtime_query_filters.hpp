@@ -56,6 +56,20 @@ public:
     virtual void   execute();
 };
 
+// computes the field reductions shared by a set of queries up front
+// so each query reads its result instead of reducing on its own
+class ASCENT_API QueryBatch : public ::flow::Filter
+{
+public:
+    QueryBatch();
+   ~QueryBatch();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
 class ASCENT_API FilterQuery : public ::flow::Filter
 {
 public:
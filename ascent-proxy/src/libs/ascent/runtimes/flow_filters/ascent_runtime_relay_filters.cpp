@@ -28,6 +28,7 @@
 #include <conduit_blueprint.hpp>
 #include <conduit_blueprint_mesh.hpp>
 #include <conduit_relay_io_blueprint.hpp>
+#include <conduit_fmt/conduit_fmt.h>
 #ifdef CONDUIT_RELAY_IO_SILO_ENABLED
 #include "conduit_relay_io_silo.hpp"
 #endif
@@ -45,6 +46,7 @@
 #include <ascent_runtime_utils.hpp>
 #include <ascent_runtime_param_check.hpp>
 #include "ascent_transmogrifier.hpp"
+#include "ascent_field_compression.hpp"
 
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
@@ -62,6 +64,7 @@
 #endif
 
 // std includes
+#include <iostream>
 #include <limits>
 #include <set>
 #include <numeric>
@@ -403,6 +406,115 @@ post_filter_check_for_data(const conduit::Node &output)
   }
 }
 
+//-----------------------------------------------------------------------------
+// true if protocol is written with mesh_blueprint_save
+bool
+is_mesh_protocol(const std::string &protocol)
+{
+#if defined(ASCENT_HDF5_ENABLED)
+  if(protocol == "blueprint/mesh/hdf5" || protocol == "hdf5")
+  {
+    return true;
+  }
+#endif
+  return protocol == "blueprint" ||
+         protocol == "blueprint/mesh/yaml" ||
+         protocol == "yaml" ||
+         protocol == "blueprint/mesh/json" ||
+         protocol == "json" ||
+         protocol == "silo" ||
+         protocol == "overlink";
+}
+
+//-----------------------------------------------------------------------------
+// the file protocol mesh_blueprint_save uses for a mesh protocol
+std::string
+mesh_file_protocol(const std::string &protocol)
+{
+  if(protocol == "blueprint")
+  {
+#if defined(ASCENT_HDF5_ENABLED)
+    return "hdf5";
+#else
+    return "yaml";
+#endif
+  }
+  else if(protocol == "blueprint/mesh/hdf5")
+  {
+    return "hdf5";
+  }
+  else if(protocol == "blueprint/mesh/yaml")
+  {
+    return "yaml";
+  }
+  else if(protocol == "blueprint/mesh/json")
+  {
+    return "json";
+  }
+  return protocol;
+}
+
+//-----------------------------------------------------------------------------
+// the root file relay writes when saving data as a mesh to path, relay
+// adds the cycle of the data to the name when there is one
+std::string
+mesh_root_file(const conduit::Node &data,
+               const std::string &path,
+               const std::string &file_protocol)
+{
+  if(file_protocol == "overlink")
+  {
+    return conduit::utils::join_file_path(path, "OvlTop.silo");
+  }
+
+  const conduit::Node *dom = &data;
+  if(!data.has_child("coordsets") && data.number_of_children() > 0)
+  {
+    dom = &data.child(0);
+  }
+
+  std::string root_file = path;
+  if(dom->has_path("state/cycle"))
+  {
+    root_file += conduit_fmt::format(".cycle_{:06d}",
+                                     dom->fetch_existing("state/cycle").to_int());
+  }
+  return root_file + ".root";
+}
+
+//-----------------------------------------------------------------------------
+// writes the selected data of a relay extract
+void
+relay_save(const conduit::Node &selected,
+           const std::string &path,
+           const std::string &protocol,
+           int num_files,
+           const conduit::Node &extra_opts,
+           std::string &result_path,
+           int mpi_comm_id)
+{
+  if(protocol.empty())
+  {
+    conduit::relay::io::save(selected,path);
+    result_path = path;
+  }
+  else if(!is_mesh_protocol(protocol))
+  {
+    conduit::relay::io::save(selected,path,protocol);
+    result_path = path;
+  }
+  else
+  {
+    mesh_blueprint_save(selected,
+                        path,
+                        mesh_file_protocol(protocol),
+                        num_files,
+                        extra_opts,
+                        result_path,
+                        mpi_comm_id);
+  }
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -478,6 +590,26 @@ verify_io_params(const conduit::Node &params,
         }
     }
 
+    res &= check_bool("async", params, info, false);
+
+    if( params.has_child("async_buffers") )
+    {
+        if(!params["async_buffers"].dtype().is_integer())
+        {
+            info["errors"].append() = "optional entry 'async_buffers' must be an integer";
+            res = false;
+        }
+        else if(params["async_buffers"].to_int() < 1)
+        {
+            info["errors"].append() = "'async_buffers' must be greater than 0";
+            res = false;
+        }
+        else
+        {
+            info["info"].append() = "includes 'async_buffers'";
+        }
+    }
+
 #if defined(ASCENT_HDF5_ENABLED)
     if( params.has_child("hdf5_options") )
     {
@@ -550,6 +682,8 @@ verify_io_params(const conduit::Node &params,
     }
 #endif
 
+    res &= verify_compression_params(params, info);
+
     std::vector<std::string> valid_paths;
     std::vector<std::string> ignore_paths;
     valid_paths.push_back("path");
@@ -558,8 +692,12 @@ verify_io_params(const conduit::Node &params,
     valid_paths.push_back("fields");
     valid_paths.push_back("num_files");
     valid_paths.push_back("refinement_level");
+    valid_paths.push_back("async");
+    valid_paths.push_back("async_buffers");
+    valid_paths.push_back("compression");
     ignore_paths.push_back("fields");
     ignore_paths.push_back("topologies");
+    ignore_paths.push_back("compression");
 #if defined(ASCENT_HDF5_ENABLED)
     ignore_paths.push_back("hdf5_options");
 #endif
@@ -582,10 +720,26 @@ void mesh_blueprint_save(const Node &data,
                          const std::string &file_protocol,
                          int num_files,
                          const Node &extra_opts,
-                         std::string &root_file_out)
+                         std::string &root_file_out,
+                         int mpi_comm_id)
 {
     bool has_data = blueprint::mesh::number_of_domains(data) > 0;
-    has_data = global_someone_agrees(has_data);
+#ifdef ASCENT_MPI_ENABLED
+    if(mpi_comm_id == -1)
+    {
+        mpi_comm_id = Workspace::default_mpi_comm();
+    }
+    MPI_Comm mpi_comm = MPI_Comm_f2c(mpi_comm_id);
+    int local_has_data = has_data ? 1 : 0;
+    int global_has_data = 0;
+    MPI_Allreduce(&local_has_data,
+                  &global_has_data,
+                  1,
+                  MPI_INT,
+                  MPI_SUM,
+                  mpi_comm);
+    has_data = global_has_data > 0;
+#endif
 
     if(!has_data)
     {
@@ -626,7 +780,6 @@ void mesh_blueprint_save(const Node &data,
             opts["file_style"] = "overlink";
         }
     #ifdef ASCENT_MPI_ENABLED
-        MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
         conduit::relay::mpi::io::silo::save_mesh(data,
                                                  path,
                                                  opts,
@@ -643,7 +796,6 @@ void mesh_blueprint_save(const Node &data,
     else
     {
 #ifdef ASCENT_MPI_ENABLED
-        MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
         conduit::relay::mpi::io::blueprint::save_mesh(data,
                                                       path,
                                                       file_protocol,
@@ -665,12 +817,275 @@ void mesh_blueprint_save(const Node &data,
         conduit::relay::io::hdf5_set_options(hdf5_opts_orig);
     }
 #endif
+    root_file_out = detail::mesh_root_file(data, path, file_protocol);
     return;
 
 }
 
 
 
+//-----------------------------------------------------------------------------
+RelayIOWriter::RelayIOWriter()
+: m_checked(false),
+  m_async(false),
+  m_mpi_comm(-1),
+  m_writing(false),
+  m_stop(false)
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+RelayIOWriter::~RelayIOWriter()
+{
+    // warnings may be configured to throw, which can't leave a destructor
+    try
+    {
+        reset();
+    }
+    catch(...)
+    {
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+RelayIOWriter::async(int mpi_comm_id)
+{
+    if(m_checked)
+    {
+        return m_async;
+    }
+
+    m_checked = true;
+    m_async = true;
+#ifdef ASCENT_MPI_ENABLED
+    // the writer issues collectives while the caller keeps using
+    // its communicator, so it gets a private one
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if(provided < MPI_THREAD_MULTIPLE)
+    {
+        ASCENT_INFO("relay_io_save 'async' requires MPI to be initialized "
+                    "with MPI_THREAD_MULTIPLE. Extracts will be written "
+                    "synchronously.");
+        m_async = false;
+    }
+    else
+    {
+        MPI_Comm writer_comm;
+        MPI_Comm_dup(MPI_Comm_f2c(mpi_comm_id), &writer_comm);
+        m_mpi_comm = MPI_Comm_c2f(writer_comm);
+    }
+#endif
+
+    if(m_async)
+    {
+        m_stop = false;
+        m_thread = std::thread(&RelayIOWriter::loop, this);
+    }
+    return m_async;
+}
+
+//-----------------------------------------------------------------------------
+void
+RelayIOWriter::save(const conduit::Node &data,
+                    const std::string &path,
+                    const std::string &protocol,
+                    int num_files,
+                    const conduit::Node &extra_opts,
+                    int max_staged)
+{
+    check_error();
+
+    Job job;
+    // back-pressure: block while all staging nodes are in use
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this, max_staged]
+        {
+            const int in_flight = static_cast<int>(m_queue.size()) +
+                                  (m_writing ? 1 : 0);
+            return in_flight < max_staged;
+        });
+        if(!m_free.empty())
+        {
+            job.data = std::move(m_free.back());
+            m_free.pop_back();
+        }
+    }
+
+    if(job.data == nullptr)
+    {
+        job.data.reset(new conduit::Node());
+    }
+
+    // copy into the staging node's memory when the layout is the same
+    if(job.data->compatible(data) && data.compatible(*job.data))
+    {
+        job.data->update_compatible(data);
+    }
+    else
+    {
+        job.data->reset();
+        job.data->set(data);
+    }
+
+    job.path       = path;
+    job.protocol   = protocol;
+    job.num_files  = num_files;
+    job.extra_opts = extra_opts;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(job));
+    }
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+void
+RelayIOWriter::flush()
+{
+    if(m_thread.joinable())
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]
+        {
+            return m_queue.empty() && !m_writing;
+        });
+    }
+    check_error();
+}
+
+//-----------------------------------------------------------------------------
+void
+RelayIOWriter::reset()
+{
+    if(m_thread.joinable())
+    {
+        // write everything that was queued before shutting down
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        m_thread.join();
+    }
+
+    // the writer thread has stopped, so the error needs no lock
+    const std::string error = m_error;
+    m_error = "";
+
+#ifdef ASCENT_MPI_ENABLED
+    if(m_mpi_comm != -1)
+    {
+        MPI_Comm writer_comm = MPI_Comm_f2c(m_mpi_comm);
+        MPI_Comm_free(&writer_comm);
+        m_mpi_comm = -1;
+    }
+#endif
+
+    m_free.clear();
+    m_checked = false;
+    m_async = false;
+
+    // reported last, since warnings may be configured to throw
+    if(error != "")
+    {
+        ASCENT_WARN("Asynchronous relay extract failed: "<<error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+RelayIOWriter::check_error()
+{
+    std::string msg;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        msg = m_error;
+        m_error = "";
+    }
+
+    if(msg != "")
+    {
+        ASCENT_ERROR("Asynchronous relay extract failed: "<<msg);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+RelayIOWriter::loop()
+{
+    while(true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]
+            {
+                return m_stop || !m_queue.empty();
+            });
+            if(m_queue.empty())
+            {
+                return;
+            }
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_writing = true;
+        }
+
+        std::string error;
+        try
+        {
+            std::string result_path;
+            detail::relay_save(*job.data,
+                               job.path,
+                               job.protocol,
+                               job.num_files,
+                               job.extra_opts,
+                               result_path,
+                               m_mpi_comm);
+        }
+        catch(conduit::Error &e)
+        {
+            error = e.message();
+        }
+        catch(std::exception &e)
+        {
+            error = e.what();
+        }
+        catch(...)
+        {
+            error = "unknown exception thrown";
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_writing = false;
+            m_free.push_back(std::move(job.data));
+            // keep the first error until the caller sees it
+            if(error != "" && m_error == "")
+            {
+                m_error = error;
+            }
+        }
+        m_cond.notify_all();
+    }
+}
+
+//-----------------------------------------------------------------------------
+RelayIOWriter *
+relay_writer(flow::Workspace &w)
+{
+    if(w.registry().has_entry("_ascent_relay_writer"))
+    {
+        return w.registry().fetch<RelayIOWriter>("_ascent_relay_writer");
+    }
+    return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 RelayIOSave::RelayIOSave()
 :Filter()
@@ -691,6 +1106,7 @@ RelayIOSave::declare_interface(Node &i)
     i["type_name"]   = "relay_io_save";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -981,65 +1397,71 @@ RelayIOSave::execute()
     }
 #endif
 
-    std::string result_path;
-    if(protocol.empty())
+    bool async = false;
+    if(params().has_path("async"))
     {
-        conduit::relay::io::save(selected,path);
-        result_path = path;
+        async = params()["async"].as_string() == "true";
     }
-#if defined(ASCENT_HDF5_ENABLED)
-    else if( protocol == "blueprint" ||
-             protocol == "blueprint/mesh/hdf5" ||
-             protocol == "hdf5")
+
+    // double buffered unless asked otherwise
+    int max_staged = 2;
+    if(params().has_path("async_buffers"))
     {
-        mesh_blueprint_save(selected,
-                            path,
-                            "hdf5",
-                            num_files,
-                            extra_opts,
-                            result_path);
+        max_staged = params()["async_buffers"].to_int();
     }
-#endif
-    else if( protocol == "blueprint" ||
-             protocol == "blueprint/mesh/yaml" ||
-             protocol == "yaml")
-    {
-        mesh_blueprint_save(selected,
-                            path,
-                            "yaml",
-                            num_files,
-                            extra_opts,
-                            result_path);
 
-    }
-    else if( protocol == "blueprint/mesh/json" || protocol == "json")
+    // lossy compression of the requested fields
+    Node compressed;
+    Node compression_stats;
+    const Node *to_save = &selected;
+    if(params().has_path("compression"))
     {
-        mesh_blueprint_save(selected,
-                            path,
-                            "json",
-                            num_files,
-                            extra_opts,
-                            result_path);
-
+        compress_fields(selected,
+                        params()["compression"],
+                        compressed,
+                        compression_stats);
+        to_save = &compressed;
     }
-    else if( protocol == "silo" ||
-             protocol == "overlink")
+
+    RelayIOWriter *writer = relay_writer(graph().workspace());
+    std::string result_path;
+    if(async && writer != nullptr &&
+       writer->async(Workspace::default_mpi_comm()))
     {
-#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
-        mesh_blueprint_save(selected,
-                            path,
-                            protocol,
-                            num_files,
-                            extra_opts,
-                            result_path);
-#else
-        ASCENT_ERROR("Ascent's Conduit was not built with Silo support.");
-#endif
+        writer->save(*to_save,
+                     path,
+                     protocol,
+                     num_files,
+                     extra_opts,
+                     max_staged);
+        // what the synchronous save reports, computed here since the
+        // writer thread can't report back
+        if(detail::is_mesh_protocol(protocol))
+        {
+            result_path = detail::mesh_root_file(*to_save,
+                                                 path,
+                                                 detail::mesh_file_protocol(protocol));
+        }
+        else
+        {
+            result_path = path;
+        }
     }
     else
     {
-        conduit::relay::io::save(selected,path,protocol);
-        result_path = path;
+        async = false;
+        if(writer != nullptr)
+        {
+            // the io libraries are only used by one thread at a time
+            writer->flush();
+        }
+        detail::relay_save(*to_save,
+                           path,
+                           protocol,
+                           num_files,
+                           extra_opts,
+                           result_path,
+                           -1);
     }
 
     // add this to the extract results in the registry
@@ -1058,6 +1480,14 @@ RelayIOSave::execute()
     if(!protocol.empty())
         einfo["protocol"] = protocol;
     einfo["path"] = result_path;
+    if(async)
+    {
+        einfo["async"] = "true";
+    }
+    if(compression_stats.number_of_children() > 0)
+    {
+        einfo["compression"] = compression_stats;
+    }
 }
 
 
@@ -1082,6 +1512,7 @@ RelayIOLoad::declare_interface(Node &i)
     i["type_name"]   = "relay_io_load";
     i["port_names"] = DataType::empty();
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1140,6 +1571,7 @@ BlueprintFlatten::declare_interface(Node &i)
     i["type_name"]   = "false";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
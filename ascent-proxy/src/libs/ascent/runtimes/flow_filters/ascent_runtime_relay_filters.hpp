@@ -15,9 +15,18 @@
 #define ASCENT_FLOW_PIPELINE_RELAY_FILTERS_HPP
 
 #include <flow_filter.hpp>
+#include <flow_workspace.hpp>
 
 #include <ascent_exports.h>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
 //-----------------------------------------------------------------------------
@@ -43,12 +52,81 @@ namespace filters
 ///
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
+// mpi_comm_id == -1 uses the workspace's default communicator
 void mesh_blueprint_save(const conduit::Node &data,
                          const std::string &path,
                          const std::string &file_protocol,
                          int num_files,
                          const conduit::Node &extra_opts,
-                         std::string &root_file_out);
+                         std::string &root_file_out,
+                         int mpi_comm_id = -1);
+
+//-----------------------------------------------------------------------------
+///
+/// Writes relay extracts that set `async` in the background. A save copies
+/// the selected data into one of a bounded pool of staging nodes (reused
+/// while the data keeps its layout) and returns, a writer thread serializes
+/// and writes the staged nodes in order. A save waits while the pool is
+/// full, and errors of background writes are raised by the next save or
+/// flush. With MPI, the writer uses a private communicator and needs
+/// MPI_THREAD_MULTIPLE, without it saves are written synchronously.
+/// The ascent runtime owns one, registers it as "_ascent_relay_writer",
+/// and flushes it when ascent is closed.
+///
+//-----------------------------------------------------------------------------
+class ASCENT_API RelayIOWriter
+{
+public:
+    RelayIOWriter();
+   ~RelayIOWriter();
+
+    // false if saves can't be written in the background, starts the
+    // writer thread (and its communicator) on first use
+    bool async(int mpi_comm_id);
+    // stages data and queues it, waits while max_staged saves are queued
+    void save(const conduit::Node &data,
+              const std::string &path,
+              const std::string &protocol,
+              int num_files,
+              const conduit::Node &extra_opts,
+              int max_staged);
+    // waits until everything queued was written
+    void flush();
+    // flushes and stops the writer thread
+    void reset();
+
+private:
+    RelayIOWriter(const RelayIOWriter &) = delete;
+    RelayIOWriter &operator=(const RelayIOWriter &) = delete;
+
+    struct Job
+    {
+      std::unique_ptr<conduit::Node> data;
+      std::string                    path;
+      std::string                    protocol;
+      int                            num_files;
+      conduit::Node                  extra_opts;
+    };
+
+    void loop();
+    void check_error();
+
+    bool                    m_checked;
+    bool                    m_async;
+    int                     m_mpi_comm;
+    std::deque<Job>         m_queue;
+    // staging nodes that were written and can be reused
+    std::vector<std::unique_ptr<conduit::Node>> m_free;
+    bool                    m_writing;
+    bool                    m_stop;
+    std::string             m_error;
+    std::mutex              m_mutex;
+    std::condition_variable m_cond;
+    std::thread             m_thread;
+};
+
+// the relay writer registered in w, nullptr if there is none
+RelayIOWriter ASCENT_API *relay_writer(flow::Workspace &w);
 
 class ASCENT_API RelayIOSave : public ::flow::Filter
 {
@@ -1050,6 +1050,7 @@ DefaultRender::declare_interface(Node &i)
     i["type_name"] = "default_render";
     i["port_names"].append() = "a";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1438,6 +1439,7 @@ VTKHBounds::declare_interface(Node &i)
     i["type_name"] = "vtkh_bounds";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1485,6 +1487,7 @@ VTKHUnionBounds::declare_interface(Node &i)
     i["port_names"].append() = "a";
     i["port_names"].append() = "b";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 
@@ -1533,6 +1536,7 @@ AddPlot::declare_interface(Node &i)
     i["port_names"].append() = "scene";
     i["port_names"].append() = "plot";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1582,6 +1586,7 @@ CreatePlot::declare_interface(Node &i)
     i["type_name"] = "create_plot";
     i["port_names"].append() = "a";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 
@@ -1871,6 +1876,7 @@ CreateScene::declare_interface(Node &i)
 {
     i["type_name"]   = "create_scene";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
     i["port_names"] = DataType::empty();
 }
 
@@ -1903,6 +1909,7 @@ ExecScene::declare_interface(conduit::Node &i)
     i["port_names"].append() = "scene";
     i["port_names"].append() = "renders";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
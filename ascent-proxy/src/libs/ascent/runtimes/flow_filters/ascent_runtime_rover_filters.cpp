@@ -99,6 +99,7 @@ RoverXRay::declare_interface(Node &i)
     i["type_name"]   = "xray";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -365,6 +366,7 @@ RoverVolume::declare_interface(Node &i)
     i["type_name"]   = "rover_volume";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
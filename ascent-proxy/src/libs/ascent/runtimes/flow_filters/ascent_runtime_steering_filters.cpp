@@ -73,6 +73,7 @@ Steering::declare_interface(Node &i)
     i["type_name"] = "steering";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
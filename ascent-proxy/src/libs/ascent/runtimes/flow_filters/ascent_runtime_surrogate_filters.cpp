@@ -0,0 +1,2223 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_runtime_surrogate_filters.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_runtime_surrogate_filters.hpp"
+
+//-----------------------------------------------------------------------------
+// thirdparty includes
+//-----------------------------------------------------------------------------
+
+// conduit includes
+#include <conduit.hpp>
+
+//-----------------------------------------------------------------------------
+// ascent includes
+//-----------------------------------------------------------------------------
+#include <ascent_expression_eval.hpp>
+#include <ascent_logging.hpp>
+#include <ascent_data_object.hpp>
+#include <ascent_runtime_param_check.hpp>
+#include <ascent_runtime_utils.hpp>
+#include <expressions/ascent_blueprint_architect.hpp>
+#include <expressions/ascent_blueprint_device_reductions.hpp>
+
+#include <flow_graph.hpp>
+#include <flow_timer.hpp>
+#include <flow_workspace.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// mpi related includes
+#ifdef ASCENT_MPI_ENABLED
+#include <mpi.h>
+#endif
+
+using namespace conduit;
+using namespace std;
+
+using namespace flow;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+namespace filters
+{
+
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+inline double
+dot(const double *a, const double *b, const int size)
+{
+  double res = 0.0;
+  for(int i = 0; i < size; ++i)
+  {
+    res += a[i] * b[i];
+  }
+  return res;
+}
+
+//-----------------------------------------------------------------------------
+inline void
+axpy(const double alpha, const double *x, double *y, const int size)
+{
+  for(int i = 0; i < size; ++i)
+  {
+    y[i] += alpha * x[i];
+  }
+}
+
+//-----------------------------------------------------------------------------
+// factors the small dense spd matrix a = l l^T (row major, n x n) in
+// place, l is stored in the lower triangle. returns false if the
+// matrix is not positive definite
+bool
+cholesky_factor(std::vector<double> &a, const int n)
+{
+  for(int j = 0; j < n; ++j)
+  {
+    double diag = a[j * n + j] - detail::dot(&a[j * n], &a[j * n], j);
+    if(diag <= 0.0)
+    {
+      return false;
+    }
+    diag = std::sqrt(diag);
+    a[j * n + j] = diag;
+    for(int i = j + 1; i < n; ++i)
+    {
+      a[i * n + j] = (a[i * n + j] - detail::dot(&a[i * n], &a[j * n], j)) / diag;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// forward substitution l y = b in place, l from cholesky_factor
+inline void
+lower_solve(const std::vector<double> &l, double *b, const int n)
+{
+  for(int i = 0; i < n; ++i)
+  {
+    b[i] = (b[i] - detail::dot(&l[i * n], b, i)) / l[i * n + i];
+  }
+}
+
+//-----------------------------------------------------------------------------
+// solves (A + ridge I) x = b in place (b becomes x) with a cholesky
+// factorization of the small dense spd matrix A (row major, n x n).
+// returns false if the matrix is not positive definite
+bool
+cholesky_solve(std::vector<double> &a,
+               std::vector<double> &b,
+               const int n,
+               const double ridge)
+{
+  for(int i = 0; i < n; ++i)
+  {
+    a[i * n + i] += ridge;
+  }
+
+  if(!cholesky_factor(a, n))
+  {
+    return false;
+  }
+
+  // forward substitution l y = b
+  lower_solve(a, &b[0], n);
+  // back substitution l^T x = y
+  for(int i = n - 1; i >= 0; --i)
+  {
+    double sum = b[i];
+    for(int k = i + 1; k < n; ++k)
+    {
+      sum -= a[k * n + i] * b[k];
+    }
+    b[i] = sum / a[i * n + i];
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// reduces a field over the local domains only, returns false if
+// this rank has no domains with the field
+bool
+local_field_reduction(const conduit::Node &dataset,
+                      const std::string &field,
+                      const std::string &reduction,
+                      double &value)
+{
+  const std::string path = "fields/" + field;
+  bool found = false;
+  double sum = 0.0;
+  double count = 0.0;
+  value = reduction == "min" ? std::numeric_limits<double>::max()
+                             : std::numeric_limits<double>::lowest();
+
+  for(int i = 0; i < dataset.number_of_children(); ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    if(!dom.has_path(path))
+    {
+      continue;
+    }
+    found = true;
+
+    if(reduction == "max")
+    {
+      value = std::max(value,
+                       expressions::field_reduction_max(dom[path])["value"].to_float64());
+    }
+    else if(reduction == "min")
+    {
+      value = std::min(value,
+                       expressions::field_reduction_min(dom[path])["value"].to_float64());
+    }
+    else
+    {
+      conduit::Node res = expressions::field_reduction_sum(dom[path]);
+      sum += res["value"].to_float64();
+      count += res["count"].to_float64();
+    }
+  }
+
+  if(reduction == "sum")
+  {
+    value = sum;
+  }
+  else if(reduction == "avg")
+  {
+    value = count > 0.0 ? sum / count : 0.0;
+  }
+
+  return found;
+}
+
+//-----------------------------------------------------------------------------
+// component names of a (possibly multi-component) field,
+// a single "" for a plain array
+void
+field_components(const conduit::Node &values,
+                 std::vector<std::string> &components)
+{
+  components.clear();
+  if(values.number_of_children() == 0)
+  {
+    components.push_back("");
+    return;
+  }
+  for(int i = 0; i < values.number_of_children(); ++i)
+  {
+    components.push_back(values.child(i).name());
+  }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+component_size(const conduit::Node &values,
+               const std::string &component)
+{
+  if(component.empty())
+  {
+    return values.dtype().number_of_elements();
+  }
+  return values[component].dtype().number_of_elements();
+}
+
+//-----------------------------------------------------------------------------
+// sizes a per element model, see expressions::field_surrogate_step
+void
+init_field_model(conduit::Node &model, const int lags, const index_t size)
+{
+  model.reset();
+  model["lags"] = lags;
+  model["next"] = 0;
+  model["count"] = 0;
+  // conduit zero initializes these arrays
+  model["history"].set(conduit::DataType::float64(lags * size));
+  model["weights"].set(conduit::DataType::float64((lags + 1) * size));
+  model["prediction"].set(conduit::DataType::float64(size));
+  // start from persistence: the newest lag has weight one
+  float64 *weights = model["weights"].value();
+  for(index_t i = 0; i < size; ++i)
+  {
+    weights[lags * size + i] = 1.0;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// left singular vectors and singular values of a small dense matrix
+// (row major, m x m) by one sided jacobi rotations. on return the
+// columns of u are sorted by decreasing singular value
+void
+jacobi_svd(const std::vector<double> &a,
+           const int m,
+           std::vector<double> &u,
+           std::vector<double> &sigma)
+{
+  // rotate columns until they are mutually orthogonal: a v = u sigma
+  std::vector<double> w(a);
+  const double eps = std::numeric_limits<double>::epsilon();
+  for(int sweep = 0; sweep < 60; ++sweep)
+  {
+    bool rotated = false;
+    for(int p = 0; p < m - 1; ++p)
+    {
+      for(int q = p + 1; q < m; ++q)
+      {
+        double alpha = 0.0;
+        double beta = 0.0;
+        double gamma = 0.0;
+        for(int i = 0; i < m; ++i)
+        {
+          alpha += w[i * m + p] * w[i * m + p];
+          beta  += w[i * m + q] * w[i * m + q];
+          gamma += w[i * m + p] * w[i * m + q];
+        }
+        if(gamma == 0.0 ||
+           std::abs(gamma) <= eps * std::sqrt(alpha * beta))
+        {
+          continue;
+        }
+        rotated = true;
+        const double zeta = (beta - alpha) / (2.0 * gamma);
+        const double t = (zeta >= 0.0 ? 1.0 : -1.0) /
+                         (std::abs(zeta) + std::sqrt(1.0 + zeta * zeta));
+        const double c = 1.0 / std::sqrt(1.0 + t * t);
+        const double sn = c * t;
+        for(int i = 0; i < m; ++i)
+        {
+          const double wp = w[i * m + p];
+          const double wq = w[i * m + q];
+          w[i * m + p] = c * wp - sn * wq;
+          w[i * m + q] = sn * wp + c * wq;
+        }
+      }
+    }
+    if(!rotated)
+    {
+      break;
+    }
+  }
+
+  std::vector<double> norms(m);
+  std::vector<int> order(m);
+  for(int j = 0; j < m; ++j)
+  {
+    double sum = 0.0;
+    for(int i = 0; i < m; ++i)
+    {
+      sum += w[i * m + j] * w[i * m + j];
+    }
+    norms[j] = std::sqrt(sum);
+    order[j] = j;
+  }
+  std::sort(order.begin(), order.end(),
+            [&norms](const int l, const int r) { return norms[l] > norms[r]; });
+
+  u.assign(m * m, 0.0);
+  sigma.resize(m);
+  for(int j = 0; j < m; ++j)
+  {
+    const int src = order[j];
+    sigma[j] = norms[src];
+    if(norms[src] > 0.0)
+    {
+      for(int i = 0; i < m; ++i)
+      {
+        u[i * m + j] = w[i * m + src] / norms[src];
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// concatenates the local values of `fields` (all components, all
+// domains, in domain order) into one snapshot vector
+void
+local_snapshot(const conduit::Node &dataset,
+               const conduit::Node &fields,
+               std::vector<double> &snapshot)
+{
+  snapshot.clear();
+  for(int i = 0; i < dataset.number_of_children(); ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    for(int f = 0; f < fields.number_of_children(); ++f)
+    {
+      const std::string path = "fields/" + fields.child(f).as_string() + "/values";
+      if(!dom.has_path(path))
+      {
+        continue;
+      }
+      const conduit::Node &values = dom[path];
+      std::vector<std::string> components;
+      field_components(values, components);
+      for(size_t c = 0; c < components.size(); ++c)
+      {
+        const conduit::Node &comp = components[c].empty() ? values
+                                                          : values[components[c]];
+        conduit::Node n_vals;
+        comp.to_float64_array(n_vals);
+        const float64 *vals = n_vals.as_float64_ptr();
+        snapshot.insert(snapshot.end(),
+                        vals,
+                        vals + n_vals.dtype().number_of_elements());
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// one incremental (brand) svd update of the pod basis with snapshot x.
+// packed holds the globally summed [reset | x.x | U^T x | U^T U], the
+// gram matrix re-orthonormalizes the basis (cholesky qr) so rounding
+// errors don't accumulate across updates. the coefficients of x in
+// the updated basis are returned
+void
+pod_update(conduit::Node &state,
+           const std::vector<double> &x,
+           const std::vector<double> &packed,
+           const bool train,
+           std::vector<double> &coefficients)
+{
+  // relative size below which a direction is considered noise. the
+  // residual norm comes from x.x - p.p, which carries about sqrt(eps)
+  // of cancellation error, so this sits well above that
+  const double tol = 1e-6;
+  const int n = (int) x.size();
+  const int budget = state["rank_budget"].to_int32();
+  const int r = state["rank"].to_int32();
+  float64 *basis = state["basis"].value();
+  float64 *sv = state["singular_values"].value();
+  const double xx = packed[1];
+  const double norm = std::sqrt(xx);
+
+  coefficients.clear();
+  if(r == 0)
+  {
+    if(!train || norm == 0.0)
+    {
+      return;
+    }
+    for(int i = 0; i < n; ++i)
+    {
+      basis[i] = x[i] / norm;
+    }
+    sv[0] = norm;
+    state["rank"] = 1;
+    coefficients.push_back(norm);
+    return;
+  }
+
+  std::vector<double> l(packed.begin() + 2 + r, packed.begin() + 2 + r + r * r);
+  if(!cholesky_factor(l, r))
+  {
+    // degenerate basis, skip the re-orthonormalization
+    l.assign(r * r, 0.0);
+    for(int j = 0; j < r; ++j)
+    {
+      l[j * r + j] = 1.0;
+    }
+  }
+
+  // coefficients in the orthonormalized basis Q = U L^-T
+  std::vector<double> p(packed.begin() + 2, packed.begin() + 2 + r);
+  lower_solve(l, &p[0], r);
+
+  const double rho2 = xx - detail::dot(&p[0], &p[0], r);
+  const double rho = rho2 > 0.0 ? std::sqrt(rho2) : 0.0;
+  const bool grow = train && rho > tol * norm;
+
+  // K = [ L^T S   p  ]
+  //     [   0    rho ]
+  const int m = r + 1;
+  std::vector<double> k(m * m, 0.0);
+  for(int i = 0; i < r; ++i)
+  {
+    for(int j = i; j < r; ++j)
+    {
+      k[i * m + j] = l[j * r + i] * sv[j];
+    }
+    k[i * m + r] = p[i];
+  }
+  k[r * m + r] = grow ? rho : 0.0;
+
+  std::vector<double> uk;
+  std::vector<double> sigma;
+  if(train)
+  {
+    jacobi_svd(k, m, uk, sigma);
+  }
+  else
+  {
+    // keep the current directions, only re-orthonormalize them
+    uk.assign(m * m, 0.0);
+    for(int j = 0; j < m; ++j)
+    {
+      uk[j * m + j] = 1.0;
+    }
+    sigma.assign(sv, sv + r);
+    sigma.push_back(0.0);
+  }
+
+  int new_rank = 0;
+  for(int j = 0; j < std::min(m, budget); ++j)
+  {
+    if(sigma[j] > tol * sigma[0])
+    {
+      new_rank++;
+    }
+  }
+
+  // rotate the basis one row at a time: [Q q] uk[:, 0:new_rank]
+  std::vector<double> row(m);
+  for(int i = 0; i < n; ++i)
+  {
+    for(int j = 0; j < r; ++j)
+    {
+      row[j] = basis[j * n + i];
+    }
+    lower_solve(l, &row[0], r);
+    row[r] = grow ? (x[i] - detail::dot(&row[0], &p[0], r)) / rho : 0.0;
+    for(int j = 0; j < new_rank; ++j)
+    {
+      double sum = 0.0;
+      for(int c = 0; c < m; ++c)
+      {
+        sum += row[c] * uk[c * m + j];
+      }
+      basis[j * n + i] = sum;
+    }
+  }
+
+  // x = [Q q] [p; rho], rotated into the new basis
+  for(int j = 0; j < budget; ++j)
+  {
+    sv[j] = j < new_rank ? sigma[j] : 0.0;
+  }
+  for(int j = 0; j < new_rank; ++j)
+  {
+    double sum = k[r * m + r] * uk[r * m + j];
+    for(int c = 0; c < r; ++c)
+    {
+      sum += p[c] * uk[c * m + j];
+    }
+    coefficients.push_back(sum);
+  }
+  state["rank"] = new_rank;
+}
+
+//-----------------------------------------------------------------------------
+// the extract results of this execute. the runtime moves them into
+// info once the graph ran, and then resets the registry, which
+// releases the list: it is added with one ref that is never consumed,
+// so it is tracked but lives until that reset
+conduit::Node &
+extract_list(flow::Workspace &w)
+{
+  if(!w.registry().has_entry("extract_list"))
+  {
+    w.registry().add<conduit::Node>("extract_list",
+                                    new conduit::Node(),
+                                    1);
+  }
+  return *w.registry().fetch<conduit::Node>("extract_list");
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+SurrogateModel::SurrogateModel(conduit::Node &state)
+: m_state(state)
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+SurrogateModel::~SurrogateModel()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::configure(int lags,
+                          double learning_rate,
+                          int epochs,
+                          double initial_weight,
+                          int num_exogenous,
+                          const conduit::Node &solver)
+{
+  m_state.reset();
+  m_state["lags"] = lags;
+  m_state["num_exogenous"] = num_exogenous;
+  m_state["learning_rate"] = learning_rate;
+  m_state["epochs"] = epochs;
+  m_state["initial_weight"] = initial_weight;
+  m_state["num_observations"] = 0;
+  m_state["num_updates"] = 0;
+  m_state["last_cycle"] = -1;
+
+  const int size = lags + 1 + num_exogenous;
+  m_state["features"].set(DataType::float64(size));
+  float64_array features = m_state["features"].value();
+  features.fill(0.0);
+  features[0] = 1.0;
+
+  m_state["weights"].set(DataType::float64(size));
+  float64_array weights = m_state["weights"].value();
+  weights.fill(initial_weight);
+
+  m_state["solver"].set(DataType::empty());
+  m_state["solver"].update(solver);
+  if(!m_state["solver"].has_child("type"))
+  {
+    m_state["solver"]["type"] = "sgd";
+  }
+  const std::string type = m_state["solver/type"].as_string();
+
+  // per solver state, all zero to start
+  if(type == "momentum")
+  {
+    m_state["velocity"].set(DataType::float64(size));
+    float64_array velocity = m_state["velocity"].value();
+    velocity.fill(0.0);
+  }
+  else if(type == "adam")
+  {
+    m_state["adam/m"].set(DataType::float64(size));
+    m_state["adam/v"].set(DataType::float64(size));
+    float64_array adam_m = m_state["adam/m"].value();
+    float64_array adam_v = m_state["adam/v"].value();
+    adam_m.fill(0.0);
+    adam_v.fill(0.0);
+    m_state["adam/t"] = 0;
+  }
+  else if(type == "rls")
+  {
+    // P = I / delta, a large P means little confidence in the
+    // initial weights
+    const double delta = solver_option("ridge", 1e-3);
+    m_state["rls_p"].set(DataType::float64(size * size));
+    float64_array p = m_state["rls_p"].value();
+    p.fill(0.0);
+    for(int i = 0; i < size; ++i)
+    {
+      p[i * size + i] = 1.0 / delta;
+    }
+  }
+
+  if(type != "sgd" && type != "rls")
+  {
+    // sliding window of (x, y) samples used as the batch
+    const int window = (int) solver_option("window", 1.0);
+    m_state["samples/x"].set(DataType::float64(window * size));
+    m_state["samples/y"].set(DataType::float64(window));
+    float64_array samples_x = m_state["samples/x"].value();
+    float64_array samples_y = m_state["samples/y"].value();
+    samples_x.fill(0.0);
+    samples_y.fill(0.0);
+    m_state["samples/count"] = 0;
+    m_state["samples/next"] = 0;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool
+SurrogateModel::configured(int lags,
+                           double learning_rate,
+                           int epochs,
+                           double initial_weight,
+                           int num_exogenous,
+                           const conduit::Node &solver) const
+{
+  if(!m_state.has_child("weights") ||
+     !m_state.has_child("features"))
+  {
+    return false;
+  }
+
+  // compare the solver options, with the default type filled in
+  conduit::Node expected;
+  expected.update(solver);
+  if(!expected.has_child("type"))
+  {
+    expected["type"] = "sgd";
+  }
+  conduit::Node diff_info;
+  if(!m_state.has_child("solver") ||
+     expected.diff(m_state["solver"], diff_info))
+  {
+    return false;
+  }
+
+  const int size = lags + 1 + num_exogenous;
+  return m_state["lags"].to_int32() == lags &&
+         this->num_exogenous() == num_exogenous &&
+         m_state["learning_rate"].to_float64() == learning_rate &&
+         m_state["epochs"].to_int32() == epochs &&
+         m_state["initial_weight"].to_float64() == initial_weight &&
+         m_state["weights"].dtype().number_of_elements() == size &&
+         m_state["features"].dtype().number_of_elements() == size;
+}
+
+//-----------------------------------------------------------------------------
+bool
+SurrogateModel::ready() const
+{
+  const int lags = this->lags();
+  return lags > 0 && num_observations() >= lags;
+}
+
+//-----------------------------------------------------------------------------
+double
+SurrogateModel::observe(double value, bool train)
+{
+  const int size = this->size();
+  const int epochs = m_state["epochs"].to_int32();
+  const double learning_rate = m_state["learning_rate"].to_float64();
+  double *x = m_state["features"].value();
+  double *w = m_state["weights"].value();
+  double loss = 0.0;
+
+  if(!ready())
+  {
+    // still filling the lag window
+    push(value);
+    return loss;
+  }
+
+  double pred = detail::dot(w, x, size);
+  double err = pred - value;
+  loss = err * err;
+
+  const std::string solver = solver_type();
+  if(solver != "sgd")
+  {
+    if(solver != "rls")
+    {
+      add_sample(x, value);
+    }
+
+    if(train)
+    {
+      if(solver == "rls")
+      {
+        rls_update(x, value);
+      }
+      else if(solver == "normal")
+      {
+        normal_solve();
+      }
+      else if(epochs > 0)
+      {
+        // mini-batch over the sample window
+        std::vector<double> terms(num_terms(), 0.0);
+        sample_terms(&terms[0]);
+        gradient_steps(&terms[0], terms[terms.size() - 1]);
+      }
+
+      if(solver == "rls" || solver == "normal" || epochs > 0)
+      {
+        m_state["num_updates"] = num_updates() + 1;
+      }
+    }
+  }
+  else if(train && epochs > 0)
+  {
+    // The features are fixed across epochs, so every SGD step moves the
+    // weights along x. Instead of touching the weights once per epoch we
+    // track the prediction in closed form (x.x is constant) and apply the
+    // accumulated step with a single axpy. This is the same sequence of
+    // updates as looping `w -= lr * (w.x - y) * x` epochs times.
+    const double xx = detail::dot(x, x, size);
+    double step = 0.0;
+    for(int e = 0; e < epochs; ++e)
+    {
+      const double delta = learning_rate * (pred - value);
+      step -= delta;
+      pred -= delta * xx;
+    }
+    detail::axpy(step, x, w, size);
+    m_state["num_updates"] = num_updates() + 1;
+  }
+
+  push(value);
+
+  return loss;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::push(double value)
+{
+  const int lags = this->lags();
+  const int num_obs = num_observations();
+  double *x = m_state["features"].value();
+
+  if(num_obs < lags)
+  {
+    x[1 + num_obs] = value;
+  }
+  else
+  {
+    // slide the window forward
+    for(int i = 1; i < lags; ++i)
+    {
+      x[i] = x[i+1];
+    }
+    x[lags] = value;
+  }
+  m_state["num_observations"] = num_obs + 1;
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::num_terms() const
+{
+  const int size = this->size();
+  return size * size + size + 2;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::accumulate_terms(double value, double *terms) const
+{
+  if(!ready())
+  {
+    return;
+  }
+
+  const int size = this->size();
+  const double *x = m_state["features"].value();
+  const double *w = m_state["weights"].value();
+
+  double *gram = terms;
+  double *rhs  = terms + size * size;
+  for(int i = 0; i < size; ++i)
+  {
+    detail::axpy(x[i], x, gram + i * size, size);
+  }
+  detail::axpy(value, x, rhs, size);
+
+  const double err = detail::dot(w, x, size) - value;
+  terms[size * size + size] += err * err;
+  terms[size * size + size + 1] += 1.0;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::update(const double *terms)
+{
+  const int size = this->size();
+  const double count = terms[size * size + size + 1];
+  if(count <= 0.0)
+  {
+    return;
+  }
+
+  const int epochs = m_state["epochs"].to_int32();
+  gradient_steps(terms, count);
+
+  if(epochs > 0)
+  {
+    m_state["num_updates"] = num_updates() + 1;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::gradient_steps(const double *terms, double count)
+{
+  if(count <= 0.0)
+  {
+    return;
+  }
+
+  const int size = this->size();
+  const int epochs = m_state["epochs"].to_int32();
+  const double learning_rate = m_state["learning_rate"].to_float64();
+  const std::string solver = solver_type();
+  double *w = m_state["weights"].value();
+
+  // The gradient of the summed squared error is (X^T X) w - X^T y,
+  // so once the terms are summed every epoch is O(size^2) local work,
+  // independent of the batch size. With a single observation plain
+  // sgd is exactly the serial update.
+  const double *gram = terms;
+  const double *rhs  = terms + size * size;
+  const double inv_count = 1.0 / count;
+  std::vector<double> grad(size);
+
+  double *velocity = NULL;
+  double *adam_m = NULL;
+  double *adam_v = NULL;
+  double momentum = 0.0;
+  double beta1 = 0.0, beta2 = 0.0, epsilon = 0.0;
+  int adam_t = 0;
+  if(solver == "momentum")
+  {
+    velocity = m_state["velocity"].value();
+    momentum = solver_option("momentum", 0.9);
+  }
+  else if(solver == "adam")
+  {
+    adam_m = m_state["adam/m"].value();
+    adam_v = m_state["adam/v"].value();
+    adam_t = m_state["adam/t"].to_int32();
+    beta1 = solver_option("beta1", 0.9);
+    beta2 = solver_option("beta2", 0.999);
+    epsilon = solver_option("epsilon", 1e-8);
+  }
+
+  for(int e = 0; e < epochs; ++e)
+  {
+    for(int i = 0; i < size; ++i)
+    {
+      grad[i] = (detail::dot(gram + i * size, w, size) - rhs[i]) * inv_count;
+    }
+
+    if(velocity != NULL)
+    {
+      for(int i = 0; i < size; ++i)
+      {
+        velocity[i] = momentum * velocity[i] + grad[i];
+        w[i] -= learning_rate * velocity[i];
+      }
+    }
+    else if(adam_m != NULL)
+    {
+      adam_t++;
+      const double m_scale = 1.0 / (1.0 - std::pow(beta1, adam_t));
+      const double v_scale = 1.0 / (1.0 - std::pow(beta2, adam_t));
+      for(int i = 0; i < size; ++i)
+      {
+        adam_m[i] = beta1 * adam_m[i] + (1.0 - beta1) * grad[i];
+        adam_v[i] = beta2 * adam_v[i] + (1.0 - beta2) * grad[i] * grad[i];
+        w[i] -= learning_rate * (adam_m[i] * m_scale) /
+                (std::sqrt(adam_v[i] * v_scale) + epsilon);
+      }
+    }
+    else
+    {
+      detail::axpy(-learning_rate, &grad[0], w, size);
+    }
+  }
+
+  if(adam_m != NULL)
+  {
+    m_state["adam/t"] = adam_t;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::add_sample(const double *x, double value)
+{
+  const int size = this->size();
+  const int window = (int) m_state["samples/y"].dtype().number_of_elements();
+  const int next = m_state["samples/next"].to_int32();
+  double *samples_x = m_state["samples/x"].value();
+  double *samples_y = m_state["samples/y"].value();
+
+  for(int i = 0; i < size; ++i)
+  {
+    samples_x[next * size + i] = x[i];
+  }
+  samples_y[next] = value;
+
+  m_state["samples/next"] = (next + 1) % window;
+  m_state["samples/count"] = std::min(m_state["samples/count"].to_int32() + 1,
+                                      window);
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::sample_terms(double *terms) const
+{
+  const int size = this->size();
+  const int count = m_state["samples/count"].to_int32();
+  const double *samples_x = m_state["samples/x"].value();
+  const double *samples_y = m_state["samples/y"].value();
+
+  double *gram = terms;
+  double *rhs  = terms + size * size;
+  for(int s = 0; s < count; ++s)
+  {
+    const double *x = samples_x + s * size;
+    for(int i = 0; i < size; ++i)
+    {
+      detail::axpy(x[i], x, gram + i * size, size);
+    }
+    detail::axpy(samples_y[s], x, rhs, size);
+  }
+  terms[size * size + size + 1] = count;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::rls_update(const double *x, double value)
+{
+  // standard recursive least squares with forgetting factor lambda:
+  //   k = P x / (lambda + x^T P x)
+  //   w += k (y - w.x)
+  //   P = (P - k x^T P) / lambda
+  // which tracks the exact (weighted) least squares fit in O(size^2)
+  const int size = this->size();
+  const double lambda = solver_option("forgetting_factor", 1.0);
+  double *w = m_state["weights"].value();
+  double *p = m_state["rls_p"].value();
+
+  std::vector<double> px(size);
+  for(int i = 0; i < size; ++i)
+  {
+    px[i] = detail::dot(p + i * size, x, size);
+  }
+  const double denom = lambda + detail::dot(x, &px[0], size);
+  const double err = value - detail::dot(w, x, size);
+  detail::axpy(err / denom, &px[0], w, size);
+
+  // P is symmetric, so x^T P = (P x)^T
+  const double inv_lambda = 1.0 / lambda;
+  for(int i = 0; i < size; ++i)
+  {
+    const double ki = px[i] / denom;
+    for(int j = 0; j < size; ++j)
+    {
+      p[i * size + j] = (p[i * size + j] - ki * px[j]) * inv_lambda;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::normal_solve()
+{
+  const int size = this->size();
+  std::vector<double> terms(num_terms(), 0.0);
+  sample_terms(&terms[0]);
+
+  std::vector<double> gram(terms.begin(), terms.begin() + size * size);
+  std::vector<double> rhs(terms.begin() + size * size,
+                          terms.begin() + size * size + size);
+
+  // a small ridge keeps the system solvable before the window
+  // spans the feature space
+  const double ridge = solver_option("ridge", 1e-8);
+  if(detail::cholesky_solve(gram, rhs, size, ridge))
+  {
+    double *w = m_state["weights"].value();
+    for(int i = 0; i < size; ++i)
+    {
+      w[i] = rhs[i];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+std::string
+SurrogateModel::solver_type() const
+{
+  return m_state.has_path("solver/type") ?
+         m_state["solver/type"].as_string() : "sgd";
+}
+
+//-----------------------------------------------------------------------------
+double
+SurrogateModel::solver_option(const std::string &name,
+                              double default_value) const
+{
+  if(m_state.has_child("solver") && m_state["solver"].has_child(name))
+  {
+    return m_state["solver"][name].to_float64();
+  }
+  return default_value;
+}
+
+//-----------------------------------------------------------------------------
+double
+SurrogateModel::predict() const
+{
+  const int lags = this->lags();
+  const int num_obs = num_observations();
+  if(lags == 0)
+  {
+    return 0.0;
+  }
+
+  const double *x = m_state["features"].value();
+  if(ready())
+  {
+    const double *w = m_state["weights"].value();
+    return detail::dot(w, x, size());
+  }
+  // not enough history, fall back to persistence
+  if(num_obs > 0)
+  {
+    return x[num_obs];
+  }
+  return 0.0;
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::lags() const
+{
+  return m_state.has_child("lags") ? m_state["lags"].to_int32() : 0;
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::num_exogenous() const
+{
+  return m_state.has_child("num_exogenous") ?
+         m_state["num_exogenous"].to_int32() : 0;
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::size() const
+{
+  return lags() + 1 + num_exogenous();
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::exogenous(const double *values)
+{
+  const int num_exogenous = this->num_exogenous();
+  double *x = m_state["features"].value();
+  for(int i = 0; i < num_exogenous; ++i)
+  {
+    x[1 + lags() + i] = values[i];
+  }
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::num_observations() const
+{
+  return m_state.has_child("num_observations") ?
+         m_state["num_observations"].to_int32() : 0;
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::num_updates() const
+{
+  return m_state.has_child("num_updates") ?
+         m_state["num_updates"].to_int32() : 0;
+}
+
+//-----------------------------------------------------------------------------
+int
+SurrogateModel::last_cycle() const
+{
+  return m_state.has_child("last_cycle") ?
+         m_state["last_cycle"].to_int32() : -1;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::last_cycle(int cycle)
+{
+  m_state["last_cycle"] = cycle;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateModel::info(conduit::Node &out) const
+{
+  out.reset();
+  const int lags = this->lags();
+  out["lags"] = lags;
+  out["num_observations"] = num_observations();
+  out["num_updates"] = num_updates();
+  out["ready"] = ready() ? "true" : "false";
+  if(lags > 0)
+  {
+    out["solver"] = solver_type();
+    out["epochs"] = m_state["epochs"];
+    out["learning_rate"] = m_state["learning_rate"];
+    out["weights"] = m_state["weights"];
+    // don't report the bias slot as part of the window
+    const double *x = m_state["features"].value();
+    out["window"].set(x + 1, lags);
+    if(num_exogenous() > 0)
+    {
+      out["exogenous"].set(x + 1 + lags, num_exogenous());
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool
+verify_surrogate_solver(const conduit::Node &params,
+                        conduit::Node &info)
+{
+  if(!params.has_child("solver"))
+  {
+    return true;
+  }
+
+  bool res = true;
+  conduit::Node solver;
+  const conduit::Node &n_solver = params["solver"];
+  if(n_solver.dtype().is_string())
+  {
+    solver["type"] = n_solver.as_string();
+  }
+  else if(n_solver.dtype().is_object() &&
+          n_solver.has_child("type") &&
+          n_solver["type"].dtype().is_string())
+  {
+    solver.set(n_solver);
+  }
+  else
+  {
+    info["errors"].append() = "'solver' must be a string or have a string 'type'";
+    return false;
+  }
+
+  const std::string type = solver["type"].as_string();
+  if(type != "sgd" && type != "momentum" && type != "adam" &&
+     type != "rls" && type != "normal")
+  {
+    res = false;
+    info["errors"].append() = "'solver/type' must be one of 'sgd', "
+                              "'momentum', 'adam', 'rls', or 'normal'";
+  }
+
+  std::vector<std::string> options;
+  options.push_back("momentum");
+  options.push_back("beta1");
+  options.push_back("beta2");
+  options.push_back("epsilon");
+  options.push_back("forgetting_factor");
+  options.push_back("ridge");
+  options.push_back("window");
+  for(size_t i = 0; i < options.size(); ++i)
+  {
+    res &= check_numeric(options[i], solver, info, false);
+  }
+
+  if(solver.has_child("window") && solver["window"].to_int32() < 1)
+  {
+    res = false;
+    info["errors"].append() = "'solver/window' must be greater than 0";
+  }
+
+  if(solver.has_child("forgetting_factor") &&
+     (solver["forgetting_factor"].to_float64() <= 0.0 ||
+      solver["forgetting_factor"].to_float64() > 1.0))
+  {
+    res = false;
+    info["errors"].append() = "'solver/forgetting_factor' must be in (0, 1]";
+  }
+
+  if(solver.has_child("ridge") && solver["ridge"].to_float64() <= 0.0)
+  {
+    res = false;
+    info["errors"].append() = "'solver/ridge' must be positive";
+  }
+
+  options.push_back("type");
+  std::string surprises = surprise_check(options, solver);
+  if(surprises != "")
+  {
+    res = false;
+    info["errors"].append() = surprises;
+  }
+
+  return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+surrogate_solver_options(const conduit::Node &params,
+                         conduit::Node &solver)
+{
+  solver.reset();
+  if(!params.has_child("solver"))
+  {
+    solver["type"] = "sgd";
+  }
+  else if(params["solver"].dtype().is_string())
+  {
+    solver["type"] = params["solver"].as_string();
+  }
+  else
+  {
+    solver.set(params["solver"]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+Surrogate::Surrogate()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+Surrogate::~Surrogate()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Surrogate::declare_interface(Node &i)
+{
+    i["type_name"]   = "surrogate";
+    i["port_names"].append() = "in";
+    i["output_port"] = "false";
+    i["thread_safe"] = "false";
+}
+
+//-----------------------------------------------------------------------------
+bool
+Surrogate::verify_params(const conduit::Node &params,
+                         conduit::Node &info)
+{
+    info.reset();
+    bool res = check_string("expression",params, info, false);
+    res &= check_string("field",params, info, false);
+    res &= check_string("reduction",params, info, false);
+    res &= check_string("distributed",params, info, false);
+    res &= check_list("features",params, info, false);
+    res &= verify_surrogate_solver(params, info);
+
+    if(params.has_path("distributed") &&
+       params["distributed"].dtype().is_string() &&
+       params["distributed"].as_string() == "true")
+    {
+      conduit::Node solver;
+      surrogate_solver_options(params, solver);
+      const std::string type = solver["type"].as_string();
+      if(type == "rls" || type == "normal")
+      {
+        res = false;
+        info["errors"].append() = "distributed training supports the "
+                                  "'sgd', 'momentum', and 'adam' solvers";
+      }
+    }
+    res &= check_numeric("lags",params, info, false);
+    res &= check_numeric("learning_rate",params, info, false);
+    res &= check_numeric("epochs",params, info, false);
+    res &= check_numeric("initial_weight",params, info, false);
+    res &= check_numeric("train_cycles",params, info, false);
+
+    if(params.has_path("expression") == params.has_path("field"))
+    {
+      res = false;
+      info["errors"].append() = "Surrogate requires exactly one of "
+                                "'expression' or 'field'";
+    }
+
+    if(params.has_path("reduction") && params["reduction"].dtype().is_string())
+    {
+      const std::string reduction = params["reduction"].as_string();
+      if(reduction != "max" && reduction != "min" &&
+         reduction != "sum" && reduction != "avg")
+      {
+        res = false;
+        info["errors"].append() = "'reduction' must be one of "
+                                  "'max', 'min', 'sum', or 'avg'";
+      }
+    }
+
+    if(params.has_path("distributed") && params["distributed"].dtype().is_string())
+    {
+      const std::string distributed = params["distributed"].as_string();
+      if(distributed != "true" && distributed != "false")
+      {
+        res = false;
+        info["errors"].append() = "'distributed' must be 'true' or 'false'";
+      }
+    }
+
+    if(params.has_path("lags") && params["lags"].to_int32() < 1)
+    {
+      res = false;
+      info["errors"].append() = "'lags' must be greater than 0";
+    }
+
+    if(params.has_path("epochs") && params["epochs"].to_int32() < 0)
+    {
+      res = false;
+      info["errors"].append() = "'epochs' must be non-negative";
+    }
+
+    std::vector<std::string> valid_paths;
+    valid_paths.push_back("expression");
+    valid_paths.push_back("field");
+    valid_paths.push_back("reduction");
+    valid_paths.push_back("distributed");
+    valid_paths.push_back("features");
+    valid_paths.push_back("solver");
+    valid_paths.push_back("lags");
+    valid_paths.push_back("learning_rate");
+    valid_paths.push_back("epochs");
+    valid_paths.push_back("initial_weight");
+    valid_paths.push_back("train_cycles");
+
+    std::vector<std::string> ignore_paths;
+    // feature entries are checked when they are computed
+    ignore_paths.push_back("features");
+    // solver options are checked above
+    ignore_paths.push_back("solver");
+
+    std::string surprises = surprise_check(valid_paths, ignore_paths, params);
+
+    if(surprises != "")
+    {
+      res = false;
+      info["errors"].append() = surprises;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+Surrogate::execute()
+{
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("Surrogate input must be a data object");
+    }
+
+    DataObject *data_object = input<DataObject>(0);
+    if(!data_object->is_valid())
+    {
+      return;
+    }
+
+    // defaults match the python sgd loop these replace
+    int lags = 4;
+    double learning_rate = 1e-7;
+    int epochs = 100;
+    double initial_weight = 0.05;
+    int train_cycles = -1;
+
+    if(params().has_path("lags"))
+    {
+      lags = params()["lags"].to_int32();
+    }
+    if(params().has_path("learning_rate"))
+    {
+      learning_rate = params()["learning_rate"].to_float64();
+    }
+    if(params().has_path("epochs"))
+    {
+      epochs = params()["epochs"].to_int32();
+    }
+    if(params().has_path("initial_weight"))
+    {
+      initial_weight = params()["initial_weight"].to_float64();
+    }
+    if(params().has_path("train_cycles"))
+    {
+      train_cycles = params()["train_cycles"].to_int32();
+    }
+
+    bool distributed = params().has_path("distributed") &&
+                       params()["distributed"].as_string() == "true";
+
+    SurrogateModel surrogate(filter_state(graph().workspace(), name()));
+
+    conduit::Node n_cycle
+      = expressions::get_state_var(*data_object->as_node().get(), "cycle");
+    int cycle = n_cycle.dtype().is_empty() ? -1 : n_cycle.to_int32();
+
+    // optional exogenous inputs, all computed in one fused pass
+    conduit::Node features;
+    int num_exogenous = 0;
+    bool fresh_features = cycle == -1 || cycle != surrogate.last_cycle();
+    if(params().has_path("features") && fresh_features)
+    {
+      features = expressions::field_features(*data_object->as_node(),
+                                             params()["features"]);
+      num_exogenous = (int) features["values"].dtype().number_of_elements();
+    }
+    else if(params().has_path("features"))
+    {
+      num_exogenous = surrogate.num_exogenous();
+    }
+
+    conduit::Node solver;
+    surrogate_solver_options(params(), solver);
+
+    if(!surrogate.configured(lags,
+                             learning_rate,
+                             epochs,
+                             initial_weight,
+                             num_exogenous,
+                             solver))
+    {
+      // new model or the actions changed the hyper-parameters
+      surrogate.configure(lags,
+                          learning_rate,
+                          epochs,
+                          initial_weight,
+                          num_exogenous,
+                          solver);
+    }
+
+    // the target is either a (global) expression or a reduction
+    // of a field over this rank's domains
+    std::string expression;
+    std::string field;
+    std::string reduction = "max";
+    if(params().has_path("expression"))
+    {
+      expression = params()["expression"].as_string();
+    }
+    else
+    {
+      field = params()["field"].as_string();
+      if(params().has_path("reduction"))
+      {
+        reduction = params()["reduction"].as_string();
+      }
+    }
+
+    // only feed the model once per cycle, executing the same
+    // cycle twice should not bias the window
+    bool fresh = cycle == -1 || cycle != surrogate.last_cycle();
+
+    double value = 0.0;
+    double loss = 0.0;
+    bool has_value = true;
+    // seconds spent on each phase, reported for benchmarking
+    float evaluate_time = 0.0f;
+    float train_time = 0.0f;
+    if(fresh)
+    {
+      flow::Timer evaluate_timer;
+      if(!expression.empty())
+      {
+        runtime::expressions::ExpressionEval eval(*data_object);
+        conduit::Node res = eval.evaluate(expression, name());
+        value = res["value"].to_float64();
+      }
+      else
+      {
+        has_value = detail::local_field_reduction(*data_object->as_node(),
+                                                  field,
+                                                  reduction,
+                                                  value);
+      }
+      evaluate_time = evaluate_timer.elapsed();
+
+      flow::Timer train_timer;
+      bool train = train_cycles < 0 || surrogate.num_updates() < train_cycles;
+      if(!distributed)
+      {
+        if(has_value)
+        {
+          loss = surrogate.observe(value, train);
+        }
+      }
+      else
+      {
+        // every rank contributes its normal equation terms (or zeros),
+        // one fused reduction sums them, and all ranks take identical
+        // steps so the weights stay the same everywhere
+        std::vector<double> terms(surrogate.num_terms(), 0.0);
+        if(has_value)
+        {
+          surrogate.accumulate_terms(value, &terms[0]);
+        }
+#ifdef ASCENT_MPI_ENABLED
+        MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &terms[0],
+                      (int)terms.size(),
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      mpi_comm);
+#endif
+        const double count = terms[terms.size() - 1];
+        if(count > 0.0)
+        {
+          loss = terms[terms.size() - 2] / count;
+          if(train)
+          {
+            surrogate.update(&terms[0]);
+          }
+        }
+        if(has_value)
+        {
+          surrogate.push(value);
+        }
+      }
+      // the features of this cycle are used to predict the next value
+      if(num_exogenous > 0)
+      {
+        surrogate.exogenous(features["values"].as_float64_ptr());
+      }
+      surrogate.last_cycle(cycle);
+      train_time = train_timer.elapsed();
+    }
+
+    flow::Timer predict_timer;
+    const double prediction = surrogate.predict();
+    const float predict_time = predict_timer.elapsed();
+
+    // add this to the extract results in the registry
+    Node &einfo = detail::extract_list(graph().workspace()).append();
+    einfo["type"] = "surrogate";
+    einfo["name"] = name();
+    einfo["cycle"] = cycle;
+    if(!expression.empty())
+    {
+      einfo["expression"] = expression;
+    }
+    else
+    {
+      einfo["field"] = field;
+      einfo["reduction"] = reduction;
+    }
+    if(distributed)
+    {
+      einfo["distributed"] = "true";
+    }
+    if(fresh && has_value)
+    {
+      einfo["value"] = value;
+      einfo["loss"] = loss;
+    }
+    if(features.has_child("values"))
+    {
+      einfo["features"] = features;
+    }
+    einfo["prediction"] = prediction;
+    einfo["timings/evaluate"] = evaluate_time;
+    einfo["timings/train"] = train_time;
+    einfo["timings/predict"] = predict_time;
+    surrogate.info(einfo["model"]);
+}
+
+//-----------------------------------------------------------------------------
+FieldSurrogate::FieldSurrogate()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+FieldSurrogate::~FieldSurrogate()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+FieldSurrogate::declare_interface(Node &i)
+{
+    i["type_name"]   = "field_surrogate";
+    i["port_names"].append() = "in";
+    i["output_port"] = "true";
+    i["thread_safe"] = "false";
+}
+
+//-----------------------------------------------------------------------------
+bool
+FieldSurrogate::verify_params(const conduit::Node &params,
+                              conduit::Node &info)
+{
+    info.reset();
+    bool res = check_string("field",params, info, true);
+    res &= check_string("output_field",params, info, false);
+    res &= check_string("rollout",params, info, false);
+    res &= check_numeric("lags",params, info, false);
+    res &= check_numeric("step_size",params, info, false);
+    res &= check_numeric("train_cycles",params, info, false);
+    res &= check_numeric("memory_budget",params, info, false);
+
+    if(params.has_path("output_field") &&
+       params["output_field"].dtype().is_string() &&
+       params.has_path("field") &&
+       params["field"].dtype().is_string() &&
+       params["output_field"].as_string() == params["field"].as_string())
+    {
+      res = false;
+      info["errors"].append() = "'output_field' must differ from 'field'";
+    }
+
+    if(params.has_path("lags") && params["lags"].to_int32() < 1)
+    {
+      res = false;
+      info["errors"].append() = "'lags' must be greater than 0";
+    }
+
+    if(params.has_path("step_size"))
+    {
+      const double step_size = params["step_size"].to_float64();
+      if(step_size <= 0.0 || step_size >= 2.0)
+      {
+        res = false;
+        info["errors"].append() = "'step_size' must be in (0, 2)";
+      }
+    }
+
+    if(params.has_path("memory_budget") &&
+       params["memory_budget"].to_float64() <= 0.0)
+    {
+      res = false;
+      info["errors"].append() = "'memory_budget' must be positive";
+    }
+
+    if(params.has_path("rollout") && params["rollout"].dtype().is_string())
+    {
+      const std::string rollout = params["rollout"].as_string();
+      if(rollout != "true" && rollout != "false")
+      {
+        res = false;
+        info["errors"].append() = "'rollout' must be 'true' or 'false'";
+      }
+    }
+
+    std::vector<std::string> valid_paths;
+    valid_paths.push_back("field");
+    valid_paths.push_back("output_field");
+    valid_paths.push_back("rollout");
+    valid_paths.push_back("lags");
+    valid_paths.push_back("step_size");
+    valid_paths.push_back("train_cycles");
+    valid_paths.push_back("memory_budget");
+
+    std::string surprises = surprise_check(valid_paths, params);
+
+    if(surprises != "")
+    {
+      res = false;
+      info["errors"].append() = surprises;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+FieldSurrogate::execute()
+{
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("field_surrogate input must be a DataObject");
+    }
+
+    DataObject *d_input = input<DataObject>(0);
+    if(!d_input->is_valid())
+    {
+      set_output<DataObject>(d_input);
+      return;
+    }
+
+    std::shared_ptr<conduit::Node> n_input = d_input->as_low_order_bp();
+    const conduit::Node &dataset = *n_input;
+
+    const std::string field = params()["field"].as_string();
+    std::string output_field = field + "_prediction";
+    int lags = 2;
+    double step_size = 0.5;
+    int train_cycles = -1;
+    // bytes of model state this rank may hold
+    double memory_budget = 512.0 * 1024.0 * 1024.0;
+    bool rollout = false;
+
+    if(params().has_path("output_field"))
+    {
+      output_field = params()["output_field"].as_string();
+    }
+    if(params().has_path("lags"))
+    {
+      lags = params()["lags"].to_int32();
+    }
+    if(params().has_path("step_size"))
+    {
+      step_size = params()["step_size"].to_float64();
+    }
+    if(params().has_path("train_cycles"))
+    {
+      train_cycles = params()["train_cycles"].to_int32();
+    }
+    if(params().has_path("memory_budget"))
+    {
+      memory_budget = params()["memory_budget"].to_float64();
+    }
+    if(params().has_path("rollout"))
+    {
+      rollout = params()["rollout"].as_string() == "true";
+    }
+
+    conduit::Node &state = filter_state(graph().workspace(), name());
+    if(!state.has_child("lags") ||
+       state["lags"].to_int32() != lags ||
+       state["field"].as_string() != field)
+    {
+      // new model or the actions changed it
+      state.reset();
+      state["field"] = field;
+      state["lags"] = lags;
+      state["num_updates"] = 0;
+      state["rollout_steps"] = 0;
+    }
+
+    conduit::Node n_cycle = expressions::get_state_var(dataset, "cycle");
+    int cycle = n_cycle.dtype().is_empty() ? -1 : n_cycle.to_int32();
+    const bool fresh = cycle == -1 ||
+                       !state.has_child("last_cycle") ||
+                       cycle != state["last_cycle"].to_int32();
+
+    // check the budget before allocating anything: each value needs
+    // its lag history, its weights, and its prediction
+    const std::string path = "fields/" + field;
+    std::vector<std::string> components;
+    index_t num_values = 0;
+    for(int i = 0; i < dataset.number_of_children(); ++i)
+    {
+      const conduit::Node &dom = dataset.child(i);
+      if(!dom.has_path(path))
+      {
+        continue;
+      }
+      const conduit::Node &values = dom[path + "/values"];
+      detail::field_components(values, components);
+      for(size_t c = 0; c < components.size(); ++c)
+      {
+        num_values += detail::component_size(values, components[c]);
+      }
+    }
+
+    const double bytes = double(num_values) * (2 * lags + 2) * sizeof(float64);
+    if(bytes > memory_budget)
+    {
+      ASCENT_ERROR("field_surrogate '"<<name()<<"' needs "<<bytes
+                   <<" bytes of model state for "<<num_values
+                   <<" values with "<<lags<<" lags, which exceeds its "
+                   <<"'memory_budget' of "<<memory_budget
+                   <<". Reduce 'lags' or raise 'memory_budget'.");
+    }
+
+    const bool train = train_cycles < 0 ||
+                       state["num_updates"].to_int32() < train_cycles;
+
+    // the output is a new mesh that views the coordsets, topologies,
+    // and fields of the input and owns a copy of the prediction, so the
+    // input and the model stay untouched. the deleter holds on to the
+    // input, which the views point into
+    std::shared_ptr<conduit::Node> n_output(new conduit::Node(),
+                                            [n_input](conduit::Node *n)
+                                            {
+                                              delete n;
+                                            });
+    const bool named_domains = dataset.dtype().is_object();
+    for(int i = 0; i < dataset.number_of_children(); ++i)
+    {
+      const conduit::Node &dom = dataset.child(i);
+      conduit::Node &out_dom = named_domains ? n_output->add_child(dom.name())
+                                             : n_output->append();
+      for(int c = 0; c < dom.number_of_children(); ++c)
+      {
+        const conduit::Node &child = dom.child(c);
+        if(child.name() != "fields")
+        {
+          out_dom[child.name()].set_external(child);
+          continue;
+        }
+        for(int f = 0; f < child.number_of_children(); ++f)
+        {
+          out_dom["fields"].add_child(child.child(f).name())
+            .set_external(child.child(f));
+        }
+      }
+    }
+
+    double sum_sq_err = 0.0;
+    double count = 0.0;
+    for(int i = 0; i < dataset.number_of_children(); ++i)
+    {
+      const conduit::Node &dom = dataset.child(i);
+      if(!dom.has_path(path))
+      {
+        continue;
+      }
+      const conduit::Node &n_field = dom[path];
+
+      std::string domain_key;
+      if(dom.has_path("state/domain_id"))
+      {
+        domain_key = std::to_string(dom["state/domain_id"].to_int64());
+      }
+      else
+      {
+        domain_key = std::to_string(i);
+      }
+      conduit::Node &models = state["domains"].add_child(domain_key);
+
+      // replaces any input field of the same name
+      conduit::Node &out = n_output->child(i)["fields"].add_child(output_field);
+      out.reset();
+      out["association"] = n_field["association"];
+      out["topology"] = n_field["topology"];
+
+      detail::field_components(n_field["values"], components);
+      for(size_t c = 0; c < components.size(); ++c)
+      {
+        const std::string &comp = components[c];
+        conduit::Node &model = models.add_child(comp.empty() ? "values" : comp);
+        const index_t size = detail::component_size(n_field["values"], comp);
+        if(!model.has_child("prediction") ||
+           model["prediction"].dtype().number_of_elements() != size)
+        {
+          // new domain or the mesh changed size
+          detail::init_field_model(model, lags, size);
+        }
+
+        if(fresh)
+        {
+          // reads the published values in place
+          conduit::Node res = expressions::field_surrogate_step(n_field,
+                                                                model,
+                                                                step_size,
+                                                                train,
+                                                                comp);
+          sum_sq_err += res["sum_sq_err"].to_float64();
+          count += res["count"].to_float64();
+        }
+        else if(rollout)
+        {
+          // no new data: advance the model along its own prediction
+          conduit::Node predicted;
+          predicted["values"].set(model["prediction"]);
+          expressions::field_surrogate_step(predicted,
+                                            model,
+                                            step_size,
+                                            false);
+        }
+
+        if(comp.empty())
+        {
+          out["values"].set(model["prediction"]);
+        }
+        else
+        {
+          out["values"][comp].set(model["prediction"]);
+        }
+      }
+    }
+
+    if(fresh)
+    {
+      state["last_cycle"] = cycle;
+      state["rollout_steps"] = 0;
+      if(count > 0.0)
+      {
+        state["loss"] = sum_sq_err / count;
+        if(train)
+        {
+          state["num_updates"] = state["num_updates"].to_int32() + 1;
+        }
+      }
+    }
+    else if(rollout)
+    {
+      state["rollout_steps"] = state["rollout_steps"].to_int32() + 1;
+    }
+
+    DataObject *d_output = new DataObject();
+    d_output->reset(n_output);
+    set_output<DataObject>(d_output);
+}
+
+//-----------------------------------------------------------------------------
+POD::POD()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+POD::~POD()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+POD::declare_interface(Node &i)
+{
+    i["type_name"]   = "pod";
+    i["port_names"].append() = "in";
+    i["output_port"] = "false";
+    i["thread_safe"] = "false";
+}
+
+//-----------------------------------------------------------------------------
+bool
+POD::verify_params(const conduit::Node &params,
+                   conduit::Node &info)
+{
+    info.reset();
+    bool res = check_list("fields",params, info, true);
+    res &= check_numeric("rank",params, info, false);
+    res &= check_numeric("train_cycles",params, info, false);
+
+    if(params.has_path("fields") && params["fields"].dtype().is_list())
+    {
+      const conduit::Node &fields = params["fields"];
+      if(fields.number_of_children() == 0)
+      {
+        res = false;
+        info["errors"].append() = "'fields' must not be empty";
+      }
+      for(int i = 0; i < fields.number_of_children(); ++i)
+      {
+        if(!fields.child(i).dtype().is_string())
+        {
+          res = false;
+          info["errors"].append() = "'fields' entries must be strings";
+        }
+      }
+    }
+
+    if(params.has_path("rank") && params["rank"].to_int32() < 1)
+    {
+      res = false;
+      info["errors"].append() = "'rank' must be greater than 0";
+    }
+
+    std::vector<std::string> valid_paths;
+    valid_paths.push_back("fields");
+    valid_paths.push_back("rank");
+    valid_paths.push_back("train_cycles");
+
+    std::vector<std::string> ignore_paths;
+    ignore_paths.push_back("fields");
+
+    std::string surprises = surprise_check(valid_paths, ignore_paths, params);
+
+    if(surprises != "")
+    {
+      res = false;
+      info["errors"].append() = surprises;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+POD::execute()
+{
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("POD input must be a data object");
+    }
+
+    DataObject *data_object = input<DataObject>(0);
+    if(!data_object->is_valid())
+    {
+      return;
+    }
+    std::shared_ptr<conduit::Node> n_input = data_object->as_node();
+
+    const conduit::Node &fields = params()["fields"];
+    int rank_budget = 8;
+    int train_cycles = -1;
+    if(params().has_path("rank"))
+    {
+      rank_budget = params()["rank"].to_int32();
+    }
+    if(params().has_path("train_cycles"))
+    {
+      train_cycles = params()["train_cycles"].to_int32();
+    }
+
+    conduit::Node &state = filter_state(graph().workspace(), name());
+
+    conduit::Node n_cycle = expressions::get_state_var(*n_input, "cycle");
+    int cycle = n_cycle.dtype().is_empty() ? -1 : n_cycle.to_int32();
+    const bool fresh = cycle == -1 ||
+                       !state.has_child("last_cycle") ||
+                       cycle != state["last_cycle"].to_int32();
+
+    if(fresh)
+    {
+      std::vector<double> x;
+      detail::local_snapshot(*n_input, fields, x);
+      const int n = (int) x.size();
+
+      // the basis rows of this rank no longer match its snapshot
+      bool reset = !state.has_child("rank_budget") ||
+                   state["rank_budget"].to_int32() != rank_budget ||
+                   state["num_values"].to_int64() != n ||
+                   state["fields"].to_yaml() != fields.to_yaml();
+      int r = state.has_child("rank") ? state["rank"].to_int32() : 0;
+#ifdef ASCENT_MPI_ENABLED
+      // the packed reduction is sized by r, so the ranks agree on it
+      // first. ranks with different bases (e.g. one lost its state)
+      // all start over together
+      MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+      int r_bounds[2] = {r, -r};
+      MPI_Allreduce(MPI_IN_PLACE,
+                    r_bounds,
+                    2,
+                    MPI_INT,
+                    MPI_MAX,
+                    mpi_comm);
+      if(r_bounds[0] != -r_bounds[1])
+      {
+        reset = true;
+      }
+      r = r_bounds[0];
+#endif
+
+      // every global quantity of the update in one packed reduction:
+      // [reset | x.x | U^T x | U^T U]
+      std::vector<double> packed(2 + r + r * r, 0.0);
+      packed[0] = reset ? 1.0 : 0.0;
+      if(n > 0)
+      {
+        packed[1] = detail::dot(&x[0], &x[0], n);
+      }
+      if(!reset && n > 0)
+      {
+        const float64 *basis = state["basis"].value();
+        for(int j = 0; j < r; ++j)
+        {
+          packed[2 + j] = detail::dot(&basis[j * n], &x[0], n);
+          for(int c = 0; c <= j; ++c)
+          {
+            const double g = detail::dot(&basis[j * n], &basis[c * n], n);
+            packed[2 + r + j * r + c] = g;
+            packed[2 + r + c * r + j] = g;
+          }
+        }
+      }
+#ifdef ASCENT_MPI_ENABLED
+      MPI_Allreduce(MPI_IN_PLACE,
+                    &packed[0],
+                    (int)packed.size(),
+                    MPI_DOUBLE,
+                    MPI_SUM,
+                    mpi_comm);
+#endif
+
+      if(packed[0] > 0.0)
+      {
+        // any rank reset means all ranks start over together
+        state.reset();
+        state["fields"].set(fields);
+        state["rank_budget"] = rank_budget;
+        state["num_values"] = (int64) n;
+        state["rank"] = 0;
+        state["num_snapshots"] = 0;
+        state["basis"].set(conduit::DataType::float64(n * rank_budget));
+        state["singular_values"].set(conduit::DataType::float64(rank_budget));
+        packed.resize(2);
+      }
+
+      const bool train = train_cycles < 0 ||
+                         state["num_snapshots"].to_int32() < train_cycles;
+      std::vector<double> coefficients;
+      detail::pod_update(state, x, packed, train, coefficients);
+      if(train)
+      {
+        state["num_snapshots"] = state["num_snapshots"].to_int32() + 1;
+      }
+      state["last_cycle"] = cycle;
+
+      state["coefficients"].set(coefficients);
+      double captured = 0.0;
+      for(size_t j = 0; j < coefficients.size(); ++j)
+      {
+        captured += coefficients[j] * coefficients[j];
+      }
+      state["residual"] = packed[1] > 0.0
+                          ? std::sqrt(std::max(1.0 - captured / packed[1], 0.0))
+                          : 0.0;
+
+      // the modal coefficients become a time series in the expression
+      // cache so history() and triggers can use them
+      conduit::Node record;
+      record["value"].set(coefficients);
+      record["type"] = "array";
+      runtime::expressions::ExpressionEval::record(name(), cycle, record);
+      for(size_t j = 0; j < coefficients.size(); ++j)
+      {
+        conduit::Node mode;
+        mode["value"] = coefficients[j];
+        mode["type"] = "double";
+        std::ostringstream mode_name;
+        mode_name << name() << "_mode_" << j;
+        runtime::expressions::ExpressionEval::record(mode_name.str(),
+                                                     cycle,
+                                                     mode);
+      }
+    }
+
+    // add this to the extract results in the registry
+    Node &einfo = detail::extract_list(graph().workspace()).append();
+    einfo["type"] = "pod";
+    einfo["name"] = name();
+    einfo["cycle"] = cycle;
+    einfo["fields"].set(fields);
+    const int rank = state["rank"].to_int32();
+    einfo["rank"] = rank;
+    einfo["num_snapshots"] = state["num_snapshots"];
+    einfo["singular_values"].set(state["singular_values"].as_float64_ptr(), rank);
+    einfo["coefficients"] = state["coefficients"];
+    einfo["residual"] = state["residual"];
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,246 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_runtime_surrogate_filters.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_RUNTIME_SURROGATE_FILTERS
+#define ASCENT_RUNTIME_SURROGATE_FILTERS
+
+#include <ascent.hpp>
+
+#include <flow_filter.hpp>
+
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+namespace filters
+{
+
+//-----------------------------------------------------------------------------
+///
+/// Online autoregressive surrogate model.
+///
+/// Holds a window of the last `lags` observations of a scalar target
+/// and a set of linear weights (one bias + one per lag). Each new
+/// observation is used to update the weights, after which the window
+/// slides forward. The default solver takes `epochs` SGD steps on the
+/// squared error of the new observation. The other solvers are
+/// mini-batch gradient descent with momentum or Adam over a sliding
+/// window of samples, recursive least squares (exact running fit in
+/// O(size^2) per observation), and a closed form normal equation solve
+/// over the sample window.
+///
+/// In distributed mode every rank keeps a window of its own local
+/// observations but all ranks share one set of weights, trained on
+/// the gradient summed over ranks.
+///
+/// The model does not own its data, it reads and writes a conduit
+/// node (normally the extract's entry in the runtime state store),
+/// so the model persists, can be checkpointed, and is visible to
+/// python extracts.
+///
+//-----------------------------------------------------------------------------
+class ASCENT_API SurrogateModel
+{
+public:
+    SurrogateModel(conduit::Node &state);
+   ~SurrogateModel();
+
+    // (re)sizes the model, this resets all learned state.
+    // solver holds the solver "type" (sgd, momentum, adam, rls, or
+    // normal, default sgd) and its options
+    void   configure(int lags,
+                     double learning_rate,
+                     int epochs,
+                     double initial_weight,
+                     int num_exogenous = 0,
+                     const conduit::Node &solver = conduit::Node());
+
+    bool   configured(int lags,
+                      double learning_rate,
+                      int epochs,
+                      double initial_weight,
+                      int num_exogenous = 0,
+                      const conduit::Node &solver = conduit::Node()) const;
+
+    // true once the lag window holds `lags` observations
+    bool   ready() const;
+
+    // feed a new observation, trains if the window is full
+    // returns the squared error of the pre-update prediction
+    double observe(double value, bool train);
+
+    // prediction for the next (not yet observed) value
+    double predict() const;
+
+    // data parallel training: each rank accumulates the normal
+    // equation terms of its own observation, the caller sums them
+    // over all ranks, and every rank applies the same update.
+    // terms are packed as [ x x^T | y x | squared error | count ]
+    int    num_terms() const;
+    void   accumulate_terms(double value, double *terms) const;
+    // takes `epochs` gradient steps on the mean squared error
+    // described by the summed terms
+    void   update(const double *terms);
+    // slides the window forward without training
+    void   push(double value);
+
+    // sets the exogenous inputs (e.g. field features) used to
+    // predict the next value
+    void   exogenous(const double *values);
+
+    int    lags() const;
+    int    num_exogenous() const;
+    // bias + lags + exogenous inputs
+    int    size() const;
+    int    num_observations() const;
+    int    num_updates() const;
+
+    int    last_cycle() const;
+    void   last_cycle(int cycle);
+
+    // weights, window, and counters
+    void   info(conduit::Node &out) const;
+
+private:
+    std::string solver_type() const;
+    double solver_option(const std::string &name,
+                         double default_value) const;
+
+    // runs `epochs` steps of the configured gradient solver using
+    // packed normal equation terms summed over `count` samples
+    void   gradient_steps(const double *terms, double count);
+    // sliding window of samples for the batch solvers
+    void   add_sample(const double *x, double value);
+    void   sample_terms(double *terms) const;
+    void   rls_update(const double *x, double value);
+    void   normal_solve();
+
+    // state["features"][0] is the bias term, [1..lags] the window
+    // ordered from oldest to newest observation, followed by the
+    // exogenous inputs
+    conduit::Node &m_state;
+};
+
+//-----------------------------------------------------------------------------
+// helpers for the `solver` param shared by filters that own a model.
+// `solver` is either a type name or a node with "type" and options
+bool ASCENT_API verify_surrogate_solver(const conduit::Node &params,
+                                        conduit::Node &info);
+
+void ASCENT_API surrogate_solver_options(const conduit::Node &params,
+                                         conduit::Node &solver);
+
+//-----------------------------------------------------------------------------
+///
+/// Filters Related to Surrogate Models
+///
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+class ASCENT_API Surrogate : public ::flow::Filter
+{
+public:
+    Surrogate();
+   ~Surrogate();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
+//-----------------------------------------------------------------------------
+///
+/// Streaming proper orthogonal decomposition of a set of fields.
+///
+/// Each cycle the local values of `fields` form one snapshot column,
+/// and an incremental SVD folds it into a basis of at most `rank`
+/// modes, so no snapshots are stored. With MPI the basis rows are
+/// distributed like the mesh and each update needs one packed
+/// reduction. The modal coefficients of every snapshot are recorded in
+/// the expression cache as a time series.
+///
+//-----------------------------------------------------------------------------
+class ASCENT_API POD : public ::flow::Filter
+{
+public:
+    POD();
+   ~POD();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
+//-----------------------------------------------------------------------------
+///
+/// Per element surrogate of a whole field.
+///
+/// Every element (cell or vertex) of every local domain gets its own
+/// linear autoregressive model over its last `lags` values, trained
+/// online by normalized LMS in one data parallel kernel. The filter
+/// passes the data through and adds an `output_field` holding the
+/// predicted values for the next cycle, so it can be rendered or
+/// extracted on cycles the simulation does not publish.
+///
+//-----------------------------------------------------------------------------
+class ASCENT_API FieldSurrogate : public ::flow::Filter
+{
+public:
+    FieldSurrogate();
+   ~FieldSurrogate();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
+
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+
+
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
@@ -24,11 +24,19 @@
 //-----------------------------------------------------------------------------
 // ascent includes
 //-----------------------------------------------------------------------------
+#include <ascent.hpp>
 #include <ascent_expression_eval.hpp>
 #include <ascent_data_object.hpp>
 #include <ascent_logging.hpp>
 #include <ascent_runtime_param_check.hpp>
 #include <ascent_actions_utils.hpp>
+#include <ascent_runtime_utils.hpp>
+#include <ascent_runtime_surrogate_filters.hpp>
+#include <expressions/ascent_blueprint_architect.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 // mpi related includes
 #ifdef ASCENT_MPI_ENABLED
@@ -64,6 +72,260 @@ namespace runtime
 namespace filters
 {
 
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// checks the actions, actions_file, and actions_files params shared by
+// all triggers
+bool
+verify_trigger_actions(const conduit::Node &params,
+                       conduit::Node &info)
+{
+    bool res = check_string("actions_file",params, info, false);
+    res &= check_list("actions_files",params, info, false);
+    res &= check_list("actions",params, info, false);
+
+    bool has_actions   = params.has_child("actions");
+    bool has_actions_file  = params.has_child("actions_file");
+    bool has_actions_files = params.has_child("actions_files");
+
+    if( has_actions_file && has_actions_files )
+    {
+      res = false;
+      info["errors"].append() = "Both `actions_file` and `actions_files` are "
+                                "present. Choose one or the other.";
+    }
+
+    if(has_actions && (has_actions_file || has_actions_files))
+    {
+      res = false;
+      info["errors"].append() = "Both `actions` and `actions_file(s)` are "
+                                "present. Choose one or the other.";
+    }
+
+    if(!has_actions && !(has_actions_file || has_actions_files))
+    {
+      res = false;
+      info["errors"].append() = "No trigger actions provided. Please "
+                                "specify either 'actions_file(s)' or "
+                                "'actions'.";
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+load_trigger_actions(const conduit::Node &params,
+                     int mpi_comm_id,
+                     TriggerCache *cache,
+                     conduit::Node &actions)
+{
+    // params verify above will make sure that:
+    //  actions, actions_file, and actions_files
+    // are mutually exclusive options
+
+    std::vector<std::string> actions_files;
+
+    if(params.has_child("actions_file"))
+    {
+        actions_files.push_back(params["actions_file"].as_string());
+    }
+    else if(params.has_child("actions_files"))
+    {
+        NodeConstIterator itr = params["actions_files"].children();
+        while(itr.has_next())
+        {
+            actions_files.push_back(itr.next().as_string());
+        }
+    }
+    else
+    {
+      actions = params["actions"];
+    }
+
+    if(actions_files.size() > 0)
+    {
+        // without a cache, read the files every time
+        TriggerCache files;
+        if(cache == nullptr)
+        {
+            cache = &files;
+        }
+
+        for(auto actions_file: actions_files)
+        {
+            const Node &loaded_actions = cache->actions_file(actions_file,
+                                                             mpi_comm_id);
+            NodeConstIterator itr = loaded_actions.children();
+            while(itr.has_next())
+            {
+                const Node &curr = itr.next();
+                actions.append().set(curr);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+execute_trigger_actions(const conduit::Node &data,
+                        const conduit::Node &actions,
+                        int mpi_comm_id,
+                        const std::string &trigger_name,
+                        TriggerCache *cache)
+{
+    if(cache == nullptr)
+    {
+        // nothing to keep a child runtime in
+        Ascent ascent;
+        Node ascent_opts;
+#ifdef ASCENT_MPI_ENABLED
+        ascent_opts["mpi_comm"] = mpi_comm_id;
+#endif
+        ascent.open(ascent_opts);
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.close();
+        return;
+    }
+
+    Ascent &ascent = cache->runtime(trigger_name, mpi_comm_id);
+    try
+    {
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    catch(...)
+    {
+        // don't reuse a child left in an unknown state
+        cache->release(trigger_name);
+        throw;
+    }
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+TriggerCache::TriggerCache()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+TriggerCache::~TriggerCache()
+{
+    reset();
+}
+
+//-----------------------------------------------------------------------------
+Ascent &
+TriggerCache::runtime(const std::string &trigger_name,
+                      int mpi_comm_id)
+{
+    std::unique_ptr<Ascent> &child = m_runtimes[trigger_name];
+    if(child == nullptr)
+    {
+        child.reset(new Ascent());
+        Node ascent_opts;
+#ifdef ASCENT_MPI_ENABLED
+        ascent_opts["mpi_comm"] = mpi_comm_id;
+#endif
+        child->open(ascent_opts);
+    }
+    return *child;
+}
+
+//-----------------------------------------------------------------------------
+void
+TriggerCache::release(const std::string &trigger_name)
+{
+    auto it = m_runtimes.find(trigger_name);
+    if(it != m_runtimes.end())
+    {
+        std::unique_ptr<Ascent> child = std::move(it->second);
+        m_runtimes.erase(it);
+        child->close();
+    }
+}
+
+//-----------------------------------------------------------------------------
+const conduit::Node &
+TriggerCache::actions_file(const std::string &path,
+                          int mpi_comm_id)
+{
+    // all ranks agree on the file's mtime (ns) and size, the size
+    // catches rewrites within a coarse file system mtime tick
+    conduit::int64 stamp[2] = {-1, -1};
+#ifdef ASCENT_MPI_ENABLED
+    if(mpi_comm_id != -1)
+    {
+        int rank = 0;
+        MPI_Comm mpi_comm = MPI_Comm_f2c(mpi_comm_id);
+        MPI_Comm_rank(mpi_comm, &rank);
+        if(rank == 0)
+        {
+            stamp[0] = file_modified_time(path);
+            stamp[1] = file_size(path);
+        }
+        MPI_Bcast(stamp, 2, MPI_INT64_T, 0, mpi_comm);
+    }
+#else
+    stamp[0] = file_modified_time(path);
+    stamp[1] = file_size(path);
+#endif
+
+    // names are not paths, so don't let conduit split them
+    Node &entry = m_actions_files.add_child(path);
+    if(stamp[0] != -1 &&
+       entry.has_child("mtime") &&
+       entry["mtime"].to_int64() == stamp[0] &&
+       entry["size"].to_int64() == stamp[1])
+    {
+        return entry["actions"];
+    }
+
+    entry.reset();
+    Node &actions = entry["actions"];
+    if(!load_actions_file(path, mpi_comm_id, actions))
+    {
+        ASCENT_ERROR("Failed to load actions file: " << path);
+    }
+
+    if(!actions.dtype().is_list())
+    {
+        ASCENT_ERROR("Failed actions loaded from actions file: "
+                     << path << " are not a list");
+    }
+
+    entry["mtime"] = stamp[0];
+    entry["size"] = stamp[1];
+    return actions;
+}
+
+//-----------------------------------------------------------------------------
+void
+TriggerCache::reset()
+{
+    // close in a stable order, close may be collective
+    while(!m_runtimes.empty())
+    {
+        release(m_runtimes.begin()->first);
+    }
+    m_actions_files.reset();
+}
+
+//-----------------------------------------------------------------------------
+TriggerCache *
+trigger_cache(flow::Workspace &w)
+{
+    if(w.registry().has_entry("_ascent_triggers"))
+    {
+        return w.registry().fetch<TriggerCache>("_ascent_triggers");
+    }
+    return nullptr;
+}
 
 //-----------------------------------------------------------------------------
 BasicTrigger::BasicTrigger()
@@ -85,6 +347,7 @@ BasicTrigger::declare_interface(Node &i)
     i["type_name"]   = "basic_trigger";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -95,15 +358,10 @@ BasicTrigger::verify_params(const conduit::Node &params,
     info.reset();
     bool res = check_string("condition",params, info, false);
     res &= check_string("callback",params, info, false);
-    res &= check_string("actions_file",params, info, false);
-    res &= check_list("actions_files",params, info, false);
-    res &= check_list("actions",params, info, false);
+    res &= detail::verify_trigger_actions(params, info);
 
     bool has_condition = params.has_child("condition");
     bool has_callback  = params.has_child("callback");
-    bool has_actions   = params.has_child("actions");
-    bool has_actions_file  = params.has_child("actions_file");
-    bool has_actions_files = params.has_child("actions_files");
 
     if( has_condition && has_callback )
     {
@@ -120,28 +378,6 @@ BasicTrigger::verify_params(const conduit::Node &params,
                                 " or `callback`";
     }
 
-    if( has_actions_file && has_actions_files )
-    {
-      res = false;
-      info["errors"].append() = "Both `actions_file` and `actions_files` are "
-                                "present. Choose one or the other.";
-    }
-
-    if(has_actions && (has_actions_file || has_actions_files))
-    {
-      res = false;
-      info["errors"].append() = "Both `actions` and `actions_file(s)` are "
-                                "present. Choose one or the other.";
-    }
-
-    if(!has_actions && !(has_actions_file || has_actions_files))
-    {
-      res = false;
-      info["errors"].append() = "No trigger actions provided. Please "
-                                "specify either 'actions_file(s)' or "
-                                "'actions'.";
-    }
-
     std::vector<std::string> valid_paths;
     valid_paths.push_back("condition");
     valid_paths.push_back("callback");
@@ -185,60 +421,6 @@ BasicTrigger::execute()
      mpi_comm_id = Workspace::default_mpi_comm();
 #endif
 
-    // params verify above will make sure that:
-    //  actions, actions_file, and actions_files
-    // are mutually exclusive options
-
-    conduit::Node actions;
-
-    std:vector<std::string> actions_files;
-
-    if(params().has_child("actions_file"))
-    {
-        actions_files.push_back(params()["actions_file"].as_string());
-    }
-    else if(params().has_child("actions_files"))
-    {
-        NodeConstIterator itr = params()["actions_files"].children();
-        while(itr.has_next())
-        {
-            actions_files.push_back(itr.next().as_string());
-        }
-    }
-    else
-    {
-      actions = params()["actions"];
-    }
-
-    if(actions_files.size() > 0)
-    {
-        for(auto actions_file: actions_files)
-        {
-            Node loaded_actions;
-            bool load_ok = load_actions_file(actions_file,
-                                             mpi_comm_id,
-                                             loaded_actions);
-            if(!load_ok)
-            {
-                ASCENT_ERROR("Failed to load actions file: "
-                             << actions_file);
-            }
-            
-            if(!loaded_actions.dtype().is_list())
-            {
-                ASCENT_ERROR("Failed actions loaded from actions file: "
-                             << actions_file << " are not a list");
-            }
-
-            NodeConstIterator itr = loaded_actions.children();
-            while(itr.has_next())
-            {
-                const Node &curr = itr.next();
-                actions.append().set(curr);
-            }
-        }
-    }
-
     bool has_callback = params().has_path("callback");
     bool has_condition = params().has_path("condition");
 
@@ -271,18 +453,239 @@ BasicTrigger::execute()
 
     if(fire)
     {
-        Ascent ascent;
-        Node ascent_opts;
+        TriggerCache *cache = trigger_cache(graph().workspace());
+        conduit::Node actions;
+        detail::load_trigger_actions(params(), mpi_comm_id, cache, actions);
+        detail::execute_trigger_actions(*n_input,
+                                        actions,
+                                        mpi_comm_id,
+                                        name(),
+                                        cache);
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+SurrogateTrigger::SurrogateTrigger()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+SurrogateTrigger::~SurrogateTrigger()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateTrigger::declare_interface(Node &i)
+{
+    i["type_name"]   = "surrogate_trigger";
+    i["port_names"].append() = "in";
+    i["output_port"] = "false";
+    i["thread_safe"] = "false";
+}
+
+//-----------------------------------------------------------------------------
+bool
+SurrogateTrigger::verify_params(const conduit::Node &params,
+                                conduit::Node &info)
+{
+    info.reset();
+    bool res = check_string("expression",params, info, true);
+    res &= check_numeric("tolerance",params, info, false);
+    res &= check_numeric("max_skip",params, info, false);
+    res &= check_numeric("lags",params, info, false);
+    res &= check_numeric("learning_rate",params, info, false);
+    res &= check_numeric("epochs",params, info, false);
+    res &= check_numeric("initial_weight",params, info, false);
+    res &= verify_surrogate_solver(params, info);
+    res &= detail::verify_trigger_actions(params, info);
+
+    if(params.has_path("tolerance") && params["tolerance"].to_float64() < 0.0)
+    {
+      res = false;
+      info["errors"].append() = "'tolerance' must be non-negative";
+    }
+
+    if(params.has_path("max_skip") && params["max_skip"].to_int32() < 0)
+    {
+      res = false;
+      info["errors"].append() = "'max_skip' must be non-negative";
+    }
+
+    if(params.has_path("lags") && params["lags"].to_int32() < 1)
+    {
+      res = false;
+      info["errors"].append() = "'lags' must be greater than 0";
+    }
+
+    std::vector<std::string> valid_paths;
+    valid_paths.push_back("expression");
+    valid_paths.push_back("tolerance");
+    valid_paths.push_back("max_skip");
+    valid_paths.push_back("lags");
+    valid_paths.push_back("learning_rate");
+    valid_paths.push_back("epochs");
+    valid_paths.push_back("initial_weight");
+    valid_paths.push_back("solver");
+    valid_paths.push_back("actions_file");
+    valid_paths.push_back("actions_files");
+    valid_paths.push_back("actions");
+
+    std::vector<std::string> ignore_paths;
+    // don't go down the actions or actions_files path
+    ignore_paths.push_back("actions");
+    ignore_paths.push_back("actions_files");
+    ignore_paths.push_back("solver");
+
+    std::string surprises = surprise_check(valid_paths, ignore_paths,params);
+
+    if(surprises != "")
+    {
+        res = false;
+        info["errors"].append() = surprises;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+SurrogateTrigger::execute()
+{
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("Trigger input must be a data object");
+    }
+
+    DataObject *data_object = input<DataObject>(0);
+    std::shared_ptr<Node> n_input = data_object->as_low_order_bp();
+
+    int mpi_comm_id = -1;
+
 #ifdef ASCENT_MPI_ENABLED
-        ascent_opts["mpi_comm"] = mpi_comm_id;
+     mpi_comm_id = Workspace::default_mpi_comm();
 #endif
-        ascent.open(ascent_opts);
-        ascent.publish(*n_input);
-        ascent.execute(actions);
-        ascent.close();
+
+    double tolerance = 0.01;
+    int max_skip = 4;
+    int lags = 4;
+    double learning_rate = 1e-7;
+    int epochs = 100;
+    double initial_weight = 0.05;
+
+    if(params().has_path("tolerance"))
+    {
+      tolerance = params()["tolerance"].to_float64();
     }
-}
+    if(params().has_path("max_skip"))
+    {
+      max_skip = params()["max_skip"].to_int32();
+    }
+    if(params().has_path("lags"))
+    {
+      lags = params()["lags"].to_int32();
+    }
+    if(params().has_path("learning_rate"))
+    {
+      learning_rate = params()["learning_rate"].to_float64();
+    }
+    if(params().has_path("epochs"))
+    {
+      epochs = params()["epochs"].to_int32();
+    }
+    if(params().has_path("initial_weight"))
+    {
+      initial_weight = params()["initial_weight"].to_float64();
+    }
+
+    conduit::Node &state = filter_state(graph().workspace(), name());
+    conduit::Node solver;
+    surrogate_solver_options(params(), solver);
+
+    SurrogateModel surrogate(state["model"]);
+    if(!surrogate.configured(lags, learning_rate, epochs, initial_weight, 0, solver))
+    {
+      surrogate.configure(lags, learning_rate, epochs, initial_weight, 0, solver);
+      state["confident"] = 0;
+      state["skipped"] = 0;
+    }
+
+    conduit::Node n_cycle = expressions::get_state_var(*n_input, "cycle");
+    int cycle = n_cycle.dtype().is_empty() ? -1 : n_cycle.to_int32();
 
+    // the decision for a cycle is made once
+    if(cycle != -1 && cycle == surrogate.last_cycle())
+    {
+      return;
+    }
+    surrogate.last_cycle(cycle);
+
+    const double prediction = surrogate.predict();
+    const bool confident = surrogate.ready() &&
+                           state["confident"].to_int32() != 0;
+    int skipped = state["skipped"].to_int32();
+
+    conduit::Node res;
+    bool fire = false;
+
+    if(confident && skipped < max_skip)
+    {
+      // trust the model: use the prediction as this cycle's value and
+      // roll the window forward on it
+      res["value"] = prediction;
+      res["type"] = "double";
+      conduit::Node n_time = expressions::get_state_var(*n_input, "time");
+      res["time"] = n_time.dtype().is_empty() ? 0.0 : n_time.to_float64();
+      res["predicted"] = "true";
+      surrogate.push(prediction);
+      state["skipped"] = skipped + 1;
+    }
+    else
+    {
+      // verify the model against the real value
+      runtime::expressions::ExpressionEval eval(n_input.get());
+      const std::string expression = params()["expression"].as_string();
+      res = eval.evaluate(expression, name());
+      const double value = res["value"].to_float64();
+
+      double error = std::numeric_limits<double>::infinity();
+      if(surrogate.ready())
+      {
+        const double scale = std::max(std::abs(value),
+                                      std::numeric_limits<double>::min());
+        error = std::abs(prediction - value) / scale;
+        res["prediction"] = prediction;
+        res["relative_error"] = error;
+      }
+      res["predicted"] = "false";
+
+      const bool hit = error <= tolerance;
+      // a miss means we can't trust the model, do the real work
+      fire = !hit;
+      surrogate.observe(value, true);
+      state["confident"] = hit ? 1 : 0;
+      state["skipped"] = 0;
+    }
+
+    res["fired"] = fire ? "true" : "false";
+    runtime::expressions::ExpressionEval::record(name(), cycle, res);
+
+    if(fire)
+    {
+        TriggerCache *cache = trigger_cache(graph().workspace());
+        conduit::Node actions;
+        detail::load_trigger_actions(params(), mpi_comm_id, cache, actions);
+        detail::execute_trigger_actions(*n_input,
+                                        actions,
+                                        mpi_comm_id,
+                                        name(),
+                                        cache);
+    }
+}
 
 //-----------------------------------------------------------------------------
 };
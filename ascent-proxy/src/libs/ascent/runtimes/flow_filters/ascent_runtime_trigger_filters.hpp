@@ -17,6 +17,11 @@
 #include <ascent.hpp>
 
 #include <flow_filter.hpp>
+#include <flow_workspace.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
 
 
 //-----------------------------------------------------------------------------
@@ -43,6 +48,44 @@ namespace filters
 ///
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+///
+/// What triggers keep between fires: a child Ascent per trigger, opened
+/// on its first fire and kept open, so firing again only rebuilds the
+/// child's graph if the trigger's actions changed. Actions files are
+/// read again only when their modification time changes.
+/// The ascent runtime owns one and registers it as "_ascent_triggers".
+///
+//-----------------------------------------------------------------------------
+class ASCENT_API TriggerCache
+{
+public:
+    TriggerCache();
+   ~TriggerCache();
+
+    // the child runtime of a trigger, opened on first use
+    Ascent              &runtime(const std::string &trigger_name,
+                                 int mpi_comm_id);
+    // closes and forgets the child runtime of a trigger
+    void                 release(const std::string &trigger_name);
+    // the list of actions in an actions file
+    const conduit::Node &actions_file(const std::string &path,
+                                      int mpi_comm_id);
+    // closes all child runtimes and forgets all actions files
+    void                 reset();
+
+private:
+    TriggerCache(const TriggerCache &) = delete;
+    TriggerCache &operator=(const TriggerCache &) = delete;
+
+    std::map<std::string, std::unique_ptr<Ascent>> m_runtimes;
+    // keyed by file name (holds "mtime", "size" and "actions")
+    conduit::Node m_actions_files;
+};
+
+// the trigger cache registered in w, nullptr if there is none
+TriggerCache ASCENT_API *trigger_cache(flow::Workspace &w);
+
 //-----------------------------------------------------------------------------
 class ASCENT_API BasicTrigger : public ::flow::Filter
 {
@@ -56,6 +99,27 @@ public:
     virtual void   execute();
 };
 
+//-----------------------------------------------------------------------------
+///
+/// Trigger that fires its actions only when an online surrogate model
+/// of `expression` can't be trusted. While the model's last verified
+/// relative error is within `tolerance`, up to `max_skip` cycles use the
+/// prediction instead of evaluating the expression, and the actions
+/// are skipped.
+///
+//-----------------------------------------------------------------------------
+class ASCENT_API SurrogateTrigger : public ::flow::Filter
+{
+public:
+    SurrogateTrigger();
+   ~SurrogateTrigger();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
 
 };
 //-----------------------------------------------------------------------------
@@ -13,8 +13,10 @@
 
 #include "ascent_runtime_utils.hpp"
 #include <ascent_logging.hpp>
+#include <ascent_logging_old.hpp>
 #include <ascent_string_utils.hpp>
 #include <ascent_metadata.hpp>
+#include <flow_workspace.hpp>
 
 #include <algorithm>
 
@@ -79,6 +81,19 @@ std::string filter_to_path(const std::string filter_name)
   }
   return res;
 }
+
+conduit::Node &filter_state(flow::Workspace &w,
+                            const std::string &filter_name)
+{
+  if(!w.registry().has_entry("_ascent_state"))
+  {
+    ASCENT_ERROR("Filter '"<<filter_name<<"' needs the extract state store, "
+                 "which is only available in the ascent runtime");
+  }
+  conduit::Node *store = w.registry().fetch<conduit::Node>("_ascent_state");
+  // names are not paths, so don't let conduit split them
+  return store->add_child(filter_name);
+}
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
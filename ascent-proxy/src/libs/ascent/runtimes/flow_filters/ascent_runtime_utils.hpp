@@ -18,6 +18,11 @@
 #include <ascent_exports.h>
 #include <string>
 
+namespace flow
+{
+class Workspace;
+}
+
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
 //-----------------------------------------------------------------------------
@@ -47,6 +52,14 @@ std::string ASCENT_API default_dir();
 
 std::string ASCENT_API filter_to_path(const std::string filter_name);
 
+// Returns the persistent state for the named filter. The state store
+// is owned by the runtime and lives in the registry under
+// "_ascent_state", so entries survive graph rebuilds and executes.
+// It is an error to ask for state in a workspace without a store
+// (e.g. a bare flow workspace).
+conduit::Node ASCENT_API &filter_state(flow::Workspace &w,
+                                      const std::string &filter_name);
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
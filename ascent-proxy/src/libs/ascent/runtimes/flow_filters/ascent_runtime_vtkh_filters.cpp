@@ -133,6 +133,7 @@ VTKHMarchingCubes::declare_interface(Node &i)
     i["type_name"]   = "vtkh_marchingcubes";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -265,6 +266,7 @@ VTKHExternalSurfaces::declare_interface(Node &i)
     i["type_name"]   = "vtkh_external_surfaces";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -359,6 +361,7 @@ VTKHVectorMagnitude::declare_interface(Node &i)
     i["type_name"]   = "vtkh_vector_magnitude";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -463,6 +466,7 @@ VTKH3Slice::declare_interface(Node &i)
     i["type_name"]   = "vtkh_3slice";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -612,6 +616,7 @@ VTKHTriangulate::declare_interface(Node &i)
     i["type_name"]   = "vtkh_triangulate";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -707,6 +712,7 @@ VTKHCleanGrid::declare_interface(Node &i)
     i["type_name"]   = "vtkh_clean";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -805,6 +811,7 @@ VTKHSlice::declare_interface(Node &i)
     i["type_name"]   = "vtkh_slice";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -1117,6 +1124,7 @@ VTKHAutoSliceLevels::declare_interface(Node &i)
     i["type_name"]   = "vtkh_autoslicelevels";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1318,6 +1326,7 @@ VTKHGhostStripper::declare_interface(Node &i)
     i["type_name"]   = "vtkh_ghost_stripper";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -1431,6 +1440,7 @@ VTKHAddRanks::declare_interface(Node &i)
     i["type_name"]   = "vtkh_add_mpi_ranks";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1540,6 +1550,7 @@ VTKHAddDomains::declare_interface(Node &i)
     i["type_name"]   = "vtkh_add_domain_ids";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -1644,6 +1655,7 @@ VTKHThreshold::declare_interface(Node &i)
     i["type_name"]   = "vtkh_threshold";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2006,6 +2018,7 @@ VTKHClip::declare_interface(Node &i)
     i["type_name"] = "vtkh_clip";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2312,6 +2325,7 @@ VTKHClipWithField::declare_interface(Node &i)
     i["type_name"] = "vtkh_clip_with_field";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2424,6 +2438,7 @@ VTKHIsoVolume::declare_interface(Node &i)
     i["type_name"] = "vtkh_iso_volume";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2530,6 +2545,7 @@ VTKHLagrangian::declare_interface(Node &i)
     i["type_name"]   = "vtkh_lagrangian";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -2652,6 +2668,7 @@ VTKHLog::declare_interface(Node &i)
     i["type_name"]   = "vtkh_log";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2762,6 +2779,7 @@ VTKHLog10::declare_interface(Node &i)
     i["type_name"]   = "vtkh_log10";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2872,6 +2890,7 @@ VTKHLog2::declare_interface(Node &i)
     i["type_name"]   = "vtkh_log2";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -2982,6 +3001,7 @@ VTKHRecenter::declare_interface(Node &i)
     i["type_name"]   = "vtkh_recenter";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -3096,6 +3116,7 @@ VTKHHistSampling::declare_interface(Node &i)
     i["type_name"]   = "vtkh_hist_sampling";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -3249,6 +3270,7 @@ VTKHQCriterion::declare_interface(Node &i)
     i["type_name"]   = "vtkh_qcriterion";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -3371,6 +3393,7 @@ VTKHDivergence::declare_interface(Node &i)
     i["type_name"]   = "vtkh_divergence";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -3492,6 +3515,7 @@ VTKHVorticity::declare_interface(Node &i)
     i["type_name"]   = "vtkh_curl";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -3613,6 +3637,7 @@ VTKHGradient::declare_interface(Node &i)
     i["type_name"]   = "vtkh_gradient";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -3727,6 +3752,7 @@ VTKHUniformGrid::declare_interface(Node &i)
     i["type_name"]   = "vtkh_uniform_grid";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -3903,6 +3929,7 @@ VTKHStats::declare_interface(Node &i)
     i["type_name"]   = "vtkh_stats";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -3997,6 +4024,7 @@ VTKHHistogram::declare_interface(Node &i)
     i["type_name"]   = "vtkh_histogram";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -4097,6 +4125,7 @@ VTKHProject2d::declare_interface(Node &i)
     i["type_name"]   = "vtkh_project_2d";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -4279,6 +4308,7 @@ VTKHNoOp::declare_interface(Node &i)
     i["type_name"]   = "vtkh_no_op";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -4377,6 +4407,7 @@ VTKHVectorComponent::declare_interface(Node &i)
     i["type_name"]   = "vtkh_vector_component";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -4483,6 +4514,7 @@ VTKHCompositeVector::declare_interface(Node &i)
     i["type_name"]   = "vtkh_composite_vector";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -4621,6 +4653,7 @@ VTKHScale::declare_interface(Node &i)
     i["type_name"]   = "vtkh_scale_transform";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -4721,6 +4754,7 @@ VTKHTransform::declare_interface(Node &i)
     i["type_name"]   = "vtkh_transform";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
@@ -5097,6 +5131,7 @@ VTKHParticleAdvection::declare_interface(Node &i)
     i["type_name"]   = "vtkh_particle_advection";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -5721,6 +5756,7 @@ VTKHStreamline::declare_interface(Node &i)
     i["type_name"]   = "vtkh_streamline";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -5750,6 +5786,7 @@ VTKHWarpXStreamline::declare_interface(Node &i)
     i["type_name"]   = "vtkh_warpx_streamline";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -5960,6 +5997,7 @@ VTKHVTKFileExtract::declare_interface(Node &i)
     i["type_name"]   = "vtkh_vtk_file_extract";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -6168,6 +6206,7 @@ VTKHMIR::declare_interface(Node &i)
     i["type_name"]   = "vtkh_mir";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = detail::vtkh_thread_safe();
 }
 
 //-----------------------------------------------------------------------------
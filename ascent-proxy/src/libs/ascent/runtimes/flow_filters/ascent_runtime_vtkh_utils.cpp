@@ -154,6 +154,15 @@ std::string resolve_topology(const conduit::Node &params,
   return topo_name;
 }
 
+std::string vtkh_thread_safe()
+{
+#ifdef ASCENT_MPI_ENABLED
+  return "false";
+#else
+  return "true";
+#endif
+}
+
 } // namespace detail
 //-----------------------------------------------------------------------------
 };
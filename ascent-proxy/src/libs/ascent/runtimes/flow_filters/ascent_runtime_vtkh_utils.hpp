@@ -58,6 +58,11 @@ std::string resolve_topology(const conduit::Node &params,
                              std::shared_ptr<VTKHCollection> collection,
                              bool error = true);
 
+// thread_safe interface value for vtkh filters that only touch their
+// own input. "false" in mpi builds, since vtkh issues collectives
+// (e.g. global field and bounds checks) from inside its filters
+std::string vtkh_thread_safe();
+
 } // namespace detail
 //-----------------------------------------------------------------------------
 };
@@ -15,6 +15,7 @@
 #include <sstream>
 #include <stdio.h>
 #include <regex>
+#include <sys/stat.h>
 // mpi related includes
 #ifdef ASCENT_MPI_ENABLED
 #include <mpi.h>
@@ -420,6 +421,32 @@ bool load_actions_file(const std::string &path,
     return true;
 }
 
+conduit::int64 file_modified_time(const std::string &path)
+{
+    struct stat file_stat;
+    if(stat(path.c_str(), &file_stat) != 0)
+    {
+        return -1;
+    }
+#if defined(__APPLE__)
+    const struct timespec &mtime = file_stat.st_mtimespec;
+#else
+    const struct timespec &mtime = file_stat.st_mtim;
+#endif
+    return (conduit::int64) mtime.tv_sec * 1000000000 +
+           (conduit::int64) mtime.tv_nsec;
+}
+
+conduit::int64 file_size(const std::string &path)
+{
+    struct stat file_stat;
+    if(stat(path.c_str(), &file_stat) != 0)
+    {
+        return -1;
+    }
+    return (conduit::int64) file_stat.st_size;
+}
+
 
 //-----------------------------------------------------------------------------
 };
@@ -32,6 +32,15 @@ ASCENT_API bool load_actions_file(const std::string &path,
                                   int mpi_comm_id,
                                   conduit::Node &actions);
 
+// returns the last modification time (nanoseconds since epoch) of the
+// given file, or -1 if the file does not exist. Used together with
+// file_size to skip re-reading files that have not changed.
+ASCENT_API conduit::int64 file_modified_time(const std::string &path);
+
+// returns the size in bytes of the given file, or -1 if the file does
+// not exist.
+ASCENT_API conduit::int64 file_size(const std::string &path);
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 //-----------------------------------------------------------------------------
 
 #include "ascent_block_timer.hpp"
+#include <ascent_logging_old.hpp>
 #include <climits>
 #include <math.h>
 #include <stdio.h>
@@ -22,7 +23,11 @@
 
 #include <set>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <fstream>
+#include <sstream>
 #ifdef ASCENT_PLATFORM_UNIX
 #include <sys/sysinfo.h>
 #include <unistd.h>
@@ -46,34 +51,58 @@ namespace ascent
 {
 
 // Initialize BlockTimer static data members.
-int                                            BlockTimer::s_global_depth = 0;
 conduit::Node                                  BlockTimer::s_global_root;
-std::string                                    BlockTimer::s_current_path = "";
-std::map<std::string, BlockTimer::time_point>  BlockTimer::s_timers;
-std::set<std::string>                          BlockTimer::s_visited;
 int                                            BlockTimer::s_rank = 0;
+bool                                           BlockTimer::s_sample_memory = true;
 
 //-----------------------------------------------------------------------------
-BlockTimer::BlockTimer(std::string const &name)
-: m_name(name)
+namespace detail
 {
-  Start(name);
-}
 
 //-----------------------------------------------------------------------------
-void
-BlockTimer::StartTimer(const char *name)
+// one timed region (a timer id at a position in the nesting)
+//-----------------------------------------------------------------------------
+struct TimedRegion
 {
-  std::string s_name(name);
-  Start(s_name);
-}
+    int              timer_id;
+    int              parent;
+    double           total;
+    conduit::uint32  count;
+    double           sys_mem_mb;
+    double           proc_mem_mb;
+    std::vector<int> children;
+};
+
 //-----------------------------------------------------------------------------
-void
-BlockTimer::StopTimer(const char *name)
+// a running timer, region is -1 past MAX_DEPTH
+//-----------------------------------------------------------------------------
+struct TimerFrame
 {
-  std::string s_name(name);
-  Stop(s_name);
+    int timer_id;
+    int region;
+    std::chrono::high_resolution_clock::time_point start;
+};
+
+//-----------------------------------------------------------------------------
+std::mutex &timer_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+// registered timer names, indexed by id
+std::vector<std::string> &timer_names()
+{
+    static std::vector<std::string> names;
+    return names;
 }
+
+std::map<std::string,int> &timer_ids()
+{
+    static std::map<std::string,int> ids;
+    return ids;
+}
+
 //-----------------------------------------------------------------------------
 int
 parseLine(char *line)
@@ -91,113 +120,260 @@ parseLine(char *line)
 }
 
 //-----------------------------------------------------------------------------
+// folds the current memory usage into the region's running averages
 void
-BlockTimer::Start(const std::string &name)
+sample_memory(TimedRegion &region)
 {
-#ifdef ASCENT_MPI_ENABLED
-    MPI_Comm_rank(MPI_COMM_WORLD, &s_rank);
-    MPI_Barrier(MPI_COMM_WORLD);
+#ifdef ASCENT_PLATFORM_UNIX
+    const double count = region.count;
+    struct sysinfo system_info;
+    sysinfo(&system_info);
+    long long memUsed = (system_info.totalram -system_info.freeram);
+    memUsed *= system_info.mem_unit;
+    memUsed = memUsed / 1024 / 1024;
+    region.sys_mem_mb = (region.sys_mem_mb * (count - 1) + memUsed) / count;
+
+    FILE* file = fopen("/proc/self/status", "r");
+    int kb = -1;
+    char line[128];
+    while (fgets(line, 128, file) != NULL)
+    {
+        if (strncmp(line, "VmRSS:", 6) == 0)
+        {
+            kb = parseLine(line);
+            break;
+        }
+    }
+    fclose(file);
+
+    kb = kb / 1024;
+    region.proc_mem_mb = (region.proc_mem_mb * (count - 1) + kb) / count;
 #else
-    s_rank = 0;
+    (void) region;
 #endif
+}
 
-    ++s_global_depth;
+};
 
-    if (s_global_depth <= MAX_DEPTH)
-    {
-        s_current_path += "children/" + name + "/";
-        Precheck();
+//-----------------------------------------------------------------------------
+struct BlockTimer::ThreadRegions
+{
+    // regions[0] is the root
+    std::vector<detail::TimedRegion> regions;
+    std::vector<detail::TimerFrame>  stack;
+    int                              current;
+    // only contended while Finalize reads the regions
+    std::mutex                       mutex;
+};
 
-        // Start timing.
-        if (s_timers.count(name) == 0)
-        {
-            s_timers.insert(std::pair<std::string, time_point>(name,
-                                                               high_resolution_clock::now()));
-        }
-    }
+//-----------------------------------------------------------------------------
+BlockTimer::BlockTimer(std::string const &name, bool barrier)
+: m_timer_id(Register(name))
+{
+  Start(m_timer_id, barrier);
+}
 
+//-----------------------------------------------------------------------------
+BlockTimer::BlockTimer(int timer_id, bool barrier)
+: m_timer_id(timer_id)
+{
+  Start(m_timer_id, barrier);
 }
+
+//-----------------------------------------------------------------------------
+int
+BlockTimer::Register(const std::string &name)
+{
+  std::lock_guard<std::mutex> lock(detail::timer_mutex());
+  std::map<std::string,int> &ids = detail::timer_ids();
+  auto itr = ids.find(name);
+  if(itr != ids.end())
+  {
+    return itr->second;
+  }
+  const int id = static_cast<int>(detail::timer_names().size());
+  detail::timer_names().push_back(name);
+  ids[name] = id;
+  return id;
+}
+
 //-----------------------------------------------------------------------------
 void
-BlockTimer::Stop(const std::string &name)
+BlockTimer::StartTimer(const char *name)
 {
-#ifdef ASCENT_MPI_ENABLED
-    //MPI_Barrier(MPI_COMM_WORLD);
-#endif
-    if (s_global_depth <= MAX_DEPTH)
-    {
-        // Record timer.
-        auto t_start = s_timers[name];
-        using fsec = std::chrono::duration<float>;
-        auto ftime = std::chrono::duration_cast<fsec>(high_resolution_clock::now() - t_start);
-        float elapsed_time = ftime.count();
+  Start(Register(name), false);
+}
+//-----------------------------------------------------------------------------
+void
+BlockTimer::StopTimer(const char *name)
+{
+  Stop(Register(name));
+}
 
-        Node &curr = CurrentNode();
+//-----------------------------------------------------------------------------
+void
+BlockTimer::StartTimer(int timer_id)
+{
+  Start(timer_id, false);
+}
 
-        // Update time spent at current location. added after max (changed)
-        double newval = curr["value"].as_float64() + elapsed_time;
+//-----------------------------------------------------------------------------
+void
+BlockTimer::StopTimer(int timer_id)
+{
+  Stop(timer_id);
+}
 
-        curr["value"] = newval;
-        curr["min"]   = newval;
-        curr["avg"]   = newval;
+//-----------------------------------------------------------------------------
+void
+BlockTimer::EnableMemorySampling(bool enabled)
+{
+  s_sample_memory = enabled;
+}
 
-        //increment the counter
-        unsigned int count = curr["count"].as_uint32() + 1;
-        curr["count"] = count;
+//-----------------------------------------------------------------------------
+// regions of every thread that has used a timer. They are never freed,
+// since Finalize may run after the threads have exited
+std::vector<std::shared_ptr<BlockTimer::ThreadRegions>> &
+BlockTimer::AllRegions()
+{
+    static std::vector<std::shared_ptr<ThreadRegions>> regions;
+    return regions;
+}
 
-        //
-        // Get system memory info and average
-        //
+//-----------------------------------------------------------------------------
+BlockTimer::ThreadRegions &
+BlockTimer::LocalRegions()
+{
+    thread_local ThreadRegions *local = nullptr;
+    if(local == nullptr)
+    {
+        std::shared_ptr<ThreadRegions> regions = std::make_shared<ThreadRegions>();
+        detail::TimedRegion root;
+        root.timer_id = -1;
+        root.parent = -1;
+        root.total = 0.0;
+        root.count = 0;
+        root.sys_mem_mb = 0.0;
+        root.proc_mem_mb = 0.0;
+        regions->regions.push_back(root);
+        regions->current = 0;
+
+        std::lock_guard<std::mutex> lock(detail::timer_mutex());
+        AllRegions().push_back(regions);
+        local = regions.get();
+    }
+    return *local;
+}
 
-        // Get memory info
-#ifdef ASCENT_PLATFORM_UNIX
-        struct sysinfo system_info;
-        sysinfo(&system_info);
-        long long memUsed = (system_info.totalram -system_info.freeram);
-        memUsed *= system_info.mem_unit;
-        memUsed = memUsed / 1024 / 1024;
-        unsigned int cSysMem = curr["sysMemUsed"].as_uint64();
+//-----------------------------------------------------------------------------
+void
+BlockTimer::Start(int timer_id, bool barrier)
+{
+#ifdef ASCENT_MPI_ENABLED
+    if(barrier)
+    {
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+#else
+    (void) barrier;
+#endif
 
-        cSysMem = ((cSysMem * (count - 1) + memUsed) )/ count;
-        curr["sysMemUsed"] = uint64(cSysMem);
+    ThreadRegions &local = LocalRegions();
+    std::lock_guard<std::mutex> lock(local.mutex);
+    detail::TimerFrame frame;
+    frame.timer_id = timer_id;
+    frame.region = -1;
 
-        //
-        // Get process memory usage and average
-        //
-        FILE* file = fopen("/proc/self/status", "r");
-        int kb = -1;
-        char line[128];
-        while (fgets(line, 128, file) != NULL)
+    if (local.stack.size() < MAX_DEPTH)
+    {
+        // find (or add) this timer below the current region
+        std::vector<int> &children = local.regions[local.current].children;
+        for(size_t i = 0; i < children.size(); ++i)
         {
-            if (strncmp(line, "VmRSS:", 6) == 0)
+            if(local.regions[children[i]].timer_id == timer_id)
             {
-                kb = parseLine(line);
+                frame.region = children[i];
                 break;
             }
         }
-        fclose(file);
 
-        kb = kb / 1024;
+        if(frame.region == -1)
+        {
+            detail::TimedRegion region;
+            region.timer_id = timer_id;
+            region.parent = local.current;
+            region.total = 0.0;
+            region.count = 0;
+            region.sys_mem_mb = 0.0;
+            region.proc_mem_mb = 0.0;
+            frame.region = static_cast<int>(local.regions.size());
+            local.regions.push_back(region);
+            local.regions[local.current].children.push_back(frame.region);
+        }
+        local.current = frame.region;
+    }
 
-        int cProcUsage = curr["procMemMB"].as_int32();
-        cProcUsage = ((cProcUsage * (count - 1) + kb ))  / count;
-        curr["procMemMB"] = cProcUsage;
+    local.stack.push_back(frame);
+    // start timing last, so the bookkeeping is not included
+    local.stack.back().start = high_resolution_clock::now();
+}
+//-----------------------------------------------------------------------------
+void
+BlockTimer::Stop(int timer_id)
+{
+    const time_point now = high_resolution_clock::now();
+    ThreadRegions &local = LocalRegions();
+    std::unique_lock<std::mutex> lock(local.mutex);
 
-#else
-        curr["sysMemUsed"] = 0;
-        curr["procMemMB"]  = 0;
-#endif
-        GoUp();
+    if(local.stack.empty())
+    {
+        return;
+    }
+
+    const detail::TimerFrame frame = local.stack.back();
+    if(frame.timer_id != timer_id)
+    {
+        // leave the running timer alone
+        lock.unlock();
+        std::ostringstream msg;
+        {
+            std::lock_guard<std::mutex> names_lock(detail::timer_mutex());
+            msg<<"[BlockTimer] timer '"<<detail::timer_names()[timer_id]
+               <<"' stopped while '"<<detail::timer_names()[frame.timer_id]
+               <<"' is running";
+        }
+        ASCENT_WARN(msg.str());
+        return;
     }
+    local.stack.pop_back();
 
-    // Update current location.
-    --s_global_depth;
+    if (frame.region != -1)
+    {
+        using fsec = std::chrono::duration<double>;
+        detail::TimedRegion &region = local.regions[frame.region];
+        region.total += std::chrono::duration_cast<fsec>(now - frame.start).count();
+        region.count += 1;
+
+        if(s_sample_memory)
+        {
+            detail::sample_memory(region);
+        }
 
+        local.current = region.parent;
+    }
 }
 //-----------------------------------------------------------------------------
 BlockTimer::~BlockTimer()
 {
-  Stop(m_name);
+  // warnings may be configured to throw, which can't leave a destructor
+  try
+  {
+    Stop(m_timer_id);
+  }
+  catch(...)
+  {
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -208,88 +384,48 @@ BlockTimer::Finalize()
     return GlobalRoot();
 }
 
-
-//-----------------------------------------------------------------------------
-Node &
-BlockTimer::CurrentNode()
-{
-    return s_global_root[s_current_path];
-}
-
-//-----------------------------------------------------------------------------
-// Initializes values if the current location hasn't been s_visited yet,
-// and updates the set of s_visited locations.
-//-----------------------------------------------------------------------------
-void BlockTimer::Precheck()
-{
-    if (s_visited.count(s_current_path + "value") == 0)
-    { // != "" is to prevent a root of ""
-        Node &curr= CurrentNode();
-        curr["value"]      = 0.0;
-        curr["id"]         = s_rank;
-        curr["count"]      = 0u;
-        // added after max (the following 3)
-        curr["min"]        = 0.0;
-        curr["minid"]      = s_rank;
-        curr["avg"]        = 0.0;
-        curr["sysMemUsed"] = 0ul;
-        curr["procMemMB"]  = 0;
-
-        s_visited.insert(s_current_path + "value");
-    }
-}
-
-//-----------------------------------------------------------------------------
-bool
-BlockTimer::CheckForKnownPath(std::string &path)
-{
-  if(path == "value")       return true;
-  if(path == "id")          return true;
-  if(path == "count")       return true;
-  if(path == "avg")         return true;
-  if(path == "minimum")     return true;
-  if(path == "minid")       return true;
-  if(path == "sysMemUsed")  return true;
-  if(path == "procMemMB")   return true;
-  return false;
-}
-//-----------------------------------------------------------------------------
-// Goes up one function in the current location path.
 //-----------------------------------------------------------------------------
 void
-BlockTimer::GoUp()
+BlockTimer::AddRegions(const ThreadRegions &regions,
+                       int region_id,
+                       conduit::Node &dest)
 {
-    const unsigned int len = s_current_path.length();
-    if (len == 0)
+    const std::vector<int> &children = regions.regions[region_id].children;
+    for(size_t i = 0; i < children.size(); ++i)
     {
-        s_current_path = "";
-        return;
-    }
-
-    unsigned int ctr = 1;
-    unsigned int numslashes = 0;
-
-    std::string::iterator striter = s_current_path.end();
-    --striter;
-
-    while (ctr < len)
-    {
-        if (*striter == '/')
+        const detail::TimedRegion &region = regions.regions[children[i]];
+        Node &curr = dest["children"][detail::timer_names()[region.timer_id]];
+
+        double value = region.total;
+        unsigned int count = region.count;
+        double sys_mem = region.sys_mem_mb;
+        double proc_mem = region.proc_mem_mb;
+        // the same region timed on more than one thread
+        if(curr.has_child("value"))
         {
-            numslashes += 1;
-            if (numslashes >= 3)
+            const unsigned int prev_count = curr["count"].as_uint32();
+            value += curr["value"].as_float64();
+            count += prev_count;
+            if(count > 0)
             {
-                s_current_path = s_current_path.substr(0, len - ctr + 1);
-                return;
+                sys_mem = (curr["sysMemUsed"].as_uint64() * prev_count +
+                           sys_mem * region.count) / count;
+                proc_mem = (curr["procMemMB"].as_int32() * prev_count +
+                            proc_mem * region.count) / count;
             }
         }
 
-        --striter;
-        ++ctr;
-    }
+        curr["value"]      = value;
+        curr["id"]         = s_rank;
+        curr["count"]      = count;
+        curr["min"]        = value;
+        curr["minid"]      = s_rank;
+        curr["avg"]        = value;
+        curr["sysMemUsed"] = uint64(sys_mem);
+        curr["procMemMB"]  = int(proc_mem);
 
-    s_current_path = "";
-    return;
+        AddRegions(regions, children[i], curr);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -377,64 +513,54 @@ BlockTimer::AverageByCount(Node &node, int numRanks)
 }
 
 //-----------------------------------------------------------------------------
-void
-BlockTimer::ReduceAll(Node &thisRanksNode)
+void BlockTimer::ReduceGlobalRoot()
 {
 #ifdef ASCENT_MPI_ENABLED
-    int temp;
-    MPI_Comm_size(MPI_COMM_WORLD, &temp);
-    const unsigned int numProcesses = temp;
-    MPI_Comm_rank(MPI_COMM_WORLD, &temp);
-    const unsigned int rank = temp;
-
-    std::vector<Node> recvNodes(numProcesses+1);
+    MPI_Comm_rank(MPI_COMM_WORLD, &s_rank);
+#else
+    s_rank = 0;
+#endif
 
-    if (rank == 0)
+    // combine the regions of all threads on this rank
+    Node local;
     {
-        for (unsigned int i = 1; i < numProcesses; ++i)
+        std::lock_guard<std::mutex> lock(detail::timer_mutex());
+        std::vector<std::shared_ptr<ThreadRegions>> &threads = AllRegions();
+        for(size_t i = 0; i < threads.size(); ++i)
         {
-          recv(recvNodes[i], // node
-               i, // source
-               42, // tag
-               MPI_COMM_WORLD // comm
-               );
-           }
-     }
-     else
-     {
-         send(thisRanksNode, // node
-              0, // dest
-              42, // tag
-              MPI_COMM_WORLD // comm
-              );
+            // the thread may still be timing
+            std::lock_guard<std::mutex> thread_lock(threads[i]->mutex);
+            AddRegions(*threads[i], 0, local);
+        }
     }
 
-    if (rank == 0)
+#ifdef ASCENT_MPI_ENABLED
+    int num_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    // one collective to bring every rank's tree to rank 0
+    Node gathered;
+    gather(local, gathered, 0, MPI_COMM_WORLD);
+
+    s_global_root.reset();
+    if (s_rank == 0)
     {
-        for (unsigned int i = 1; i < numProcesses; ++i)
+        s_global_root.set(gathered.child(0));
+        for (int i = 1; i < num_ranks; ++i)
         {
-            Reduce(thisRanksNode.fetch("children"),
-                   recvNodes[i].fetch("children"));
+            Reduce(s_global_root.fetch("children"),
+                   gathered.child(i).fetch("children"));
         }
-    }
 
-    // Get the average time per iteration
-    if(rank == 0)
-    {
-        AverageByCount(s_global_root, numProcesses);
+        // Get the average time per iteration
+        AverageByCount(s_global_root, num_ranks);
     }
-
 #else
-    AverageByCount(BlockTimer::GlobalRoot(),1);
+    s_global_root.set(local);
+    AverageByCount(s_global_root, 1);
 #endif
 }
 
-//-----------------------------------------------------------------------------
-void BlockTimer::ReduceGlobalRoot()
-{
-    ReduceAll(GlobalRoot());
-}
-
 //-----------------------------------------------------------------------------
 void BlockTimer::WriteLogFile()
 {
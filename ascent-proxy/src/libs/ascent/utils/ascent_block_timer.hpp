@@ -13,7 +13,21 @@
 #ifndef ASCENT_BLOCK_TIMER_HPP
 #define ASCENT_BLOCK_TIMER_HPP
 
-#define ASCENT_BLOCK_TIMER(NAME) ascent::BlockTimer ASCENT_BLOCK_TIMER_##NAME(#NAME);
+// Times the enclosing scope. The timer id is registered once per call
+// site, so starting and stopping the timer does not touch any strings,
+// locks, or MPI.
+#define ASCENT_BLOCK_TIMER(NAME) \
+    static const int ASCENT_BLOCK_TIMER_ID_##NAME = \
+        ascent::BlockTimer::Register(#NAME); \
+    ascent::BlockTimer ASCENT_BLOCK_TIMER_##NAME(ASCENT_BLOCK_TIMER_ID_##NAME);
+
+// Same as ASCENT_BLOCK_TIMER, but all MPI ranks synchronize before the
+// region starts, so the time excludes load imbalance from earlier work.
+#define ASCENT_BLOCK_TIMER_BARRIER(NAME) \
+    static const int ASCENT_BLOCK_TIMER_ID_##NAME = \
+        ascent::BlockTimer::Register(#NAME); \
+    ascent::BlockTimer ASCENT_BLOCK_TIMER_##NAME(ASCENT_BLOCK_TIMER_ID_##NAME, true);
+
 #define MAX_DEPTH 5
 
 #include <string>
@@ -21,6 +35,8 @@
 #include <set>
 #include <cstdlib>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 #include <conduit.hpp>
 #include <ascent_config.h>
@@ -32,6 +48,11 @@
 namespace ascent
 {
 
+//-----------------------------------------------------------------------------
+// Timings are accumulated per thread, in fixed size records keyed by
+// registered timer ids and the nesting of the regions. Nothing is
+// communicated until Finalize, which combines the threads and reduces
+// the results to rank 0.
 //-----------------------------------------------------------------------------
 class ASCENT_API BlockTimer
 {
@@ -39,38 +60,46 @@ class ASCENT_API BlockTimer
     using high_resolution_clock = std::chrono::high_resolution_clock;
 public:
     // methods
-    BlockTimer(const std::string &name);
+    BlockTimer(const std::string &name, bool barrier = false);
+    BlockTimer(int timer_id, bool barrier = false);
     ~BlockTimer();
+    // returns the id for the given timer name, registering it if needed
+    static int  Register(const std::string &name);
+    // the name based versions register the name on every call, callers
+    // that start and stop often should register once and use the id
     static void StartTimer(const char *name);
     static void StopTimer(const char *name);
+    static void StartTimer(int timer_id);
+    static void StopTimer(int timer_id);
+    // sample system and process memory when a timer stops (on by
+    // default, turning it off avoids reading /proc on every stop)
+    static void EnableMemorySampling(bool enabled);
+    // must be called on all ranks while no timers are running
     static conduit::Node &Finalize();
     static void           WriteLogFile();
 
 private:
+    struct ThreadRegions;
 
-    static void Start(const std::string &name);
-    static void Stop(const std::string &name);
+    static void Start(int timer_id, bool barrier);
+    static void Stop(int timer_id);
     static inline conduit::Node &GlobalRoot()
         {return s_global_root;}
 
-    static void ReduceGlobalRoot();
-
-    // non-static methods
+    static ThreadRegions &LocalRegions();
+    static std::vector<std::shared_ptr<ThreadRegions>> &AllRegions();
 
-    // Initializes values if the current location hasn't been visited yet,
-    // and updates the set of visited locations.
-    static void Precheck();
+    // adds the regions below region_id of one thread into dest
+    static void AddRegions(const ThreadRegions &regions,
+                           int region_id,
+                           conduit::Node &dest);
 
-    // Goes up one function in the current location path.
-    static void GoUp();
+    static void ReduceGlobalRoot();
 
     // non-static data members
-    std::string m_name;
+    int m_timer_id;
 
     // private static methods
-    static void ReduceAll(conduit::Node &);
-    static conduit::Node &CurrentNode();
-
     static void Reduce(conduit::Node &,
                        conduit::Node &);
 
@@ -78,18 +107,10 @@ private:
 
     static void AverageByCount(conduit::Node &,
                                int);
-    static void FillDataArray(conduit::Node &,
-                              const int &,
-                              double &,
-                              double [][3],
-                              std::string);
     // static data members
     static conduit::Node                     s_global_root;
     static int                               s_rank; // MPI rank
-    static int                               s_global_depth;
-    static std::string                       s_current_path;
-    static std::map<std::string, time_point> s_timers;
-    static std::set<std::string>             s_visited;
+    static bool                              s_sample_memory;
 
 };
 
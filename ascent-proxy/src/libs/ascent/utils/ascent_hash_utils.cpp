@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_hash_utils.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_hash_utils.hpp"
+
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+void
+hash_bytes(const void *data, const size_t bytes, conduit::uint64 &hash)
+{
+  const unsigned char *ptr = (const unsigned char *) data;
+  for(size_t i = 0; i < bytes; ++i)
+  {
+    hash ^= ptr[i];
+    hash *= 1099511628211ull;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+hash_string(const std::string &str, conduit::uint64 &hash)
+{
+  // include the terminator so "ab","c" and "a","bc" differ
+  hash_bytes(str.c_str(), str.size() + 1, hash);
+}
+
+//-----------------------------------------------------------------------------
+void
+hash_structure(const conduit::Node &node,
+               const bool with_addresses,
+               conduit::uint64 &hash)
+{
+  const conduit::DataType &dtype = node.dtype();
+  const conduit::index_t layout[4] = {dtype.id(),
+                                      dtype.number_of_elements(),
+                                      dtype.offset(),
+                                      dtype.stride()};
+  hash_bytes(layout, sizeof(layout), hash);
+
+  if(dtype.is_object() || dtype.is_list())
+  {
+    const int num_children = node.number_of_children();
+    for(int i = 0; i < num_children; ++i)
+    {
+      const conduit::Node &child = node.child(i);
+      hash_string(child.name(), hash);
+      hash_structure(child, with_addresses, hash);
+    }
+  }
+  else if(dtype.is_string())
+  {
+    hash_string(node.as_string(), hash);
+  }
+  else if(!with_addresses || dtype.number_of_elements() == 0)
+  {
+    return;
+  }
+  else if(dtype.number_of_elements() <= 4)
+  {
+    conduit::Node values;
+    node.to_float64_array(values);
+    hash_bytes(values.data_ptr(), values.allocated_bytes(), hash);
+  }
+  else
+  {
+    const void *address = node.data_ptr();
+    hash_bytes(&address, sizeof(address), hash);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+hash_contents(const conduit::Node &node, conduit::uint64 &hash)
+{
+  const conduit::DataType &dtype = node.dtype();
+  if(dtype.is_object() || dtype.is_list())
+  {
+    const int num_children = node.number_of_children();
+    for(int i = 0; i < num_children; ++i)
+    {
+      hash_contents(node.child(i), hash);
+    }
+  }
+  else if(dtype.is_number() && dtype.number_of_elements() > 0)
+  {
+    if(node.is_compact())
+    {
+      hash_bytes(node.data_ptr(), dtype.bytes_compact(), hash);
+    }
+    else
+    {
+      conduit::Node compact;
+      node.compact_to(compact);
+      hash_bytes(compact.data_ptr(), compact.dtype().bytes_compact(), hash);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
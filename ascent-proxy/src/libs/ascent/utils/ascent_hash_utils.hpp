@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_hash_utils.hpp
+///
+//-----------------------------------------------------------------------------
+#ifndef ASCENT_HASH_UTILS_HPP
+#define ASCENT_HASH_UTILS_HPP
+
+#include <string>
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+// FNV-1a, hashes start from hash_seed
+const conduit::uint64 hash_seed = 14695981039346656037ull;
+
+ASCENT_API
+void hash_bytes(const void *data, const size_t bytes, conduit::uint64 &hash);
+
+ASCENT_API
+void hash_string(const std::string &str, conduit::uint64 &hash);
+
+// hashes the names, dtypes, and string values of a tree. When
+// with_addresses is true, small numeric leaves (dims, origin, spacing)
+// are hashed by value and arrays by data address, otherwise numeric
+// leaves only contribute their layout.
+ASCENT_API
+void hash_structure(const conduit::Node &node,
+                    const bool with_addresses,
+                    conduit::uint64 &hash);
+
+// hashes the values of the numeric leaves of a tree
+ASCENT_API
+void hash_contents(const conduit::Node &node, conduit::uint64 &hash);
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
+
@@ -107,6 +107,13 @@ WebInterface::Enable()
     m_enabled = true;
 }
 
+//-----------------------------------------------------------------------------
+bool
+WebInterface::Enabled() const
+{
+    return m_enabled;
+}
+
 //-----------------------------------------------------------------------------
 WebSocket *
 WebInterface::Connection()
@@ -280,6 +287,13 @@ void
 WebInterface::Enable()
 {}
 
+//-----------------------------------------------------------------------------
+bool
+WebInterface::Enabled() const
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 void
 WebInterface::PushMessage(const Node &msg)
@@ -50,6 +50,9 @@ public:
     void                            SetTimeout(int ms_timeout);
 
     void                            Enable();
+    // true when streaming was enabled (always false
+    // without web server support)
+    bool                            Enabled() const;
 
     void                            PushMessage(const conduit::Node &msg);
     void                            PushRenders(const conduit::Node &renders);
@@ -82,20 +82,22 @@ copy_conduit_scalar_array(const conduit::Node &n_vals)
 
   Vec<Float,1> *values_ptr = values.get_host_ptr();
 
+  // the arrays honor the stride and offset, so fields published as
+  // views into larger (e.g. interleaved) arrays come in without a compact copy
   if(n_vals.dtype().is_float32())
   {
-    const float *n_values_ptr = n_vals.value();
+    conduit::float32_array n_values = n_vals.value();
     for(int32 i = 0; i < num_vals; ++i)
     {
-      values_ptr[i][0] = n_values_ptr[i];
+      values_ptr[i][0] = n_values[i];
     }
   }
   else if(n_vals.dtype().is_float64())
   {
-    const double *n_values_ptr = n_vals.value();
+    conduit::float64_array n_values = n_vals.value();
     for(int32 i = 0; i < num_vals; ++i)
     {
-      values_ptr[i][0] = n_values_ptr[i];
+      values_ptr[i][0] = n_values[i];
     }
   }
   else
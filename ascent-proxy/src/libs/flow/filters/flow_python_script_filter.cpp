@@ -18,6 +18,7 @@
 
 // standard lib includes
 #include <iostream>
+#include <fstream>
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
@@ -103,11 +104,14 @@ namespace detail
 
 PyObject* execute_python(PyObject *py_input,
                         flow::PythonInterpreter *py_interp,
-                        conduit::Node &params)
+                        conduit::Node &params,
+                        const std::string &filter_name,
+                        PyObject *py_state = NULL)
 {
     std::string module_name = "flow_script_filter";
     std::string input_func_name = "flow_input";
     std::string set_output_func_name = "flow_set_output";
+    std::string state_func_name = "flow_state";
 
     bool echo = false;
     if( params.has_path("echo") &&
@@ -133,35 +137,52 @@ PyObject* execute_python(PyObject *py_input,
         set_output_func_name = params["interface/set_output"].as_string();
     }
 
-    std::ostringstream filter_setup_src_oss;
-    // lookup or create a new module
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "def flow_setup_module(name):\n"
-                         << "    import sys\n"
-                         << "    import types\n"
-                         << "    if name in sys.modules.keys():\n"
-                         << "       return sys.modules[name]\n"
-                         << "    mymod = types.ModuleType(name)\n"
-                         << "    sys.modules[name] = mymod\n"
-                         << "    return mymod\n"
-                         << "\n"
-                         // setup the module
-                         << "flow_setup_module(\"" << module_name << "\")\n";
-    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
-
-    filter_setup_src_oss.str();
-    filter_setup_src_oss << "\n"
-                         // import into the global dict
-                         << "import " << module_name << "\n"
-                         << "\n";
-    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
-
-
-    // fetch the module from the global dict (borrowed)
+    if( params.has_path("interface/state") )
+    {
+        state_func_name = params["interface/state"].as_string();
+    }
+
+    // the module and the helper functions only need to be created once
+    // per interpreter, after that we just rebind the data they return
     PyObject *py_mod = py_interp->get_global_object(module_name);
 
+    bool needs_setup = py_mod == NULL ||
+                       !PyModule_Check(py_mod) ||
+                       py_interp->get_global_object(input_func_name) == NULL ||
+                       py_interp->get_global_object(set_output_func_name) == NULL ||
+                       (py_state != NULL &&
+                        py_interp->get_global_object(state_func_name) == NULL);
+
+    std::ostringstream filter_setup_src_oss;
+
+    if(needs_setup)
+    {
+        // lookup or create a new module
+        filter_setup_src_oss.str("");
+        filter_setup_src_oss << "def flow_setup_module(name):\n"
+                             << "    import sys\n"
+                             << "    import types\n"
+                             << "    if name in sys.modules.keys():\n"
+                             << "       return sys.modules[name]\n"
+                             << "    mymod = types.ModuleType(name)\n"
+                             << "    sys.modules[name] = mymod\n"
+                             << "    return mymod\n"
+                             << "\n"
+                             // setup the module
+                             << "flow_setup_module(\"" << module_name << "\")\n"
+                             << "\n"
+                             // import into the global dict
+                             << "import " << module_name << "\n"
+                             << "\n";
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_cached_script(filter_setup_src_oss.str(),
+                                                                        py_interp->global_dict()));
+
+        // fetch the module from the global dict (borrowed)
+        py_mod = py_interp->get_global_object(module_name);
+    }
+
     // sanity check
-    if( !PyModule_Check(py_mod) )
+    if( py_mod == NULL || !PyModule_Check(py_mod) )
     {
         CONDUIT_ERROR("Unexpected error: " << module_name
                       << " is not a python module!");
@@ -171,42 +192,71 @@ PyObject* execute_python(PyObject *py_input,
     //  where we will place our methods and bind our input data
     PyObject *py_mod_dict = PyModule_GetDict(py_mod);
 
+    if(needs_setup)
+    {
+        // run script to establish input and output helpers in the module
+        // note: global here binds to module scope
+        filter_setup_src_oss.str("");
+        filter_setup_src_oss << "\n"
+                             << "def "<< input_func_name << "():\n"
+                             << "    return _flow_input\n"
+                             << "\n"
+                             << "def " << set_output_func_name <<  "(out):\n"
+                             << "    global _flow_output\n"
+                             << "    _flow_output = out\n"
+                             << "\n"
+                             << "def " << state_func_name << "():\n"
+                             << "    return _flow_state\n"
+                             << "\n";
+
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_cached_script(filter_setup_src_oss.str(),
+                                                                        py_mod_dict));
+
+        // now import binding function names from the module,
+        // so the names are bound to the global ns
+        filter_setup_src_oss.str("");
+        filter_setup_src_oss << "\n"
+                             << "from " << module_name
+                             << " import "
+                             << input_func_name << ", "
+                             << set_output_func_name;
+        // only expose the state accessor when there is state to access
+        if(py_state != NULL)
+        {
+            filter_setup_src_oss << ", " << state_func_name;
+        }
+        filter_setup_src_oss << "\n";
+
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_cached_script(filter_setup_src_oss.str(),
+                                                                        py_interp->global_dict()));
+    }
+
     // bind our input data
     FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
                                                                   py_input,
                                                                   "_flow_input"));
+    // clear any previous output
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
+                                                                  Py_None,
+                                                                  "_flow_output"));
+
+    // if the caller provides persistent state, bind it. the state
+    // is a wrapped conduit node, so numpy arrays fetched from it
+    // are views of the state's memory
+    if(py_state != NULL)
+    {
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
+                                                                      py_state,
+                                                                      "_flow_state"));
+    }
+    // otherwise don't leave the state of a previous script bound
+    else if(PyDict_GetItemString(py_mod_dict, "_flow_state") != NULL)
+    {
+        PyDict_DelItemString(py_mod_dict, "_flow_state");
+    }
 
-    // run script to establish input and output helpers in the module
-    // note: global here binds to module scope
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "\n"
-                         << "_flow_output = None\n"
-                         << "\n"
-                         << "def "<< input_func_name << "():\n"
-                         << "    return _flow_input\n"
-                         << "\n"
-                         << "def " << set_output_func_name <<  "(out):\n"
-                         << "    global _flow_output\n"
-                         << "    _flow_output = out\n"
-                         << "\n";
-
-    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str(),
-                                                             py_mod_dict));
-
-    // now import binding function names from the module,
-    // so the names are bound to the global ns
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "\n"
-                         << "from " << module_name
-                         << " import "
-                         << input_func_name << ", "
-                         << set_output_func_name
-                         << "\n";
-
-    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
-    
     std::string filter_source_file_path = "";
-    
+
     if( params.has_child("file") )
     {
         filter_source_file_path = params["file"].as_string();
@@ -214,12 +264,12 @@ PyObject* execute_python(PyObject *py_input,
     // this is used in the mpi case, where we read the file on one rank
     // and present the script as "source", but we still want to present
     // the file name
-    else if (params.has_child("source_file")) 
+    else if (params.has_child("source_file"))
     {
         filter_source_file_path = params["source_file"].as_string();
     }
-    
-    // inject the file name as __file__ in the module 
+
+    // inject the file name as __file__ in the module
     if( !filter_source_file_path.empty() )
     {
         filter_setup_src_oss.str("");
@@ -229,17 +279,85 @@ PyObject* execute_python(PyObject *py_input,
                              << "if '__file__' in globals():\n"
                              << "    _flow_source_file_stack.append(__file__)\n"
                              << "__file__ = \"" << filter_source_file_path << "\"\n";
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_cached_script(filter_setup_src_oss.str(),
+                                                                        py_interp->global_dict()));
     }
 
-
+    std::string script_src;
     if( params.has_child("source") )
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(params["source"].as_string()));
+        script_src = params["source"].as_string();
     }
     else // file is the other case
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script_file(params["file"].as_string()));
+        std::string fname = params["file"].as_string();
+        std::ifstream ifs(fname.c_str());
+        if(!ifs.is_open())
+        {
+            CONDUIT_ERROR("python_script failed to open " << fname);
+        }
+        script_src.assign((std::istreambuf_iterator<char>(ifs)),
+                          std::istreambuf_iterator<char>());
+        ifs.close();
+    }
+
+    if(echo)
+    {
+        CONDUIT_INFO("python_script source " << script_src);
+    }
+
+    // compiled once, later cycles with the same source reuse the code object
+    std::string code_name = filter_source_file_path.empty() ?
+                            std::string("<string>") : filter_source_file_path;
+    PyObject *py_code = py_interp->compiled_script(script_src, code_name);
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_code != NULL);
+
+    if( !params.has_child("entry_point") )
+    {
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_code(py_code,
+                                                               py_interp->global_dict()));
+    }
+    else
+    {
+        // entry point mode: the script body runs once to define the
+        // function, after that we only call the function. functions are
+        // cached per filter, so filters with the same entry point name
+        // (and different scripts) each keep their own
+        const std::string entry_point = params["entry_point"].as_string();
+
+        PyObject *py_func = py_interp->cached_entry_point(filter_name, py_code);
+        if(py_func == NULL)
+        {
+            // the body runs with a __name__ other than "__main__", so
+            // main guarded calls don't run on top of the entry point call
+            PyObject *py_globals = py_interp->global_dict();
+            PyObject *py_main_name = PyDict_GetItemString(py_globals, "__name__");
+            Py_XINCREF(py_main_name);
+            PyObject *py_def_name = Py_BuildValue("s", "__flow_entry_point__");
+            PyDict_SetItemString(py_globals, "__name__", py_def_name);
+            Py_XDECREF(py_def_name);
+
+            bool ok = py_interp->run_code(py_code, py_globals);
+
+            if(py_main_name != NULL)
+            {
+                PyDict_SetItemString(py_globals, "__name__", py_main_name);
+                Py_DECREF(py_main_name);
+            }
+            FLOW_CHECK_PYTHON_ERROR(py_interp, ok);
+
+            py_func = py_interp->get_global_object(entry_point);
+            if(py_func == NULL || !PyCallable_Check(py_func))
+            {
+                CONDUIT_ERROR("python_script does not define entry point "
+                              "function '" << entry_point << "'");
+            }
+            py_interp->cache_entry_point(filter_name, py_code, py_func);
+        }
+
+        PyObject *py_call_res = PyObject_CallObject(py_func, NULL);
+        Py_XDECREF(py_call_res);
+        FLOW_CHECK_PYTHON_ERROR(py_interp, !py_interp->check_error());
     }
 
     PyObject *py_res = py_interp->get_dict_object(py_mod_dict,
@@ -256,7 +374,8 @@ PyObject* execute_python(PyObject *py_input,
     {
         const std::string file_stack_src = "if len(_flow_source_file_stack) > 0:\n"
                                            "    __file__ = _flow_source_file_stack.pop()\n";
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(file_stack_src));
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_cached_script(file_stack_src,
+                                                                        py_interp->global_dict()));
     }
 
     // we need to incref b/c py_res is borrowed, and flow will decref
@@ -327,6 +446,8 @@ PythonScript::declare_interface(Node &i)
     i["type_name"] = "python_script";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    // shares the interpreter
+    i["thread_safe"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -371,6 +492,19 @@ PythonScript::verify_params(const conduit::Node &params,
         }
     }
 
+    if( params.has_child("entry_point") )
+    {
+        if( !params["entry_point"].dtype().is_string() )
+        {
+            info["errors"].append() = "parameter 'entry_point' is not a string";
+            res = false;
+        }
+        else
+        {
+            info["info"].append().set("provides 'entry_point' function name");
+        }
+    }
+
     if( params.has_child("interface") )
     {
         const Node &n_iface = params["interface"];
@@ -414,18 +548,44 @@ PythonScript::verify_params(const conduit::Node &params,
             }
         }
 
+        if( n_iface.has_child("state") )
+        {
+            if( !n_iface["state"].dtype().is_string() )
+            {
+                info["errors"].append() = "parameter 'interface/state' is not a string";
+                res = false;
+            }
+            else
+            {
+                info["info"].append().set("provides 'interface/state' function name override");
+            }
+        }
+
     }
 
     return res;
 }
 
 //-----------------------------------------------------------------------------
-void PythonScript::execute_python(conduit::Node *n)
+void PythonScript::execute_python(conduit::Node *n,
+                                  conduit::Node *state)
 {
     PythonInterpreter *py_interp = interpreter();
     PyObject * py_input = PyConduit_Node_Python_Wrap(n,0);
 
-    PyObject *py_res = detail::execute_python(py_input, py_interp, params());
+    PyObject * py_state = NULL;
+    if(state != NULL)
+    {
+        py_state = PyConduit_Node_Python_Wrap(state,0);
+    }
+
+    PyObject *py_res = detail::execute_python(py_input,
+                                              py_interp,
+                                              params(),
+                                              name(),
+                                              py_state);
+    // the module dict holds its own reference
+    Py_XDECREF(py_state);
     set_output<PyObject>(py_res);
 }
 
@@ -444,7 +604,10 @@ PythonScript::execute()
         PyObject *py_input = NULL;
         py_input = input<PyObject>(0);
         PythonInterpreter *py_interp = interpreter();
-        PyObject *py_res = detail::execute_python(py_input, py_interp, params());
+        PyObject *py_res = detail::execute_python(py_input,
+                                                  py_interp,
+                                                  params(),
+                                                  name());
         set_output<PyObject>(py_res);
     }
     else if(input(0).check_type<conduit::Node>())
@@ -61,7 +61,10 @@ public:
     virtual void   execute();
 
 protected:
-    void execute_python(conduit::Node *n);
+    // state is optional, when provided it is exposed to the
+    // script via the 'interface/state' function (default: flow_state)
+    void execute_python(conduit::Node *n,
+                        conduit::Node *state = NULL);
 private:
     static flow::PythonInterpreter *interpreter();
     static flow::PythonInterpreter *m_interp;
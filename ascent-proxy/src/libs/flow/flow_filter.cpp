@@ -151,6 +151,18 @@ Filter::output_port() const
     return properties()["interface/output_port"].as_string() == "true";
 }
 
+//-----------------------------------------------------------------------------
+bool
+Filter::thread_safe() const
+{
+    // filters must opt in to concurrent execution
+    if(!properties().has_path("interface/thread_safe"))
+    {
+        return false;
+    }
+    return properties()["interface/thread_safe"].as_string() == "true";
+}
+
 //-----------------------------------------------------------------------------
 bool
 Filter::has_port(const std::string &port_name) const
@@ -254,6 +266,19 @@ Filter::verify_interface(const Node &i,
         }
     }
 
+    if(i.has_child("thread_safe"))
+    {
+        if(!i["thread_safe"].dtype().is_string() ||
+           (i["thread_safe"].as_string() != "true" &&
+            i["thread_safe"].as_string() != "false"))
+        {
+            std::string msg = "interface 'thread_safe' is not "
+                              "{\"true\" | \"false\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
     if(i.has_child("port_names"))
     {
         NodeConstIterator itr(&i["port_names"]);
@@ -56,6 +56,12 @@ class Graph;
 ///    // declare if this filter provides output
 ///    i["output_port"] = {"true" | "false"};
 ///
+///    // optionally declare if this filter can execute concurrently
+///    // with other filters (default "false"). Filters that are not
+///    // thread safe (e.g. that run python or MPI collectives) are run
+///    // one at a time in a fixed order by the threaded executor.
+///    i["thread_safe"] = {"true" | "false"};
+///
 ///    // declare the names of this filters input ports
 ///    // Provide a conduit list of strings with the names of the input ports
 ///    // or DataType::empty() if there are no input ports.
@@ -136,6 +142,7 @@ public:
     std::string           type_name()   const;
     const conduit::Node  &port_names()  const;
     bool                  output_port() const;
+    bool                  thread_safe() const;
 
     const conduit::Node  &default_params() const;
 
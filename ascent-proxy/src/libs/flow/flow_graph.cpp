@@ -49,7 +49,8 @@ namespace flow
 //-----------------------------------------------------------------------------
 Graph::Graph(Workspace *w)
 :m_workspace(w),
- m_filter_count(0)
+ m_filter_count(0),
+ m_revision(0)
 {
     init();
 }
@@ -83,6 +84,7 @@ Graph::reset()
     m_filters.clear();
     m_edges.reset();
     init();
+    m_revision++;
 
 }
 
@@ -156,6 +158,7 @@ Graph::add_filter(const std::string &filter_type,
     }
 
     m_filter_count++;
+    m_revision++;
 
     return f;
 }
@@ -221,6 +224,7 @@ Graph::connect(const std::string &src_name,
 
     m_edges["in"][des_name][port_name] = src_name;
     m_edges["out"][src_name].append().set(des_name);
+    m_revision++;
 }
 
 //-----------------------------------------------------------------------------
@@ -274,6 +278,7 @@ Graph::remove_filter(const std::string &name)
 
     m_edges["in"].remove(name);
     m_edges["out"].remove(name);
+    m_revision++;
 }
 
 //-----------------------------------------------------------------------------
@@ -305,6 +310,13 @@ Graph::filters()
     return m_filters;
 }
 
+//-----------------------------------------------------------------------------
+int
+Graph::revision() const
+{
+    return m_revision;
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -177,11 +177,16 @@ private:
 
     std::map<std::string,Filter*> &filters();
 
+    /// changes whenever filters or connections are added or removed,
+    /// used to invalidate cached execution plans
+    int                  revision() const;
+
 
     Workspace                       *m_workspace;
     conduit::Node                    m_edges;
     std::map<std::string,Filter*>    m_filters;
     int                              m_filter_count;
+    int                              m_revision;
 
 };
 
@@ -29,6 +29,21 @@ using namespace std;
 #define IS_PY3K
 #endif
 
+//-----------------------------------------------------------------------------
+// 64-bit fnv-1a, continuing from the passed hash
+static conduit::uint64
+fnv1a_hash(const char *data,
+           size_t num_bytes,
+           conduit::uint64 hash)
+{
+    for(size_t i = 0; i < num_bytes; i++)
+    {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 // Begin Functions to help with Python 2/3 Compatibility.
@@ -405,6 +420,8 @@ PythonInterpreter::reset()
 {
     if(m_running)
     {
+        // cached entry points were defined in the global dict
+        clear_entry_points();
         // clean gloal dict.
         PyDict_Clear(m_py_global_dict);
     }
@@ -421,6 +438,10 @@ PythonInterpreter::shutdown()
 {
     if(m_running)
     {
+        // code objects must be released while python is alive
+        clear_entry_points();
+        clear_code_cache();
+
         if(m_handled_init)
         {
             Py_Finalize();
@@ -523,6 +544,197 @@ PythonInterpreter::run_script_file(const std::string &fname,
 
 
 
+//-----------------------------------------------------------------------------
+///
+/// Compiles (or fetches from the code cache) and executes the passed
+/// python script in the given dict.
+///
+//-----------------------------------------------------------------------------
+bool
+PythonInterpreter::run_cached_script(const std::string &script,
+                                     PyObject *py_dict,
+                                     const std::string &file_name)
+{
+    bool res = false;
+    if(m_running)
+    {
+        if(m_echo)
+        {
+            CONDUIT_INFO("PythonInterpreter::run_cached_script " << script);
+        }
+
+        PyObject *py_code = compiled_script(script, file_name);
+        if(py_code != NULL)
+        {
+            res = run_code(py_code, py_dict);
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Returns the compiled code object for the passed script, compiling
+/// and caching it on first use. Returns a borrowed reference.
+///
+//-----------------------------------------------------------------------------
+PyObject *
+PythonInterpreter::compiled_script(const std::string &script,
+                                   const std::string &file_name)
+{
+    if(!m_running)
+    {
+        return NULL;
+    }
+
+    // the file name is baked into the code object (it shows
+    // up in tracebacks), so it is part of the hash. the length
+    // guards against collisions between scripts of different sizes
+    conduit::uint64 hash = 14695981039346656037ULL; // fnv-1a
+    hash = fnv1a_hash(file_name.c_str(), file_name.size() + 1, hash);
+    hash = fnv1a_hash(script.c_str(), script.size(), hash);
+    CodeKey key(hash, script.size());
+
+    std::map<CodeKey,CodeList::iterator>::iterator itr = m_code_cache.find(key);
+    if(itr != m_code_cache.end())
+    {
+        // move to the front of the lru list
+        m_code_lru.splice(m_code_lru.begin(), m_code_lru, itr->second);
+        return itr->second->second;
+    }
+
+    PyObject *py_code = Py_CompileString(script.c_str(),
+                                         file_name.c_str(),
+                                         Py_file_input);
+    if(py_code == NULL || check_error())
+    {
+        Py_XDECREF(py_code);
+        return NULL;
+    }
+
+    m_code_lru.push_front(std::make_pair(key, py_code));
+    m_code_cache[key] = m_code_lru.begin();
+
+    // release the least recently used code objects, cached entry
+    // points hold their own refs so they stay valid
+    while((int)m_code_lru.size() > code_cache_capacity())
+    {
+        m_code_cache.erase(m_code_lru.back().first);
+        Py_XDECREF(m_code_lru.back().second);
+        m_code_lru.pop_back();
+    }
+
+    return py_code;
+}
+
+//-----------------------------------------------------------------------------
+int
+PythonInterpreter::code_cache_capacity()
+{
+    return 64;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Executes a code object in the given dict.
+///
+//-----------------------------------------------------------------------------
+bool
+PythonInterpreter::run_code(PyObject *py_code,
+                            PyObject *py_dict)
+{
+    bool res = false;
+    if(m_running && py_code != NULL)
+    {
+#ifdef IS_PY3K
+        PyObject *py_res = PyEval_EvalCode(py_code,
+                                           py_dict,
+                                           py_dict);
+#else
+        PyObject *py_res = PyEval_EvalCode((PyCodeObject*)py_code,
+                                           py_dict,
+                                           py_dict);
+#endif
+        Py_XDECREF(py_res);
+        if(!check_error())
+            res = true;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Releases all cached code objects.
+///
+//-----------------------------------------------------------------------------
+void
+PythonInterpreter::clear_code_cache()
+{
+    CodeList::iterator itr;
+    for(itr = m_code_lru.begin(); itr != m_code_lru.end(); itr++)
+    {
+        Py_XDECREF(itr->second);
+    }
+    m_code_lru.clear();
+    m_code_cache.clear();
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Returns the cached entry point function for key if py_code defined it.
+///
+//-----------------------------------------------------------------------------
+PyObject *
+PythonInterpreter::cached_entry_point(const std::string &key,
+                                      PyObject *py_code)
+{
+    std::map<std::string,std::pair<PyObject*,PyObject*>>::iterator itr;
+    itr = m_entry_points.find(key);
+    if(itr == m_entry_points.end() || itr->second.first != py_code)
+    {
+        return NULL;
+    }
+    return itr->second.second;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Caches an entry point function and the code object that defined it.
+///
+//-----------------------------------------------------------------------------
+void
+PythonInterpreter::cache_entry_point(const std::string &key,
+                                     PyObject *py_code,
+                                     PyObject *py_func)
+{
+    // take the new refs first, they may be the ones we replace
+    Py_XINCREF(py_code);
+    Py_XINCREF(py_func);
+
+    std::pair<PyObject*,PyObject*> &entry = m_entry_points[key];
+    Py_XDECREF(entry.first);
+    Py_XDECREF(entry.second);
+    entry.first  = py_code;
+    entry.second = py_func;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Releases all cached entry points.
+///
+//-----------------------------------------------------------------------------
+void
+PythonInterpreter::clear_entry_points()
+{
+    std::map<std::string,std::pair<PyObject*,PyObject*>>::iterator itr;
+    for(itr = m_entry_points.begin(); itr != m_entry_points.end(); itr++)
+    {
+        Py_XDECREF(itr->second.first);
+        Py_XDECREF(itr->second.second);
+    }
+    m_entry_points.clear();
+}
+
 //-----------------------------------------------------------------------------
 ///
 /// Adds C python object to the global dictionary.
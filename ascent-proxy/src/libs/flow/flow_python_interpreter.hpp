@@ -17,7 +17,10 @@
 #include <Python.h>
 
 #include <flow_exports.h>
+#include <list>
+#include <map>
 #include <string>
+#include <utility>
 #include <conduit.hpp>
 
 //-----------------------------------------------------------------------------
@@ -73,6 +76,38 @@ public:
     bool         run_script_file(const std::string &fname,
                                  PyObject *py_dict);
 
+    /// compiled script exec
+    ///  scripts are compiled once and the resulting code objects are
+    ///  cached (keyed by a hash of file name + source), so repeated
+    ///  execs of the same source skip the python parser and compiler.
+    ///  the least recently used code objects are released once the
+    ///  cache holds more than code_cache_capacity() entries
+    bool         run_cached_script(const std::string &script,
+                                   PyObject *py_dict,
+                                   const std::string &file_name = "<string>");
+    /// fetch (compiling if necessary) the cached code object
+    /// returns borrowed reference, NULL on error
+    PyObject    *compiled_script(const std::string &script,
+                                 const std::string &file_name = "<string>");
+    /// exec a code object in the given dict
+    bool         run_code(PyObject *py_code,
+                          PyObject *py_dict);
+    /// number of cached code objects
+    int          code_cache_size() const { return (int)m_code_lru.size(); }
+    static int   code_cache_capacity();
+    void         clear_code_cache();
+
+    /// entry point functions, keyed by the caller (e.g. a filter name)
+    ///  returns the cached function (borrowed) if it was defined by
+    ///  py_code, NULL otherwise
+    PyObject    *cached_entry_point(const std::string &key,
+                                    PyObject *py_code);
+    /// caches py_func as defined by py_code, holds references to both
+    void         cache_entry_point(const std::string &key,
+                                   PyObject *py_code,
+                                   PyObject *py_func);
+    void         clear_entry_points();
+
     /// set into global dict
     bool         set_global_object(PyObject *py_obj,
                                    const std::string &name);
@@ -124,6 +159,15 @@ private:
     PyObject    *m_py_trace_print_exception_func;
     PyObject    *m_py_sio_class;
 
+    // (hash of file name + source, source length)
+    typedef std::pair<conduit::uint64,size_t> CodeKey;
+    typedef std::list<std::pair<CodeKey,PyObject*>> CodeList;
+    // compiled code objects, most recently used first (owned refs)
+    CodeList                             m_code_lru;
+    std::map<CodeKey,CodeList::iterator> m_code_cache;
+    // key -> (defining code object, entry point function) (owned refs)
+    std::map<std::string,std::pair<PyObject*,PyObject*>> m_entry_points;
+
 };
 
 
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <mutex>
 
 using namespace conduit;
 using namespace std;
@@ -119,10 +120,16 @@ public:
 
     void   reset();
 
+    // guards the maps and ref counts, filters executed on
+    // different threads share the registry.
+    // recursive since fetch() prints the registry on error
+    std::recursive_mutex &mutex() const;
+
 private:
 
     std::map<void*,Value*>         m_values;
     std::map<std::string,Entry*>   m_entries;
+    mutable std::recursive_mutex   m_mutex;
 
 };
 
@@ -321,6 +328,13 @@ Registry::Map::~Map()
     // empty
 }
 
+//-----------------------------------------------------------------------------
+std::recursive_mutex &
+Registry::Map::mutex() const
+{
+    return m_mutex;
+}
+
 //-----------------------------------------------------------------------------
 void
 Registry::Map::add(const std::string &key,
@@ -538,6 +552,7 @@ Registry::~Registry()
 bool
 Registry::has_entry(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     return m_map->has_entry(key);
 }
 
@@ -545,6 +560,7 @@ Registry::has_entry(const std::string &key)
 void
 Registry::consume(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         m_map->dec(key);
@@ -555,6 +571,7 @@ Registry::consume(const std::string &key)
 void
 Registry::detach(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         m_map->detach(key);
@@ -566,6 +583,7 @@ Registry::detach(const std::string &key)
 void
 Registry::reset()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     m_map->reset();
 }
 
@@ -574,6 +592,7 @@ Registry::reset()
 void
 Registry::info(Node &out) const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     m_map->info(out);
 }
 
@@ -613,6 +632,7 @@ Registry::print() const
 Data &
 Registry::fetch(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(!m_map->has_entry(key))
     {
         print();
@@ -628,6 +648,7 @@ Registry::add(const std::string &key,
               Data &data,
               int refs_needed)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         CONDUIT_WARN("Attempt to overwrite existing entry with key: " << key);
@@ -19,6 +19,12 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 using namespace conduit;
 using namespace std;
@@ -35,6 +41,8 @@ namespace flow
 // we will try this strategy.
 int Workspace::m_default_mpi_comm = -1;
 static int g_timing_exec_count = 0;
+// filters executed on different threads share the timing log
+static std::mutex g_timing_mutex;
 
 //-----------------------------------------------------------------------------
 class Workspace::ExecutionPlan
@@ -54,6 +62,103 @@ class Workspace::ExecutionPlan
                                        conduit::Node &tarv);
 };
 
+//-----------------------------------------------------------------------------
+// An execution plan resolved to filter pointers and step indices.
+//
+// Built from the ExecutionPlan traversals once per graph revision, so
+// executing an unchanged graph does not rebuild traversals or look up
+// filters and edges by name.
+//-----------------------------------------------------------------------------
+class Workspace::CompiledPlan
+{
+    public:
+        struct Input
+        {
+            std::string  port_name;
+            // registry key of the source filter's output
+            std::string  src_name;
+        };
+
+        struct Step
+        {
+            Filter                *filter;
+            std::string            name;
+            bool                   output_port;
+            int                    uref;
+            bool                   thread_safe;
+            std::vector<Input>     inputs;
+            // steps fed by this step, once per connected port
+            std::vector<int>       dependents;
+            // number of connected input ports
+            int                    num_deps;
+        };
+
+        CompiledPlan();
+        ~CompiledPlan();
+
+        void compile(Graph &graph);
+        void reset();
+
+        bool                       valid;
+        int                        revision;
+        // number of times compile was called
+        int                        compiles;
+        // in sequential execution order
+        std::vector<Step>          steps;
+        // steps that are not thread safe, in sequential order
+        std::vector<int>           serial;
+};
+
+//-----------------------------------------------------------------------------
+// Executes the filters of a plan on a pool of threads.
+//
+// A filter becomes ready once all the filters feeding its input ports
+// have executed. Ready filters are pushed onto the deque of the thread
+// that made them ready, each thread pops work from the back of its own
+// deque and steals from the front of the others when it runs dry, so
+// chains of filters tend to stay on one thread.
+//
+// Filters that are not thread safe (python, MPI collectives) are
+// executed on the calling thread, one at a time, in the order of the
+// sequential plan. This keeps the sequence of collectives identical
+// on every rank and keeps MPI and python calls on the main thread.
+//-----------------------------------------------------------------------------
+class Workspace::ThreadedExecutor
+{
+    public:
+        ThreadedExecutor(Workspace &workspace,
+                         const CompiledPlan &plan,
+                         int num_threads);
+        ~ThreadedExecutor();
+
+        void execute();
+
+    private:
+        void worker(int tid);
+        bool next_task(int tid, int &idx);
+        void finished(int tid, int idx);
+        void schedule(int tid, int idx);
+
+        Workspace                       &m_workspace;
+        const CompiledPlan              &m_plan;
+        int                              m_num_threads;
+
+        // guarded by m_mutex
+        std::vector<int>                 m_pending;
+        size_t                           m_serial_next;
+        bool                             m_serial_ready;
+        int                              m_remaining;
+        bool                             m_failed;
+        std::exception_ptr               m_error;
+        std::mutex                       m_mutex;
+        std::condition_variable          m_cond;
+
+        // per thread work deques
+        std::vector<std::deque<int> >    m_queues;
+        std::vector<std::mutex>          m_queue_mutexes;
+        std::atomic<int>                 m_queued;
+};
+
 //-----------------------------------------------------------------------------
 class Workspace::FilterFactory
 {
@@ -210,12 +315,322 @@ Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+Workspace::CompiledPlan::CompiledPlan()
+: valid(false),
+  revision(-1),
+  compiles(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Workspace::CompiledPlan::~CompiledPlan()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::CompiledPlan::reset()
+{
+    valid = false;
+    revision = -1;
+    steps.clear();
+    serial.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::CompiledPlan::compile(Graph &graph)
+{
+    reset();
+    compiles++;
+
+    Node traversals;
+    ExecutionPlan::generate(graph,traversals);
+
+    std::map<std::string,int> index;
+
+    // each filter appears in exactly one traversal
+    NodeConstIterator travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        NodeConstIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            const Node &t = trav_itr.next();
+            std::string f_name = trav_itr.name();
+            index[f_name] = (int) steps.size();
+
+            Step step;
+            step.filter      = graph.filters()[f_name];
+            step.name        = f_name;
+            step.output_port = step.filter->output_port();
+            step.uref        = t.to_int32();
+            step.thread_safe = step.filter->thread_safe();
+            step.num_deps    = 0;
+            steps.push_back(step);
+        }
+    }
+
+    const int num_steps = (int) steps.size();
+    for(int idx = 0; idx < num_steps; ++idx)
+    {
+        Step &step = steps[idx];
+        const Node &edges_in = graph.edges_in(step.name);
+        // a filter connected to several ports releases each of them
+        NodeConstIterator ports_itr(&step.filter->port_names());
+        while(ports_itr.has_next())
+        {
+            Input input;
+            input.port_name = ports_itr.next().as_string();
+            input.src_name  = edges_in[input.port_name].as_string();
+            step.inputs.push_back(input);
+            steps[index[input.src_name]].dependents.push_back(idx);
+            step.num_deps++;
+        }
+
+        if(!step.thread_safe)
+        {
+            serial.push_back(idx);
+        }
+    }
+
+    revision = graph.revision();
+    valid = true;
+}
+
+//-----------------------------------------------------------------------------
+Workspace::ThreadedExecutor::ThreadedExecutor(Workspace &workspace,
+                                              const CompiledPlan &plan,
+                                              int num_threads)
+: m_workspace(workspace),
+  m_plan(plan),
+  m_num_threads(num_threads),
+  m_serial_next(0),
+  m_serial_ready(false),
+  m_remaining((int)plan.steps.size()),
+  m_failed(false),
+  m_queues(num_threads),
+  m_queue_mutexes(num_threads),
+  m_queued(0)
+{
+    m_pending.resize(plan.steps.size());
+    for(size_t idx = 0; idx < plan.steps.size(); ++idx)
+    {
+        m_pending[idx] = plan.steps[idx].num_deps;
+    }
+}
+
+//-----------------------------------------------------------------------------
+Workspace::ThreadedExecutor::~ThreadedExecutor()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ThreadedExecutor::execute()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(size_t idx = 0; idx < m_plan.steps.size(); ++idx)
+        {
+            if(m_pending[idx] == 0)
+            {
+                schedule(0, (int)idx);
+            }
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for(int tid = 1; tid < m_num_threads; ++tid)
+    {
+        threads.push_back(std::thread(&ThreadedExecutor::worker, this, tid));
+    }
+
+    // the calling thread is worker 0
+    worker(0);
+
+    for(size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    if(m_error)
+    {
+        std::rethrow_exception(m_error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// schedule a filter whose inputs are ready, m_mutex must be held
+void
+Workspace::ThreadedExecutor::schedule(int tid, int idx)
+{
+    if(!m_plan.steps[idx].thread_safe)
+    {
+        // only released once it is next in the serial order
+        if(m_plan.serial[m_serial_next] == idx)
+        {
+            m_serial_ready = true;
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> qlock(m_queue_mutexes[tid]);
+        m_queues[tid].push_back(idx);
+        m_queued++;
+    }
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::ThreadedExecutor::next_task(int tid, int &idx)
+{
+    // serial filters only run on the calling thread
+    if(tid == 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_serial_ready)
+        {
+            m_serial_ready = false;
+            idx = m_plan.serial[m_serial_next];
+            return true;
+        }
+    }
+
+    // own work, newest first
+    {
+        std::lock_guard<std::mutex> qlock(m_queue_mutexes[tid]);
+        if(!m_queues[tid].empty())
+        {
+            idx = m_queues[tid].back();
+            m_queues[tid].pop_back();
+            m_queued--;
+            return true;
+        }
+    }
+
+    // steal, oldest first
+    for(int i = 1; i < m_num_threads; ++i)
+    {
+        int victim = (tid + i) % m_num_threads;
+        std::lock_guard<std::mutex> qlock(m_queue_mutexes[victim]);
+        if(!m_queues[victim].empty())
+        {
+            idx = m_queues[victim].front();
+            m_queues[victim].pop_front();
+            m_queued--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ThreadedExecutor::finished(int tid, int idx)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_remaining--;
+
+    const CompiledPlan::Step &step = m_plan.steps[idx];
+
+    if(!step.thread_safe)
+    {
+        m_serial_next++;
+        // the next serial filter may already have its inputs
+        if(m_serial_next < m_plan.serial.size() &&
+           m_pending[m_plan.serial[m_serial_next]] == 0)
+        {
+            m_serial_ready = true;
+        }
+    }
+
+    for(size_t i = 0; i < step.dependents.size(); ++i)
+    {
+        int dep = step.dependents[i];
+        m_pending[dep]--;
+        if(m_pending[dep] == 0)
+        {
+            schedule(tid, dep);
+        }
+    }
+
+    if(m_remaining == 0)
+    {
+        m_cond.notify_all();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ThreadedExecutor::worker(int tid)
+{
+    while(true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_failed || m_remaining == 0)
+            {
+                return;
+            }
+        }
+
+        int idx = -1;
+        if(next_task(tid, idx))
+        {
+            try
+            {
+                m_workspace.execute_step(idx);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(!m_failed)
+                {
+                    m_failed = true;
+                    m_error = std::current_exception();
+                }
+                m_cond.notify_all();
+                return;
+            }
+            finished(tid, idx);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [&]
+        {
+            return m_failed ||
+                   m_remaining == 0 ||
+                   m_queued > 0 ||
+                   (tid == 0 && m_serial_ready);
+        });
+
+        if(m_failed || m_remaining == 0)
+        {
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 Workspace::Workspace()
 :m_graph(this),
  m_registry(),
  m_timing_info(),
- m_enable_timings(false)
+ m_enable_timings(false),
+ m_num_threads(1),
+ m_plan(new CompiledPlan())
 {
 
 }
@@ -223,7 +638,7 @@ Workspace::Workspace()
 //-----------------------------------------------------------------------------
 Workspace::~Workspace()
 {
-
+    // empty, m_plan needs the complete CompiledPlan type here
 }
 
 //-----------------------------------------------------------------------------
@@ -268,86 +683,118 @@ void
 Workspace::execute()
 {
     Timer t_total_exec;
-    Node traversals;
-    ExecutionPlan::generate(graph(),traversals);
-    // execute traversals
-    NodeIterator travs_itr = traversals.children();
 
-    while(travs_itr.has_next())
+    // the plan only changes when the graph does
+    if(!m_plan->valid || m_plan->revision != graph().revision())
     {
-        NodeIterator trav_itr(&travs_itr.next());
+        m_plan->compile(graph());
+    }
 
-        while(trav_itr.has_next())
+    if(m_num_threads > 1)
+    {
+        ThreadedExecutor executor(*this, *m_plan, m_num_threads);
+        executor.execute();
+    }
+    else
+    {
+        const size_t num_steps = m_plan->steps.size();
+        for(size_t idx = 0; idx < num_steps; ++idx)
         {
-            Node &t = trav_itr.next();
-
-            std::string  f_name = trav_itr.name();
-            int          uref   = t.to_int32();
-            Filter      *f      = graph().filters()[f_name];
+            execute_step((int)idx);
+        }
+    }
 
-            f->reset_inputs_and_output();
+    if(m_enable_timings)
+    {
+        m_timing_info << g_timing_exec_count
+                      << " [total] "
+                      << std::fixed << t_total_exec.elapsed()
+                      <<"\n";
+        g_timing_exec_count++;
+    }
 
-            // fetch inputs from reg, attach to filter's ports
-            NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
-            //registry().print();
-            std::vector<std::string> f_i_names;
-            while(ports_itr.has_next())
-            {
-                std::string port_name = ports_itr.next().as_string();
-                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
-                f->set_input(port_name,&registry().fetch(f_input_name));
-            }
 
-            Timer t_flt_exec;
-            // execute
-            f->execute();
 
-            if(m_enable_timings)
-            {
-                m_timing_info << g_timing_exec_count
-                              << " " << f->name()
-                              << " " << std::fixed << t_flt_exec.elapsed()
-                              <<"\n";
-            }
-
-            // if has output, set output
-            if(f->output_port())
-            {
-                if(f->output().data_ptr() == NULL)
-                {
-                    CONDUIT_ERROR("filter output is NULL, was set_output() called?");
-                }
+}
 
-                registry().add(f_name,
-                               f->output(),
-                               uref);
-            }
+//-----------------------------------------------------------------------------
+void
+Workspace::execute_step(int idx)
+{
+    const CompiledPlan::Step &step = m_plan->steps[idx];
+    Filter *f = step.filter;
 
-            f->reset_inputs_and_output();
+    f->reset_inputs_and_output();
 
-            // consume inputs
-            ports_itr.to_front();
-            while(ports_itr.has_next())
-            {
-                std::string port_name = ports_itr.next().as_string();
-                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
-                registry().consume(f_input_name);
-            }
-        }
+    // fetch inputs from reg, attach to filter's ports
+    const size_t num_inputs = step.inputs.size();
+    for(size_t i = 0; i < num_inputs; ++i)
+    {
+        const CompiledPlan::Input &in = step.inputs[i];
+        f->set_input(in.port_name,&registry().fetch(in.src_name));
     }
 
+    Timer t_flt_exec;
+    // execute
+    f->execute();
+
     if(m_enable_timings)
     {
+        std::lock_guard<std::mutex> lock(g_timing_mutex);
         m_timing_info << g_timing_exec_count
-                      << " [total] "
-                      << std::fixed << t_total_exec.elapsed()
+                      << " " << f->name()
+                      << " " << std::fixed << t_flt_exec.elapsed()
                       <<"\n";
-        g_timing_exec_count++;
     }
 
+    // if has output, set output
+    if(step.output_port)
+    {
+        if(f->output().data_ptr() == NULL)
+        {
+            CONDUIT_ERROR("filter output is NULL, was set_output() called?");
+        }
 
+        registry().add(step.name,
+                       f->output(),
+                       step.uref);
+    }
 
+    f->reset_inputs_and_output();
+
+    // consume inputs
+    for(size_t i = 0; i < num_inputs; ++i)
+    {
+        registry().consume(step.inputs[i].src_name);
+    }
 }
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_num_threads(int num_threads)
+{
+    if(num_threads < 1)
+    {
+        CONDUIT_ERROR("flow::Workspace num_threads must be at least 1, "
+                      "given " << num_threads);
+    }
+    m_num_threads = num_threads;
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::num_threads() const
+{
+    return m_num_threads;
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::plan_compile_count() const
+{
+    return m_plan->compiles;
+}
+
 //-----------------------------------------------------------------------------
 
 void Workspace::enable_timings(bool enabled)
@@ -361,6 +808,7 @@ Workspace::reset()
 {
     graph().reset();
     registry().reset();
+    m_plan->reset();
 }
 
 
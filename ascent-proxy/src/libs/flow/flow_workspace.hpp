@@ -21,6 +21,7 @@
 #include <flow_data.hpp>
 #include <flow_registry.hpp>
 #include <flow_graph.hpp>
+#include <memory>
 #include <sstream>
 
 
@@ -66,6 +67,17 @@ public:
     /// execute the filter graph.
     void             execute();
 
+    /// number of threads used to execute the filter graph.
+    /// with 1 (the default) filters execute one after another, with
+    /// more, filters execute as soon as their inputs are ready and
+    /// independent branches overlap.
+    void             set_num_threads(int num_threads);
+    int              num_threads() const;
+
+    /// number of times the execution plan was compiled, the plan is
+    /// reused until the graph changes
+    int              plan_compile_count() const;
+
     /// reset the registry and graph
     void             reset();
 
@@ -149,15 +161,25 @@ private:
 
     static Filter *create_filter(const std::string &filter_type);
 
+    /// fetches inputs, executes the filter of the given plan step,
+    /// and publishes its output
+    /// (shared by the sequential and threaded executors)
+    void           execute_step(int step_idx);
+
     static int  m_default_mpi_comm;
 
     class ExecutionPlan;
+    class CompiledPlan;
+    class ThreadedExecutor;
     class FilterFactory;
 
     Graph             m_graph;
     Registry          m_registry;
     std::stringstream m_timing_info;
     bool              m_enable_timings;
+    int               m_num_threads;
+    // execution plan, recompiled when the graph changes
+    std::unique_ptr<CompiledPlan> m_plan;
 
 };
 
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <math.h>
+#include <vector>
 
 #include <conduit_blueprint.hpp>
 #include <conduit_relay_io_blueprint.hpp>
@@ -247,6 +248,141 @@ TEST(ascent_amr, test_amr_render_complex_ghosts)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_amr, test_amr_republish_same_structure)
+{
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    blueprint::mesh::examples::julia_nestsets_complex(EXAMPLE_MESH_SIDE_DIM,
+                                                      EXAMPLE_MESH_SIDE_DIM,
+                                                      -2.0,  2.0, // x range
+                                                      -2.0,  2.0, // y range
+                                                      0.285, 0.01, // c value
+                                                      2, // amr levels
+                                                      data);
+
+    // a field the "simulation" updates in place between publishes
+    const int num_domains = data.number_of_children();
+    std::vector<std::vector<float64>> values(num_domains);
+    for(int i = 0; i < num_domains; ++i)
+    {
+      Node &dom = data.child(i);
+      const index_t size = dom["fields/iters/values"].dtype().number_of_elements();
+      values[i].assign(size, 1.0);
+      dom["fields/energy/association"] = "element";
+      dom["fields/energy/topology"] = dom["fields/iters/topology"].as_string();
+      dom["fields/energy/values"].set_external(values[i]);
+    }
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    conduit::Node actions;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "max(field('energy'))";
+    add_queries["queries/q1/params/name"] = "max_energy";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+
+    // the second and third publish reuse the domain ids and painted
+    // ghosts of the first, but must still see the new field values
+    for(int cycle = 1; cycle <= 3; ++cycle)
+    {
+      for(int i = 0; i < num_domains; ++i)
+      {
+        data.child(i)["state/cycle"] = cycle;
+        values[i].assign(values[i].size(), (float64) cycle);
+      }
+      ascent.publish(data);
+      ascent.execute(actions);
+
+      conduit::Node info;
+      ascent.info(info);
+      const std::string path = "expressions/max_energy/" +
+                               std::to_string(cycle) + "/attrs/value/value";
+      EXPECT_TRUE(info.has_path(path));
+      EXPECT_EQ(info[path].to_float64(), (float64) cycle);
+    }
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_amr, test_amr_republish_ghosts_in_place)
+{
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    blueprint::mesh::examples::julia_nestsets_complex(EXAMPLE_MESH_SIDE_DIM,
+                                                      EXAMPLE_MESH_SIDE_DIM,
+                                                      -2.0,  2.0, // x range
+                                                      -2.0,  2.0, // y range
+                                                      0.285, 0.01, // c value
+                                                      2, // amr levels
+                                                      data);
+
+    // ghosts the "simulation" updates in place between publishes
+    const int num_domains = data.number_of_children();
+    std::vector<std::vector<int32>> ghosts(num_domains);
+    for(int i = 0; i < num_domains; ++i)
+    {
+      Node &dom = data.child(i);
+      const index_t size = dom["fields/iters/values"].dtype().number_of_elements();
+      ghosts[i].assign(size, 0);
+      dom["fields/ghosts/association"] = "element";
+      dom["fields/ghosts/topology"] = dom["fields/iters/topology"].as_string();
+      dom["fields/ghosts/values"].set_external(ghosts[i]);
+    }
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts/e1/type"] = "conduit";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["ghost_field_name"] = "ghosts";
+    ascent.open(ascent_opts);
+
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    // mark every zone as a ghost without moving the array, the painted
+    // copy of the first publish must not be reused
+    for(int i = 0; i < num_domains; ++i)
+    {
+      ghosts[i].assign(ghosts[i].size(), 1);
+    }
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    conduit::Node extract_copy;
+    extract_copy.set(ascent.info()["extracts"][0]["data"]);
+    ascent.close();
+
+    EXPECT_EQ(extract_copy.number_of_children(), num_domains);
+    for(int i = 0; i < extract_copy.number_of_children(); ++i)
+    {
+      Node values;
+      extract_copy.child(i)["fields/ghosts/values"].to_int32_array(values);
+      int32_array painted = values.value();
+      for(index_t z = 0; z < painted.number_of_elements(); ++z)
+      {
+        EXPECT_GE(painted[z], 1);
+      }
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
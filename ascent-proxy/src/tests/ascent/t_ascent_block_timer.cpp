@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_block_timer.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <ascent_block_timer.hpp>
+
+#include <iostream>
+#include <thread>
+
+#include "t_config.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+// regions are accumulated for the life of the process, so each test
+// uses its own timer names
+
+//-----------------------------------------------------------------------------
+void
+timed_outer_inner(int num_outer, int num_inner)
+{
+    for(int i = 0; i < num_outer; ++i)
+    {
+        ASCENT_BLOCK_TIMER(t_threads_outer);
+        for(int j = 0; j < num_inner; ++j)
+        {
+            ASCENT_BLOCK_TIMER(t_threads_inner);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+int warning_count = 0;
+
+//-----------------------------------------------------------------------------
+void
+count_warning(const std::string &,
+              const std::string &,
+              int)
+{
+    warning_count++;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, register_ids)
+{
+    int id_a = BlockTimer::Register("t_register_a");
+    int id_b = BlockTimer::Register("t_register_b");
+
+    EXPECT_NE(id_a, id_b);
+    EXPECT_EQ(id_a, BlockTimer::Register("t_register_a"));
+    EXPECT_EQ(id_b, BlockTimer::Register(std::string("t_register_b")));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, nested_regions_two_threads)
+{
+    std::thread t0(timed_outer_inner, 2, 3);
+    std::thread t1(timed_outer_inner, 2, 3);
+    t0.join();
+    t1.join();
+
+    Node &res = BlockTimer::Finalize();
+    EXPECT_TRUE(res.has_path("children/t_threads_outer"));
+    // the inner region is only recorded below the outer one
+    EXPECT_FALSE(res.has_path("children/t_threads_inner"));
+
+    const Node &outer = res["children/t_threads_outer"];
+    EXPECT_EQ(outer["count"].to_uint32(), 4);
+    EXPECT_TRUE(outer["value"].to_float64() >= 0.0);
+
+    const Node &inner = outer["children/t_threads_inner"];
+    EXPECT_EQ(inner["count"].to_uint32(), 12);
+    EXPECT_TRUE(inner["value"].to_float64() >= 0.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, barrier_macro)
+{
+    for(int i = 0; i < 3; ++i)
+    {
+        ASCENT_BLOCK_TIMER_BARRIER(t_barrier_region);
+    }
+
+    Node &res = BlockTimer::Finalize();
+    EXPECT_TRUE(res.has_path("children/t_barrier_region"));
+    EXPECT_EQ(res["children/t_barrier_region/count"].to_uint32(), 3);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, start_stop_by_id)
+{
+    int outer_id = BlockTimer::Register("t_id_outer");
+    int inner_id = BlockTimer::Register("t_id_inner");
+
+    for(int i = 0; i < 2; ++i)
+    {
+        BlockTimer::StartTimer(outer_id);
+        BlockTimer::StartTimer(inner_id);
+        BlockTimer::StopTimer(inner_id);
+        BlockTimer::StopTimer(outer_id);
+    }
+
+    // the name based calls resolve to the same region
+    BlockTimer::StartTimer("t_id_outer");
+    BlockTimer::StopTimer("t_id_outer");
+
+    Node &res = BlockTimer::Finalize();
+    EXPECT_EQ(res["children/t_id_outer/count"].to_uint32(), 3);
+    EXPECT_EQ(res["children/t_id_outer/children/t_id_inner/count"].to_uint32(),
+              2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, mismatched_stop)
+{
+    int outer_id = BlockTimer::Register("t_mismatch_outer");
+    int other_id = BlockTimer::Register("t_mismatch_other");
+
+    warning_count = 0;
+    conduit::utils::set_warning_handler(count_warning);
+
+    BlockTimer::StartTimer(outer_id);
+    // warns and leaves the running timer on the stack
+    BlockTimer::StopTimer(other_id);
+    EXPECT_EQ(warning_count, 1);
+    BlockTimer::StopTimer(outer_id);
+    EXPECT_EQ(warning_count, 1);
+
+    conduit::utils::set_warning_handler(conduit::utils::default_warning_handler);
+
+    Node &res = BlockTimer::Finalize();
+    EXPECT_EQ(res["children/t_mismatch_outer/count"].to_uint32(), 1);
+    EXPECT_FALSE(res.has_path("children/t_mismatch_other"));
+}
@@ -332,6 +332,20 @@ TEST(ascent_blueprint_reductions, field_max_braid_cpu)
     EXPECT_EQ(res.fetch_existing("index").to_int32(), 817);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_blueprint_reductions, field_max_assoc_braid_cpu)
+{
+    ExecutionManager::set_execution_policy(ExecutionManager::preferred_cpu_policy());
+    Node dataset;
+    gen_braid_cpu_example_input_mesh(dataset);
+
+    // braid is a vertex field and radial an element field
+    Node res = runtime::expressions::field_max(dataset,"braid");
+    EXPECT_EQ(res["assoc"].as_string(), "vertex");
+    res = runtime::expressions::field_max(dataset,"radial");
+    EXPECT_EQ(res["assoc"].as_string(), "element");
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_blueprint_reductions, field_min_braid_cpu)
 {
@@ -370,6 +384,55 @@ TEST(ascent_blueprint_reductions, field_ave_braid_cpu)
     EXPECT_NEAR(res.fetch_existing("value").to_float64(),  -0.0330382025840188, 0.001);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_blueprint_reductions, field_reductions_batched_braid_cpu)
+{
+    ExecutionManager::set_execution_policy(ExecutionManager::preferred_cpu_policy());
+    Node dataset;
+    gen_braid_cpu_example_input_mesh(dataset);
+
+    std::vector<std::string> fields;
+    fields.push_back("braid");
+    fields.push_back("radial");
+    Node res = runtime::expressions::field_reductions_batched(dataset, fields);
+    res.print();
+
+    for(size_t i = 0; i < fields.size(); ++i)
+    {
+        const Node &batched = res[fields[i]];
+        Node max_res = runtime::expressions::field_max(dataset, fields[i]);
+        Node min_res = runtime::expressions::field_min(dataset, fields[i]);
+        Node sum_res = runtime::expressions::field_sum(dataset, fields[i]);
+        EXPECT_EQ(batched["max/value"].to_float64(), max_res["value"].to_float64());
+        EXPECT_EQ(batched["max/index"].to_int32(), max_res["index"].to_int32());
+        EXPECT_EQ(batched["max/assoc"].as_string(), max_res["assoc"].as_string());
+        EXPECT_EQ(batched["min/value"].to_float64(), min_res["value"].to_float64());
+        EXPECT_EQ(batched["min/index"].to_int32(), min_res["index"].to_int32());
+        EXPECT_NEAR(batched["sum/value"].to_float64(), sum_res["value"].to_float64(), 0.0001);
+        EXPECT_EQ(batched["sum/count"].to_int64(), sum_res["count"].to_int64());
+        EXPECT_EQ(batched["scalar"].to_int32(), 1);
+    }
+
+    // integer fields are summed in double, so large values do not
+    // overflow the field's type
+    Node &dom = dataset.child(0);
+    const index_t num_verts =
+      dom["fields/braid/values"].dtype().number_of_elements();
+    Node &n_ints = dom["fields/big_ints"];
+    n_ints["association"] = "vertex";
+    n_ints["topology"] = dom["fields/braid/topology"];
+    n_ints["values"].set(DataType::int32(num_verts));
+    int32_array ints = n_ints["values"].value();
+    ints.fill(2000000000);
+
+    fields.clear();
+    fields.push_back("big_ints");
+    Node int_res = runtime::expressions::field_reductions_batched(dataset, fields);
+    EXPECT_EQ(int_res["big_ints/sum/value"].to_float64(),
+              2000000000.0 * num_verts);
+    EXPECT_EQ(int_res["big_ints/max/value"].to_float64(), 2000000000.0);
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_blueprint_reductions, field_histogram_braid_cpu)
 {
@@ -15,11 +15,14 @@
 
 #include <ascent.hpp>
 
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <math.h>
 
 #include <conduit_blueprint.hpp>
 #include <conduit_relay.hpp>
+#include <runtimes/ascent_field_compression.hpp>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -188,6 +191,142 @@ TEST(ascent_conduit_extract, test_pipeline_result)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_conduit_extract, test_compression)
+{
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    data["state/domain_id"] = 0;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing conduit extract with field compression");
+
+    const float64 abs_error = 0.01;
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["e1/type"]  = "conduit";
+    extracts["e1/params/compression/braid/abs_error"] = abs_error;
+    extracts["e1/params/compression/radial/rel_error"] = 0.001;
+
+    //
+    // Run Ascent
+    //
+    Ascent ascent;
+    ascent.open();
+    ascent.publish(data);
+    ascent.execute(actions);
+    conduit::Node & info =  ascent.info();
+
+    conduit::Node extract_copy;
+    extract_copy.set(info["extracts"][0]);
+
+    ascent.close();
+
+    const Node &stats = extract_copy["compression"];
+    EXPECT_TRUE(stats.has_child("braid"));
+    EXPECT_TRUE(stats.has_child("radial"));
+    EXPECT_GT(stats["braid/ratio"].to_float64(), 1.0);
+    EXPECT_LE(stats["braid/max_error"].to_float64(), abs_error);
+
+    Node &dom = extract_copy["data"][0];
+    EXPECT_FALSE(dom["fields"].has_child("braid"));
+    EXPECT_TRUE(dom["compressed_fields"].has_child("braid"));
+    // fields without options are untouched
+    EXPECT_TRUE(dom["fields"].has_child("vel"));
+
+    ascent::runtime::decompress_fields(extract_copy["data"]);
+    EXPECT_FALSE(dom.has_child("compressed_fields"));
+
+    float64_array orig = data["fields/braid/values"].value();
+    float64_array res = dom["fields/braid/values"].value();
+    ASSERT_EQ(orig.number_of_elements(), res.number_of_elements());
+    for(index_t i = 0; i < orig.number_of_elements(); ++i)
+    {
+        EXPECT_LE(fabs(orig[i] - res[i]), abs_error);
+    }
+
+    Node diff_info;
+    EXPECT_FALSE(dom["fields/braid/association"].diff(data["fields/braid/association"],
+                                                      diff_info));
+
+    // bad bounds are rejected
+    actions.reset();
+    conduit::Node &bad_extracts = actions.append();
+    bad_extracts["action"] = "add_extracts";
+    bad_extracts["extracts/e1/type"]  = "conduit";
+    bad_extracts["extracts/e1/params/compression/braid/abs_error"] = -1.0;
+
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    EXPECT_THROW(ascent.execute(actions),conduit::Error);
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_conduit_extract, test_compression_bounds_and_types)
+{
+    // two domains with different value ranges
+    Node mesh;
+    for(int d = 0; d < 2; ++d)
+    {
+        Node &dom = mesh.append();
+        conduit::blueprint::mesh::examples::braid("hexs",
+                                                  EXAMPLE_MESH_SIDE_DIM,
+                                                  EXAMPLE_MESH_SIDE_DIM,
+                                                  EXAMPLE_MESH_SIDE_DIM,
+                                                  dom);
+        dom["state/domain_id"] = d;
+        float64_array vals = dom["fields/braid/values"].value();
+        for(index_t i = 0; i < vals.number_of_elements(); ++i)
+        {
+            vals[i] *= d + 1;
+        }
+    }
+
+    Node options, output, stats;
+    options["braid/rel_error"] = 0.001;
+    ascent::runtime::compress_fields(mesh, options, output, stats);
+
+    // the bound comes from the range over all domains
+    const float64 bound_0 = output[0]["compressed_fields/braid/values/error_bound"].to_float64();
+    const float64 bound_1 = output[1]["compressed_fields/braid/values/error_bound"].to_float64();
+    EXPECT_GT(bound_0, 0.0);
+    EXPECT_EQ(bound_0, bound_1);
+
+    // unpredictable values keep the type of the field
+    Node values, compressed, res;
+    values.set(DataType::float32(4));
+    float32 *vals = values.as_float32_ptr();
+    vals[0] = 1.0f;
+    vals[1] = std::numeric_limits<float32>::quiet_NaN();
+    vals[2] = 1.0e30f;
+    vals[3] = 1.5f;
+    ascent::runtime::compress_values(values, 0.01, compressed);
+    EXPECT_TRUE(compressed["unpredictable"].dtype().is_float32());
+
+    ascent::runtime::decompress_values(compressed, res);
+    ASSERT_TRUE(res.dtype().is_float32());
+    const float32 *res_vals = res.as_float32_ptr();
+    EXPECT_TRUE(std::isnan(res_vals[1]));
+    EXPECT_EQ(res_vals[2], vals[2]);
+    EXPECT_LE(fabs(res_vals[3] - vals[3]), 0.01);
+}
+
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -14,9 +14,11 @@
 
 #include <ascent_expression_eval.hpp>
 #include <expressions/ascent_blueprint_architect.hpp>
+#include <expressions/ascent_session_log.hpp>
 #include <runtimes/expressions/ascent_memory_manager.hpp>
 
 #include <cmath>
+#include <fstream>
 #include <iostream>
 
 #include <conduit_blueprint.hpp>
@@ -1232,6 +1234,220 @@ TEST(ascent_expressions, lineout)
   res = eval.evaluate(expr);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, test_plan_cache)
+{
+  Node n;
+  ascent::about(n);
+  // only run this test if ascent was built with vtkm support
+  if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+  {
+    ASCENT_INFO("Ascent support disabled, skipping test");
+    return;
+  }
+
+  //
+  // Create an example mesh.
+  //
+  Node data, verify_info;
+  conduit::blueprint::mesh::examples::braid("hexs",
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            data);
+  // ascent normally adds this but we are doing an end around
+  data["state/domain_id"] = 0;
+  Node multi_dom;
+  blueprint::mesh::to_multi_domain(data, multi_dom);
+
+  runtime::expressions::register_builtin();
+  runtime::expressions::ExpressionEval::reset_plans();
+
+  // the same expression is compiled once, but must see new data
+  const std::string expr = "max(field('braid'))";
+  conduit::Node res;
+  double expected = 0.0;
+  for(int cycle = 0; cycle < 3; ++cycle)
+  {
+    multi_dom.child(0)["state/cycle"] = cycle;
+    float64_array braid = multi_dom.child(0)["fields/braid/values"].value();
+    const index_t num_vals = braid.number_of_elements();
+    for(index_t i = 0; i < num_vals; ++i)
+    {
+      braid[i] = (cycle + 1) * (i % 5);
+    }
+    expected = (cycle + 1) * 4.0;
+
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+    res = eval.evaluate(expr, "plan_max_braid");
+    EXPECT_EQ(res["value"].to_float64(), expected);
+  }
+
+  // a schema change builds a new plan
+  multi_dom.child(0)["fields/braid_copy"].set(multi_dom.child(0)["fields/braid"]);
+  runtime::expressions::ExpressionEval eval(&multi_dom);
+  res = eval.evaluate("max(field('braid_copy'))");
+  EXPECT_EQ(res["value"].to_float64(), expected);
+  res = eval.evaluate(expr, "plan_max_braid");
+  EXPECT_EQ(res["value"].to_float64(), expected);
+
+  // so does a change of the type of a cached identifier
+  eval.evaluate("1", "plan_ident");
+  res = eval.evaluate("plan_ident + 1", "plan_ident_plus");
+  EXPECT_EQ(res["type"].as_string(), "int");
+  conduit::Node ident;
+  ident["value"] = 1.5;
+  ident["type"] = "double";
+  runtime::expressions::ExpressionEval::record("plan_ident", 3, ident);
+  res = eval.evaluate("plan_ident + 1", "plan_ident_plus");
+  EXPECT_EQ(res["type"].as_string(), "double");
+  EXPECT_EQ(res["value"].to_float64(), 2.5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, test_history_length)
+{
+  Node n;
+  ascent::about(n);
+
+  //
+  // Create an example mesh.
+  //
+  Node data, verify_info;
+  conduit::blueprint::mesh::examples::braid("hexs",
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            data);
+  // ascent normally adds this but we are doing an end around
+  data["state/domain_id"] = 0;
+  Node multi_dom;
+  blueprint::mesh::to_multi_domain(data, multi_dom);
+
+  runtime::expressions::register_builtin();
+  runtime::expressions::ExpressionEval::reset_cache();
+  runtime::expressions::ExpressionEval::history_length(3);
+
+  conduit::Node res;
+  for(int cycle = 1; cycle <= 10; ++cycle)
+  {
+    multi_dom.child(0)["state/cycle"] = cycle * 100;
+    multi_dom.child(0)["state/time"] = (double) cycle;
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+    res = eval.evaluate(std::to_string(cycle) + ".0", "val");
+  }
+
+  // only the newest three are kept
+  conduit::Node cache;
+  runtime::expressions::ExpressionEval::get_cache(cache);
+  EXPECT_EQ(cache["val"].number_of_children(), 3);
+  EXPECT_EQ(cache["val"].child(0).name(), "800");
+
+  runtime::expressions::ExpressionEval eval(&multi_dom);
+  res = eval.evaluate("history(val, absolute_index=0)");
+  EXPECT_EQ(res["value"].to_float64(), 8.0);
+  res = eval.evaluate("history(val, 1)");
+  EXPECT_EQ(res["value"].to_float64(), 9.0);
+
+  conduit::float64_array result;
+  for(const string &expression : {
+      "history_range(val, first_absolute_index=0, last_absolute_index=2)",
+      "history_range(val, first_relative_index=0, last_relative_index=5)",
+      "history_range(val, first_absolute_time=8.0, last_absolute_time=10.0)",
+      "history_range(val, first_absolute_cycle=800, last_absolute_cycle=1000)",
+    }) {
+    res = eval.evaluate(expression);
+    EXPECT_EQ(res["type"].as_string(), "array");
+    result = res["value"].as_float64_array();
+    EXPECT_EQ(result.to_json(), "[8.0, 9.0, 10.0]");
+  }
+
+  res = eval.evaluate("history_gradient(val, window_length=2)");
+  EXPECT_EQ(res["value"].to_float64(), 1.0);
+
+  runtime::expressions::ExpressionEval::history_length(0);
+  runtime::expressions::ExpressionEval::reset_cache();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, test_session_log)
+{
+  using runtime::expressions::ExpressionHistories;
+  using runtime::expressions::SessionLog;
+
+  string output_path = prepare_output_dir();
+  string session =
+    conduit::utils::join_file_path(output_path, "tout_session_log");
+  for(const string &file : {SessionLog::log_file(session),
+                            SessionLog::index_file(session),
+                            session + ".yaml"})
+  {
+    if(conduit::utils::is_file(file))
+    {
+      conduit::utils::remove_file(file);
+    }
+  }
+
+  auto log_bytes = [&session]()
+  {
+    std::ifstream in(SessionLog::log_file(session),
+                     std::ios::binary | std::ios::ate);
+    return (conduit::uint64) in.tellg();
+  };
+
+  ExpressionHistories histories;
+  SessionLog log(session);
+  conduit::Node info;
+  info["last_known_time"] = 3.0;
+
+  conduit::Node res;
+  for(int cycle = 1; cycle <= 2; ++cycle)
+  {
+    res["value"] = (double) cycle;
+    res["type"] = "double";
+    histories.record("val", cycle, res);
+  }
+  log.append(histories, std::vector<string>(), info);
+  const conduit::uint64 first_size = log_bytes();
+
+  // the second save only appends the new and replaced results
+  res["value"] = 20.0;
+  histories.record("val", 2, res);
+  res["value"] = 3.0;
+  histories.record("val", 3, res);
+  res["value"] = "bananas";
+  res["type"] = "string";
+  histories.record("name", 3, res);
+  log.append(histories, std::vector<string>(), info);
+
+  conduit::Node index;
+  index.load(SessionLog::index_file(session), "json");
+  EXPECT_EQ(index["entries"].to_int64(), 5);
+  EXPECT_EQ(index["expressions/val/last_cycle"].to_int64(), 3);
+  EXPECT_EQ(index["committed_bytes"].to_uint64(), log_bytes());
+  EXPECT_TRUE(first_size < index["committed_bytes"].to_uint64());
+
+  ExpressionHistories loaded;
+  conduit::Node loaded_info;
+  SessionLog reader(session);
+  EXPECT_TRUE(reader.load(loaded, loaded_info));
+  EXPECT_EQ(loaded_info["last_known_time"].to_float64(), 3.0);
+
+  conduit::Node expected, actual;
+  histories.to_node(expected);
+  loaded.to_node(actual);
+  conduit::Node diff_info;
+  EXPECT_FALSE(expected.diff(actual, diff_info));
+  EXPECT_EQ(loaded.find("val")->value(1), 20.0);
+
+  // and back to yaml for humans
+  EXPECT_TRUE(SessionLog::to_yaml(session, session + ".yaml"));
+  conduit::Node yaml;
+  yaml.load(session + ".yaml", "yaml");
+  EXPECT_EQ(yaml["name/3/value"].as_string(), "bananas");
+  EXPECT_EQ(yaml["last_known_time"].to_float64(), 3.0);
+}
+
 //-----------------------------------------------------------------------------
 int
 main(int argc, char *argv[])
@@ -101,5 +101,57 @@ TEST(ascent_info, info_save)
     ASCENT_ACTIONS_DUMP(actions,output_file,msg);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_info, info_lazy)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("quads",
+                                               20,
+                                               20,
+                                               0,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
 
+    // setup actions
+    Node actions;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "max(field('braid'))";
+    add_queries["queries/q1/params/name"] = "max_braid";
+
+    //
+    // Run Ascent
+    //
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["lazy_info"] = "true";
+    ascent.open(ascent_opts);
+
+    // the graph details are still built, just on request
+    for(int cycle = 0; cycle < 2; ++cycle)
+    {
+        data["state/cycle"] = 100 + cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+
+        Node ascent_info;
+        ascent.info(ascent_info);
+
+        EXPECT_TRUE(ascent_info.has_path("runtime/version"));
+        EXPECT_TRUE(ascent_info.has_path("runtime/options/lazy_info"));
+        EXPECT_TRUE(ascent_info.has_path("registered_filter_types"));
+        EXPECT_TRUE(ascent_info.has_path("flow_graph"));
+        EXPECT_TRUE(ascent_info.has_path("flow_graph_dot"));
+        EXPECT_TRUE(ascent_info.has_path("flow_graph_dot_html"));
+        EXPECT_TRUE(ascent_info.has_path("expressions/max_braid"));
+        EXPECT_EQ(ascent_info["actions"].number_of_children(),
+                  actions.number_of_children());
+    }
+
+    ascent.close();
+}
 
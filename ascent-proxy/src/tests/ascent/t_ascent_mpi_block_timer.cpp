@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_mpi_block_timer.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <ascent_block_timer.hpp>
+
+#include <mpi.h>
+
+#include <iostream>
+#include <thread>
+
+#include "t_config.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+void
+timed_outer_inner(int num_outer, int num_inner)
+{
+    for(int i = 0; i < num_outer; ++i)
+    {
+        ASCENT_BLOCK_TIMER(t_mpi_outer);
+        for(int j = 0; j < num_inner; ++j)
+        {
+            ASCENT_BLOCK_TIMER(t_mpi_inner);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_block_timer, finalize_gather)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    // two threads per rank
+    std::thread t0(timed_outer_inner, 2, 3);
+    std::thread t1(timed_outer_inner, 2, 3);
+    t0.join();
+    t1.join();
+
+    for(int i = 0; i < 2; ++i)
+    {
+        ASCENT_BLOCK_TIMER_BARRIER(t_mpi_barrier);
+    }
+
+    Node &res = BlockTimer::Finalize();
+
+    if(par_rank != 0)
+    {
+        // only rank 0 holds the reduced result
+        EXPECT_FALSE(res.has_path("children"));
+        return;
+    }
+
+    // counts are averaged over the ranks
+    const Node &outer = res["children/t_mpi_outer"];
+    EXPECT_EQ(outer["count"].to_uint32(), 4);
+    EXPECT_TRUE(outer["value"].to_float64() >= 0.0);
+    EXPECT_TRUE(outer["min"].to_float64() <= outer["value"].to_float64());
+    EXPECT_EQ(outer["children/t_mpi_inner/count"].to_uint32(), 12);
+
+    EXPECT_EQ(res["children/t_mpi_barrier/count"].to_uint32(), 2);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
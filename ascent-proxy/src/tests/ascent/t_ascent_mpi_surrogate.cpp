@@ -0,0 +1,193 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_mpi_surrogate.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <iostream>
+#include <math.h>
+
+#include <mpi.h>
+
+#include <conduit_blueprint.hpp>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_surrogate, test_distributed_weights_match)
+{
+    //
+    // Set Up MPI
+    //
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    ASCENT_INFO("Rank "
+                  << par_rank
+                  << " of "
+                  << par_size
+                  << " reporting");
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,8,par_rank,par_size);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    //
+    // Create the actions.
+    //
+    // rank_ele holds the rank id, so every rank sees a different
+    // local series and would learn different weights on its own
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s1/type"]  = "surrogate";
+    extracts["s1/params/field"] = "rank_ele";
+    extracts["s1/params/reduction"] = "max";
+    extracts["s1/params/distributed"] = "true";
+    extracts["s1/params/lags"] = 2;
+    extracts["s1/params/learning_rate"] = 0.001;
+
+    //
+    // Run Ascent
+    //
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    float64_array rank_vals = data["fields/rank_ele/values"].value();
+    for(int cycle = 0; cycle < 6; ++cycle)
+    {
+        for(index_t i = 0; i < rank_vals.number_of_elements(); ++i)
+        {
+            rank_vals[i] = par_rank + cycle;
+        }
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    conduit::Node info;
+    ascent.info(info);
+    const conduit::Node &res = info["extracts"][0];
+    EXPECT_EQ(res["model/num_updates"].to_int32(), 4);
+
+    // the weights must be identical on every rank
+    float64_array weights = res["model/weights"].value();
+    const int size = (int) weights.number_of_elements();
+    EXPECT_EQ(size, 3);
+    std::vector<double> w_min(size), w_max(size);
+    for(int i = 0; i < size; ++i)
+    {
+        w_min[i] = weights[i];
+        w_max[i] = weights[i];
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &w_min[0], size, MPI_DOUBLE, MPI_MIN, comm);
+    MPI_Allreduce(MPI_IN_PLACE, &w_max[0], size, MPI_DOUBLE, MPI_MAX, comm);
+    for(int i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(w_min[i], w_max[i]);
+    }
+
+    // but each rank keeps its own window
+    float64_array window = res["model/window"].value();
+    EXPECT_EQ(window[1], par_rank + 5.0);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_surrogate, test_distributed_pod)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node data, verify_info;
+    create_3d_example_dataset(data,8,par_rank,par_size);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // every rank holds a different piece of one global snapshot that
+    // only changes in scale, so the global basis has a single mode
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["rom/type"]  = "pod";
+    extracts["rom/params/fields"].append() = "rank_ele";
+    extracts["rom/params/rank"] = 3;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    float64_array rank_vals = data["fields/rank_ele/values"].value();
+    for(int cycle = 0; cycle < 4; ++cycle)
+    {
+        for(index_t i = 0; i < rank_vals.number_of_elements(); ++i)
+        {
+            rank_vals[i] = (1.0 + cycle) * (par_rank + 1.0);
+        }
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    conduit::Node info;
+    ascent.info(info);
+    const conduit::Node &res = info["extracts"][0];
+    EXPECT_EQ(res["rank"].to_int32(), 1);
+
+    // the singular values and coefficients are global
+    double values[2];
+    values[0] = res["singular_values"].as_float64_ptr()[0];
+    values[1] = res["coefficients"].as_float64_ptr()[0];
+    double v_min[2] = {values[0], values[1]};
+    double v_max[2] = {values[0], values[1]};
+    MPI_Allreduce(MPI_IN_PLACE, v_min, 2, MPI_DOUBLE, MPI_MIN, comm);
+    MPI_Allreduce(MPI_IN_PLACE, v_max, 2, MPI_DOUBLE, MPI_MAX, comm);
+    EXPECT_EQ(v_min[0], v_max[0]);
+    EXPECT_EQ(v_min[1], v_max[1]);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -74,6 +74,42 @@ TEST(ascent_runtime, test_python_script_extract)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_runtime, test_python_script_extract_async)
+{
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,0,1);
+    data["state/cycle"] = 101;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts/e1/type"]  = "python";
+    add_extracts["extracts/e1/params/source"] = py_script;
+
+    //
+    // Run Ascent
+    //
+
+    Node ascent_opts;
+    ascent_opts["async/enabled"] = "true";
+    ascent_opts["exceptions"] = "forward";
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    // the background thread can't run python, the error is
+    // reported by wait
+    EXPECT_THROW(ascent.wait(),conduit::Error);
+    ascent.close();
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_runtime, test_python_script_extract_from_file)
 {
@@ -314,3 +350,248 @@ TEST(ascent_runtime, test_python_extract_inception)
 
 }
 
+
+// uses the persistent state store to count how many times it has run
+std::string py_script_state = "\n"
+"import numpy as np\n"
+"s = ascent_state()\n"
+"if not s.has_path('count'):\n"
+"    s['count'] = np.zeros(1,dtype=np.float64)\n"
+"# fetching a leaf returns a numpy view of the state's memory\n"
+"c = s['count']\n"
+"c[0] += 1.0\n"
+"\n";
+
+//-----------------------------------------------------------------------------
+TEST(ascent_runtime, test_python_extract_state)
+{
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,0,1);
+    data["state/cycle"] = 101;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string state_prefix = conduit::utils::join_file_path(output_path,
+                                                         "tout_python_extract_state");
+    string state_file = state_prefix + ".conduit_bin";
+    // remove old file
+    if(conduit::utils::is_file(state_file))
+    {
+        conduit::utils::remove_file(state_file);
+    }
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "python";
+    extracts["e1/params/source"] = py_script_state;
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    actions.print();
+
+    //
+    // Run Ascent
+    //
+
+    Node ascent_opts;
+    ascent_opts["ascent_info"] = "verbose";
+    ascent_opts["exceptions"] = "forward";
+    ascent_opts["state/checkpoint"] = "true";
+    ascent_opts["state/path"] = state_prefix;
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    for(int i = 0; i < 3; ++i)
+    {
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    // state is written on close
+    EXPECT_TRUE(conduit::utils::is_file(state_file));
+    Node state;
+    state.load(state_file,"conduit_bin");
+    state.print();
+    EXPECT_EQ(state["e1/count"].as_float64_ptr()[0], 3.0);
+}
+
+//-----------------------------------------------------------------------------
+std::string py_script_entry_point = "\n"
+"import numpy as np\n"
+"# the script body only runs once, later cycles just call the entry point\n"
+"s = ascent_state()\n"
+"s['setup'] = np.ones(1,dtype=np.float64)\n"
+"s['count'] = np.zeros(1,dtype=np.float64)\n"
+"\n"
+"def entry_point_update():\n"
+"    c = ascent_state()['count']\n"
+"    c[0] += 1.0\n"
+"\n";
+
+//-----------------------------------------------------------------------------
+TEST(ascent_runtime, test_python_extract_entry_point)
+{
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,0,1);
+    data["state/cycle"] = 101;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string state_prefix = conduit::utils::join_file_path(output_path,
+                                                         "tout_python_extract_entry_point");
+    string state_file = state_prefix + ".conduit_bin";
+    // remove old file
+    if(conduit::utils::is_file(state_file))
+    {
+        conduit::utils::remove_file(state_file);
+    }
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "python";
+    extracts["e1/params/source"] = py_script_entry_point;
+    extracts["e1/params/entry_point"] = "entry_point_update";
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    actions.print();
+
+    //
+    // Run Ascent
+    //
+
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent_opts["state/checkpoint"] = "true";
+    ascent_opts["state/path"] = state_prefix;
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    for(int i = 0; i < 3; ++i)
+    {
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    EXPECT_TRUE(conduit::utils::is_file(state_file));
+    Node state;
+    state.load(state_file,"conduit_bin");
+    state.print();
+    // body ran once, entry point ran every cycle
+    EXPECT_EQ(state["e1/setup"].as_float64_ptr()[0], 1.0);
+    EXPECT_EQ(state["e1/count"].as_float64_ptr()[0], 3.0);
+}
+
+//-----------------------------------------------------------------------------
+// same entry point name, different updates
+std::string py_script_shared_entry_point(const std::string &step)
+{
+    return "\n"
+           "import numpy as np\n"
+           "s = ascent_state()\n"
+           "if not s.has_path('body'):\n"
+           "    s['body'] = np.zeros(1,dtype=np.float64)\n"
+           "    s['count'] = np.zeros(1,dtype=np.float64)\n"
+           "s['body'][0] += 1.0\n"
+           "\n"
+           "def update():\n"
+           "    c = ascent_state()['count']\n"
+           "    c[0] += " + step + "\n"
+           "\n"
+           "if __name__ == '__main__':\n"
+           "    update()\n"
+           "\n";
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_runtime, test_python_extract_shared_entry_point)
+{
+    //
+    // Create the data.
+    //
+    Node data, verify_info;
+    create_3d_example_dataset(data,32,0,1);
+    data["state/cycle"] = 101;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string state_prefix = conduit::utils::join_file_path(output_path,
+                                                         "tout_python_extract_shared_entry_point");
+    string state_file = state_prefix + ".conduit_bin";
+    // remove old file
+    if(conduit::utils::is_file(state_file))
+    {
+        conduit::utils::remove_file(state_file);
+    }
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "python";
+    extracts["e1/params/source"] = py_script_shared_entry_point("1.0");
+    extracts["e1/params/entry_point"] = "update";
+    extracts["e2/type"]  = "python";
+    extracts["e2/params/source"] = py_script_shared_entry_point("10.0");
+    extracts["e2/params/entry_point"] = "update";
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    //
+    // Run Ascent
+    //
+
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent_opts["state/checkpoint"] = "true";
+    ascent_opts["state/path"] = state_prefix;
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    for(int i = 0; i < 3; ++i)
+    {
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    EXPECT_TRUE(conduit::utils::is_file(state_file));
+    Node state;
+    state.load(state_file,"conduit_bin");
+    // each body ran once, without its main guarded call, and
+    // each extract called its own entry point every cycle
+    EXPECT_EQ(state["e1/body"].as_float64_ptr()[0], 1.0);
+    EXPECT_EQ(state["e1/count"].as_float64_ptr()[0], 3.0);
+    EXPECT_EQ(state["e2/body"].as_float64_ptr()[0], 1.0);
+    EXPECT_EQ(state["e2/count"].as_float64_ptr()[0], 30.0);
+}
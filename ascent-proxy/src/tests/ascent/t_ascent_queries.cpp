@@ -13,6 +13,7 @@
 
 #include <ascent.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <math.h>
 
@@ -97,6 +98,87 @@ TEST(ascent_queries, max_query)
     ASCENT_ACTIONS_DUMP(actions,output_file,msg);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_queries, batched_queries)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    float64_array braid = data["fields/braid/values"].value();
+    float64 braid_max = braid[0];
+    float64 braid_min = braid[0];
+    for(index_t i = 1; i < braid.number_of_elements(); ++i)
+    {
+        braid_max = std::max(braid_max, braid[i]);
+        braid_min = std::min(braid_min, braid[i]);
+    }
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+
+    // several whole field reductions on the published data are batched
+    conduit::Node queries;
+    queries["q1/params/expression"] = "max(field('braid'))";
+    queries["q1/params/name"] = "batched_max";
+    queries["q2/params/expression"] = "min(field('braid'))";
+    queries["q2/params/name"] = "batched_min";
+    queries["q3/params/expression"] =
+        "max(field('braid')).value - min(field('braid')).value";
+    queries["q3/params/name"] = "batched_range";
+    // reduces nothing, so it is not served by the batch
+    queries["q4/params/expression"] = "cycle()";
+    queries["q4/params/name"] = "batched_cycle";
+
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries"] = queries;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    conduit::Node info;
+    ascent.info(info);
+
+    // the batch was planned from the parsed expressions
+    const Node &batch = info["flow_graph/graph/filters/ascent_query_batch"];
+    EXPECT_EQ(batch["type_name"].as_string(), "query_batch");
+    EXPECT_EQ(batch["params/fields"].number_of_children(), 1);
+    EXPECT_EQ(batch["params/fields"].child(0).as_string(), "braid");
+    EXPECT_EQ(batch["params/queries"].number_of_children(), 3);
+    EXPECT_EQ(batch["params/queries"].child(0).as_string(), "q1");
+    EXPECT_EQ(batch["params/queries"].child(1).as_string(), "q2");
+    EXPECT_EQ(batch["params/queries"].child(2).as_string(), "q3");
+
+    EXPECT_NEAR(info["expressions/batched_max/100/attrs/value/value"].to_float64(),
+                braid_max, 1e-12);
+    EXPECT_NEAR(info["expressions/batched_min/100/attrs/value/value"].to_float64(),
+                braid_min, 1e-12);
+    EXPECT_NEAR(info["expressions/batched_range/100/value"].to_float64(),
+                braid_max - braid_min, 1e-12);
+    EXPECT_EQ(info["expressions/batched_cycle/100/value"].to_int32(), 100);
+
+    ascent.close();
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_queries, max_query_pipeline)
 {
@@ -381,7 +463,7 @@ TEST(ascent_queries, save_session)
     string output_file =
       conduit::utils::join_file_path(output_path,"tout_save_session");
 
-    string session_file = "ascent_session.yaml";
+    string session_file = "ascent_session.session_log";
     // remove old file
     if(conduit::utils::is_file(output_file))
     {
@@ -15,12 +15,17 @@
 
 #include <ascent.hpp>
 
+#include <iomanip>
 #include <iostream>
 #include <math.h>
+#include <sstream>
+#include <vector>
 
 #include <conduit_blueprint.hpp>
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_blueprint.hpp>
 #include "conduit_fmt/conduit_fmt.h"
+#include <runtimes/ascent_field_compression.hpp>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -439,6 +444,159 @@ TEST(ascent_relay, test_relay_yaml)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_relay, test_relay_async)
+{
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing async relay extract in serial (yaml)");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_relay_async_extract");
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "relay";
+    extracts["e1/params/path"] = output_file;
+    extracts["e1/params/protocol"] = "blueprint/mesh/yaml";
+    extracts["e1/params/async"] = "true";
+    extracts["e1/params/async_buffers"] = 1;
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    //
+    // Run Ascent for a few cycles
+    //
+
+    std::vector<std::string> output_roots;
+    Ascent ascent;
+    ascent.open();
+    for(int cycle = 100; cycle < 103; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        std::ostringstream oss;
+        oss << output_file << ".cycle_" << std::setfill('0')
+            << std::setw(6) << cycle << ".root";
+        output_roots.push_back(oss.str());
+        remove_test_file(output_roots.back());
+
+        // the simulation changes the data once execute returns
+        float64_array braid = data["fields/braid/values"].value();
+        braid[0] = cycle;
+
+        ascent.publish(data);
+        ascent.execute(actions);
+
+        conduit::Node info;
+        ascent.info(info);
+        EXPECT_EQ(info["extracts"].child(0)["async"].as_string(), "true");
+        // the root file is reported before it is written
+        EXPECT_EQ(info["extracts"].child(0)["path"].as_string(),
+                  output_roots.back());
+    }
+    // close writes what is still queued
+    ascent.close();
+
+    for(size_t i = 0; i < output_roots.size(); ++i)
+    {
+        EXPECT_TRUE(conduit::utils::is_file(output_roots[i]));
+    }
+
+    // each file has the values of the cycle that wrote it
+    conduit::Node saved;
+    conduit::relay::io::blueprint::load_mesh(output_roots[1], saved);
+    conduit::Node saved_braid;
+    saved.child(0)["fields/braid/values"].to_float64_array(saved_braid);
+    EXPECT_EQ(saved_braid.as_float64_ptr()[0], 101.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_relay, test_relay_compression)
+{
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing relay extract with field compression");
+
+    const float64 abs_error = 0.01;
+    string output_path = prepare_output_dir();
+
+    // the staged copy of an async save must keep the compressed fields
+    for(const std::string async : {"false", "true"})
+    {
+        string output_file =
+          conduit::utils::join_file_path(output_path,
+                                         "tout_relay_compression_async_" + async);
+        string output_root = output_file + ".cycle_000100.root";
+        remove_test_file(output_root);
+
+        conduit::Node extracts;
+        extracts["e1/type"]  = "relay";
+        extracts["e1/params/path"] = output_file;
+        extracts["e1/params/protocol"] = "blueprint/mesh/hdf5";
+        extracts["e1/params/async"] = async;
+        extracts["e1/params/compression/braid/abs_error"] = abs_error;
+
+        conduit::Node actions;
+        conduit::Node &add_extracts = actions.append();
+        add_extracts["action"] = "add_extracts";
+        add_extracts["extracts"] = extracts;
+
+        Ascent ascent;
+        ascent.open();
+        ascent.publish(data);
+        ascent.execute(actions);
+
+        conduit::Node info;
+        ascent.info(info);
+        const Node &stats = info["extracts"].child(0)["compression"];
+        EXPECT_GT(stats["braid/ratio"].to_float64(), 1.0);
+        EXPECT_LE(stats["braid/max_error"].to_float64(), abs_error);
+        // close writes what is still queued
+        ascent.close();
+
+        EXPECT_TRUE(conduit::utils::is_file(output_root));
+
+        conduit::Node saved;
+        conduit::relay::io::blueprint::load_mesh(output_root, saved);
+        EXPECT_FALSE(saved.child(0)["fields"].has_child("braid"));
+        ascent::runtime::decompress_fields(saved);
+        EXPECT_FALSE(saved.child(0).has_child("compressed_fields"));
+
+        float64_array orig = data["fields/braid/values"].value();
+        conduit::Node res_values;
+        saved.child(0)["fields/braid/values"].to_float64_array(res_values);
+        float64_array res = res_values.value();
+        ASSERT_EQ(orig.number_of_elements(), res.number_of_elements());
+        for(index_t i = 0; i < orig.number_of_elements(); ++i)
+        {
+            EXPECT_LE(fabs(orig[i] - res[i]), abs_error);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_relay, test_relay_yaml_2)
 {
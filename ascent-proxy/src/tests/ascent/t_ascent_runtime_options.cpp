@@ -1229,3 +1229,65 @@ TEST(ascent_runtime_options, test_field_filtering_new)
     ascent.close();
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_runtime_options, test_async)
+{
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("quads",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              0,
+                                              data);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing async execute");
+
+    conduit::Node actions;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "max(field('braid'))";
+    add_queries["queries/q1/params/name"] = "max_braid";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["async/enabled"] = "true";
+    ascent_opts["async/queue_depth"] = 2;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    float64_array braid = data["fields/braid/values"].value();
+    const index_t num_vals = braid.number_of_elements();
+    float64 expected = 0.0;
+    const int num_cycles = 4;
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        for(index_t i = 0; i < num_vals; ++i)
+        {
+            braid[i] = (cycle + 1) * (i % 7);
+        }
+        expected = (cycle + 1) * 6.0;
+        data["state/cycle"] = 100 + cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+        // the simulation moves on, this must not be seen by ascent
+        for(index_t i = 0; i < num_vals; ++i)
+        {
+            braid[i] = 1e6;
+        }
+    }
+    ascent.wait();
+
+    Node info;
+    ascent.info(info);
+    std::string path = "expressions/max_braid/" +
+                       std::to_string(100 + num_cycles - 1) + "/value";
+    EXPECT_TRUE(info.has_path(path));
+    EXPECT_EQ(info[path].to_float64(), expected);
+
+    ascent.close();
+}
@@ -0,0 +1,748 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_surrogate.cpp
+///
+//-----------------------------------------------------------------------------
+
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <math.h>
+#include <cmath>
+
+#include <conduit_blueprint.hpp>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+
+index_t EXAMPLE_MESH_SIDE_DIM = 10;
+
+//-----------------------------------------------------------------------------
+void
+fill_braid(Node &data, double value)
+{
+    float64_array vals = data["fields/braid/values"].value();
+    for(index_t i = 0; i < vals.number_of_elements(); ++i)
+    {
+        vals[i] = value;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_constant_series)
+{
+    Node n;
+    ascent::about(n);
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing surrogate extract on a constant series");
+
+    // max(braid) will be 1 every cycle
+    fill_braid(data, 1.0);
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s1/type"]  = "surrogate";
+    extracts["s1/params/expression"] = "max(field('braid'))";
+    extracts["s1/params/lags"] = 4;
+    extracts["s1/params/learning_rate"] = 0.01;
+    extracts["s1/params/epochs"] = 100;
+
+    std::cout << actions.to_yaml() << std::endl;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    conduit::Node info;
+    const int num_cycles = 8;
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.info(info);
+
+        EXPECT_TRUE(info.has_path("extracts"));
+        const conduit::Node &res = info["extracts"][0];
+        EXPECT_EQ(res["type"].as_string(), "surrogate");
+        EXPECT_EQ(res["name"].as_string(), "s1");
+        EXPECT_EQ(res["cycle"].to_int32(), cycle);
+        EXPECT_NEAR(res["value"].to_float64(), 1.0, 1e-12);
+        EXPECT_EQ(res["model/num_observations"].to_int32(), cycle + 1);
+        // the first `lags` cycles only fill the window
+        EXPECT_EQ(res["model/num_updates"].to_int32(),
+                  cycle < 4 ? 0 : cycle - 3);
+    }
+
+    const conduit::Node &res = info["extracts"][0];
+    res.print();
+    EXPECT_EQ(res["model/weights"].dtype().number_of_elements(), 5);
+    EXPECT_EQ(res["model/window"].dtype().number_of_elements(), 4);
+    EXPECT_NEAR(res["prediction"].to_float64(), 1.0, 1e-3);
+    EXPECT_LT(res["loss"].to_float64(), 1e-3);
+
+    // executing again on the same cycle should not feed the model
+    ascent.execute(actions);
+    ascent.info(info);
+    EXPECT_EQ(info["extracts"][0]["model/num_observations"].to_int32(),
+              num_cycles);
+    EXPECT_FALSE(info["extracts"][0].has_child("value"));
+
+    ascent.close();
+
+    std::string msg = "An example of training an online surrogate model "
+                      "of a scalar expression.";
+    ASCENT_ACTIONS_DUMP(actions,std::string("surrogate"),msg);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_train_cycles)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s2/type"]  = "surrogate";
+    extracts["s2/params/expression"] = "max(field('braid'))";
+    extracts["s2/params/lags"] = 2;
+    extracts["s2/params/train_cycles"] = 1;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    conduit::Node info;
+    for(int cycle = 0; cycle < 6; ++cycle)
+    {
+        fill_braid(data, 1.0 + cycle);
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.info(info);
+
+    const conduit::Node &res = info["extracts"][0];
+    EXPECT_EQ(res["model/num_observations"].to_int32(), 6);
+    EXPECT_EQ(res["model/num_updates"].to_int32(), 1);
+    // window holds the last two observations, oldest first
+    float64_array window = res["model/window"].value();
+    EXPECT_NEAR(window[0], 5.0, 1e-12);
+    EXPECT_NEAR(window[1], 6.0, 1e-12);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_bad_params)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s3/type"]  = "surrogate";
+    extracts["s3/params/expression"] = "max(field('braid'))";
+    extracts["s3/params/lags"] = 0;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    EXPECT_THROW(ascent.execute(actions),conduit::Error);
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_state_restore)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string state_prefix = conduit::utils::join_file_path(output_path,
+                                                         "tout_surrogate_state");
+    string state_file = state_prefix + ".conduit_bin";
+    // remove old file
+    if(conduit::utils::is_file(state_file))
+    {
+        conduit::utils::remove_file(state_file);
+    }
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s4/type"]  = "surrogate";
+    extracts["s4/params/expression"] = "max(field('braid'))";
+    extracts["s4/params/lags"] = 2;
+
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent_opts["state/checkpoint"] = "true";
+    ascent_opts["state/path"] = state_prefix;
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    for(int cycle = 0; cycle < 4; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    EXPECT_TRUE(conduit::utils::is_file(state_file));
+
+    // pick up where we left off
+    ascent_opts["state/restore"] = "true";
+    ascent.open(ascent_opts);
+    data["state/cycle"] = 4;
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    conduit::Node info;
+    ascent.info(info);
+    const conduit::Node &res = info["extracts"][0];
+    EXPECT_EQ(res["model/num_observations"].to_int32(), 5);
+    EXPECT_EQ(res["model/num_updates"].to_int32(), 3);
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_distributed_matches_serial)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // with a single rank the data parallel update is the serial update
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["serial/type"]  = "surrogate";
+    extracts["serial/params/expression"] = "max(field('braid'))";
+    extracts["serial/params/lags"] = 2;
+    extracts["serial/params/learning_rate"] = 0.001;
+    extracts["dist/type"]  = "surrogate";
+    extracts["dist/params/field"] = "braid";
+    extracts["dist/params/reduction"] = "max";
+    extracts["dist/params/distributed"] = "true";
+    extracts["dist/params/lags"] = 2;
+    extracts["dist/params/learning_rate"] = 0.001;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    for(int cycle = 0; cycle < 6; ++cycle)
+    {
+        fill_braid(data, 1.0 + 0.5 * cycle);
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    conduit::Node info;
+    ascent.info(info);
+    info["extracts"].print();
+    EXPECT_EQ(info["extracts"].number_of_children(), 2);
+    const conduit::Node &res0 = info["extracts"][0];
+    const conduit::Node &res1 = info["extracts"][1];
+    EXPECT_EQ(res0["model/num_updates"].to_int32(),
+              res1["model/num_updates"].to_int32());
+    float64_array w0 = res0["model/weights"].value();
+    float64_array w1 = res1["model/weights"].value();
+    for(index_t i = 0; i < w0.number_of_elements(); ++i)
+    {
+        EXPECT_NEAR(w0[i], w1[i], 1e-10);
+    }
+    EXPECT_NEAR(res0["prediction"].to_float64(),
+                res1["prediction"].to_float64(),
+                1e-10);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_features)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // reference values for the fused statistics
+    float64_array vals = data["fields/braid/values"].value();
+    const index_t count = vals.number_of_elements();
+    double v_max = vals[0];
+    double v_min = vals[0];
+    double v_sum = 0.0;
+    double v_sum_sq = 0.0;
+    for(index_t i = 0; i < count; ++i)
+    {
+        v_max = std::max(v_max, vals[i]);
+        v_min = std::min(v_min, vals[i]);
+        v_sum += vals[i];
+        v_sum_sq += vals[i] * vals[i];
+    }
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s5/type"]  = "surrogate";
+    extracts["s5/params/expression"] = "max(field('braid'))";
+    extracts["s5/params/lags"] = 2;
+    conduit::Node &feature = extracts["s5/params/features"].append();
+    feature["field"] = "braid";
+    feature["stats"].append() = "max";
+    feature["stats"].append() = "min";
+    feature["stats"].append() = "mean";
+    feature["stats"].append() = "l2";
+    feature["stats"].append() = "p50";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    data["state/cycle"] = 0;
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    conduit::Node info;
+    ascent.info(info);
+    const conduit::Node &res = info["extracts"][0];
+    res["features"].print();
+    EXPECT_EQ(res["features/names"].number_of_children(), 5);
+    EXPECT_EQ(res["features/names"][2].as_string(), "braid/mean");
+    float64_array features = res["features/values"].value();
+    EXPECT_NEAR(features[0], v_max, 1e-12);
+    EXPECT_NEAR(features[1], v_min, 1e-12);
+    EXPECT_NEAR(features[2], v_sum / count, 1e-9);
+    EXPECT_NEAR(features[3], sqrt(v_sum_sq), 1e-9);
+    // the median is binned, so only check it is in range
+    EXPECT_GE(features[4], v_min);
+    EXPECT_LE(features[4], v_max);
+    // bias + lags + features
+    EXPECT_EQ(res["model/weights"].dtype().number_of_elements(), 8);
+    EXPECT_EQ(res["model/exogenous"].dtype().number_of_elements(), 5);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_solvers)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // a linear series is exactly predictable from two lags, the least
+    // squares solvers should find it without any tuning
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["rls/type"]  = "surrogate";
+    extracts["rls/params/expression"] = "max(field('braid'))";
+    extracts["rls/params/lags"] = 2;
+    extracts["rls/params/solver"] = "rls";
+    extracts["normal/type"]  = "surrogate";
+    extracts["normal/params/expression"] = "max(field('braid'))";
+    extracts["normal/params/lags"] = 2;
+    extracts["normal/params/solver/type"] = "normal";
+    extracts["normal/params/solver/window"] = 6;
+    extracts["adam/type"]  = "surrogate";
+    extracts["adam/params/expression"] = "max(field('braid'))";
+    extracts["adam/params/lags"] = 2;
+    extracts["adam/params/learning_rate"] = 0.01;
+    extracts["adam/params/solver/type"] = "adam";
+    extracts["adam/params/solver/window"] = 4;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    const int num_cycles = 10;
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        fill_braid(data, 1.0 + 0.5 * cycle);
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    conduit::Node info;
+    ascent.info(info);
+    info["extracts"].print();
+    const double expected = 1.0 + 0.5 * num_cycles;
+    for(int i = 0; i < info["extracts"].number_of_children(); ++i)
+    {
+        const conduit::Node &res = info["extracts"][i];
+        const std::string name = res["name"].as_string();
+        EXPECT_EQ(res["model/solver"].as_string(), name);
+        EXPECT_EQ(res["model/num_updates"].to_int32(), num_cycles - 2);
+        if(name == "adam")
+        {
+            EXPECT_TRUE(std::isfinite(res["prediction"].to_float64()));
+        }
+        else
+        {
+            EXPECT_NEAR(res["prediction"].to_float64(), expected, 1e-3);
+        }
+    }
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_bad_solver)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["s6/type"]  = "surrogate";
+    extracts["s6/params/expression"] = "max(field('braid'))";
+    extracts["s6/params/solver/type"] = "rls";
+    extracts["s6/params/solver/forgetting_factor"] = 2.0;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    EXPECT_THROW(ascent.execute(actions),conduit::Error);
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_field_surrogate)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // every element sees the same series, so all per element models
+    // follow the scalar normalized LMS recursion below
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    conduit::Node &pipelines = add_pipelines["pipelines"];
+    pipelines["pl1/f1/type"] = "field_surrogate";
+    pipelines["pl1/f1/params/field"] = "braid";
+    pipelines["pl1/f1/params/lags"] = 1;
+    pipelines["pl1/f1/params/rollout"] = "true";
+
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    conduit::Node &queries = add_queries["queries"];
+    queries["q1/params/expression"] = "max(field('braid_prediction'))";
+    queries["q1/params/name"] = "predicted";
+    queries["q1/pipeline"] = "pl1";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    const double step_size = 0.5;
+    // starts as persistence
+    double w0 = 0.0;
+    double w1 = 1.0;
+    double last = 0.0;
+    conduit::Node info;
+    for(int cycle = 0; cycle < 6; ++cycle)
+    {
+        const double value = 1.0 + 0.5 * cycle;
+        if(cycle > 0)
+        {
+            const double err = value - (w0 + w1 * last);
+            const double scale = step_size * err / (1.0 + last * last);
+            w0 += scale;
+            w1 += scale * last;
+        }
+        last = value;
+
+        fill_braid(data, value);
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.info(info);
+
+        std::ostringstream path;
+        path << "expressions/predicted/" << cycle << "/attrs/value/value";
+        EXPECT_NEAR(info[path.str()].to_float64(), w0 + w1 * last, 1e-9);
+    }
+
+    // no new data: the model rolls forward on its own prediction
+    const double rolled = w0 + w1 * (w0 + w1 * last);
+    ascent.execute(actions);
+    ascent.info(info);
+    EXPECT_NEAR(info["expressions/predicted/5/attrs/value/value"].to_float64(),
+                rolled,
+                1e-9);
+
+    // the prediction only exists on the pipeline output, the published
+    // data is untouched
+    conduit::Node source_actions;
+    conduit::Node &source_queries = source_actions.append();
+    source_queries["action"] = "add_queries";
+    source_queries["queries/q1/params/expression"] =
+      "max(field('braid_prediction'))";
+    source_queries["queries/q1/params/name"] = "source_predicted";
+    EXPECT_THROW(ascent.execute(source_actions), conduit::Error);
+
+    ascent.close();
+
+    std::string msg = "An example of predicting the next cycle of a field "
+                      "with a per element surrogate model.";
+    ASCENT_ACTIONS_DUMP(actions,std::string("field_surrogate"),msg);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_field_surrogate_budget)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    conduit::Node &pipelines = add_pipelines["pipelines"];
+    pipelines["pl1/f1/type"] = "field_surrogate";
+    pipelines["pl1/f1/params/field"] = "braid";
+    pipelines["pl1/f1/params/lags"] = 4;
+    // far less than one double per value
+    pipelines["pl1/f1/params/memory_budget"] = 64;
+
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    conduit::Node &queries = add_queries["queries"];
+    queries["q1/params/expression"] = "max(field('braid_prediction'))";
+    queries["q1/params/name"] = "predicted";
+    queries["q1/pipeline"] = "pl1";
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    EXPECT_THROW(ascent.execute(actions),conduit::Error);
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_surrogate, test_pod)
+{
+    Node n;
+    ascent::about(n);
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // snapshots [a(t) braid; b(t) radial] span exactly two modes
+    conduit::Node braid0, radial0;
+    braid0.set(data["fields/braid/values"]);
+    radial0.set(data["fields/radial/values"]);
+    float64_array braid_vals = data["fields/braid/values"].value();
+    float64_array radial_vals = data["fields/radial/values"].value();
+    float64_array braid_ref = braid0.value();
+    float64_array radial_ref = radial0.value();
+
+    conduit::Node actions;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    conduit::Node &extracts = add_extracts["extracts"];
+    extracts["rom/type"]  = "pod";
+    extracts["rom/params/fields"].append() = "braid";
+    extracts["rom/params/fields"].append() = "radial";
+    extracts["rom/params/rank"] = 4;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    const int num_cycles = 6;
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        const double a = 1.0 + cycle;
+        const double b = 2.0 - 0.1 * cycle;
+        for(index_t i = 0; i < braid_vals.number_of_elements(); ++i)
+        {
+            braid_vals[i] = a * braid_ref[i];
+        }
+        for(index_t i = 0; i < radial_vals.number_of_elements(); ++i)
+        {
+            radial_vals[i] = b * radial_ref[i];
+        }
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    conduit::Node info;
+    ascent.info(info);
+    const conduit::Node &res = info["extracts"][0];
+    res.print();
+    EXPECT_EQ(res["type"].as_string(), "pod");
+    EXPECT_EQ(res["rank"].to_int32(), 2);
+    EXPECT_EQ(res["num_snapshots"].to_int32(), num_cycles);
+    EXPECT_LT(res["residual"].to_float64(), 1e-6);
+    float64_array sv = res["singular_values"].value();
+    EXPECT_GE(sv[0], sv[1]);
+    EXPECT_EQ(res["coefficients"].dtype().number_of_elements(), 2);
+
+    // the modal coefficients are a time series in the expression cache
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        std::ostringstream path;
+        path << "expressions/rom_mode_0/" << cycle << "/value";
+        EXPECT_TRUE(info.has_path(path.str()));
+    }
+
+    ascent.close();
+
+    std::string msg = "An example of a streaming POD reduced order model "
+                      "of two fields.";
+    ASCENT_ACTIONS_DUMP(actions,std::string("pod"),msg);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // allow override of the data size via the command line
+    if(argc == 2)
+    {
+        EXAMPLE_MESH_SIDE_DIM = atoi(argv[1]);
+    }
+
+    result = RUN_ALL_TESTS();
+    return result;
+}
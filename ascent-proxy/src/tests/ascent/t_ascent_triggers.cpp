@@ -13,8 +13,10 @@
 
 #include <ascent.hpp>
 
+#include <chrono>
 #include <iostream>
 #include <math.h>
+#include <thread>
 
 #include <conduit_blueprint.hpp>
 
@@ -562,6 +564,188 @@ TEST(ascent_triggers, trigger_single_actions_file_relative_path)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_triggers, trigger_reuses_runtime_and_actions_file)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string output_file_a = conduit::utils::join_file_path(output_path,"tout_trigger_reuse_a");
+    string output_file_b = conduit::utils::join_file_path(output_path,"tout_trigger_reuse_b");
+    string trigger_file = conduit::utils::join_file_path(output_path,"tout_trigger_reuse_actions.yaml");
+    // remove old images before rendering
+    remove_test_image(output_file_a);
+    remove_test_image(output_file_b);
+
+    //
+    // Create the trigger actions.
+    //
+    conduit::Node trigger_actions;
+    conduit::Node &add_scenes= trigger_actions.append();
+    add_scenes["action"] = "add_scenes";
+    conduit::Node &trigger_scenes = add_scenes["scenes"];
+    trigger_scenes["s1/plots/p1/type"] = "pseudocolor";
+    trigger_scenes["s1/plots/p1/field"] = "braid";
+    trigger_scenes["s1/image_prefix"] = output_file_a;
+    trigger_actions.save(trigger_file);
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+    // this should always be true
+    conduit::Node triggers;
+    triggers["t1/params/condition"] = "cycle() > 0";
+    triggers["t1/params/actions_file"] = trigger_file;
+    conduit::Node &add_triggers= actions.append();
+    add_triggers["action"] = "add_triggers";
+    add_triggers["triggers"] = triggers;
+
+    //
+    // Run Ascent, the trigger fires every cycle
+    //
+    Ascent ascent;
+    ascent.open();
+    for(int cycle = 1; cycle <= 2; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    EXPECT_TRUE(check_test_image(output_file_a));
+
+    // an edited actions file is picked up on the next fire
+    // (mtimes have a resolution of a second)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    trigger_scenes["s1/image_prefix"] = output_file_b;
+    trigger_actions.save(trigger_file);
+
+    data["state/cycle"] = 3;
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+
+    EXPECT_TRUE(check_test_image(output_file_b));
+    std::string msg = "An example of a trigger that fires every cycle.";
+    ASCENT_ACTIONS_DUMP(actions,output_file_b,msg);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_triggers, surrogate_trigger)
+{
+    Node n;
+    ascent::about(n);
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    // a constant series is easy to learn
+    float64_array vals = data["fields/braid/values"].value();
+    for(index_t i = 0; i < vals.number_of_elements(); ++i)
+    {
+        vals[i] = 1.0;
+    }
+
+    //
+    // Create the actions.
+    //
+    Node actions;
+    conduit::Node &add_triggers= actions.append();
+    add_triggers["action"] = "add_triggers";
+    conduit::Node &triggers = add_triggers["triggers"];
+    triggers["t1/type"] = "surrogate";
+    triggers["t1/params/expression"] = "max(field('braid'))";
+    triggers["t1/params/tolerance"] = 0.01;
+    triggers["t1/params/max_skip"] = 2;
+    triggers["t1/params/lags"] = 2;
+    triggers["t1/params/learning_rate"] = 0.01;
+    conduit::Node &trigger_actions = triggers["t1/params/actions"];
+    conduit::Node &add_queries = trigger_actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "1";
+    add_queries["queries/q1/params/name"] = "expensive";
+    actions.print();
+
+    //
+    // Run Ascent
+    //
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+
+    const int num_cycles = 16;
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+
+    conduit::Node info;
+    ascent.info(info);
+    const conduit::Node &results = info["expressions/t1"];
+    results.print();
+    EXPECT_EQ(results.number_of_children(), num_cycles);
+
+    int num_predicted = 0;
+    int run = 0;
+    for(int cycle = 0; cycle < num_cycles; ++cycle)
+    {
+        const conduit::Node &res = results.child(cycle);
+        const bool predicted = res["predicted"].as_string() == "true";
+        const bool fired = res["fired"].as_string() == "true";
+        if(predicted)
+        {
+            num_predicted++;
+            run++;
+            EXPECT_FALSE(fired);
+            EXPECT_NEAR(res["value"].to_float64(), 1.0, 0.05);
+        }
+        else
+        {
+            run = 0;
+        }
+        // never more than max_skip predictions in a row
+        EXPECT_LE(run, 2);
+    }
+
+    // the model has to see the data before it can be trusted
+    EXPECT_EQ(results.child(0)["fired"].as_string(), "true");
+    EXPECT_GT(num_predicted, 0);
+
+    ascent.close();
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -18,6 +18,7 @@
 #include <runtimes/ascent_vtkh_data_adapter.hpp>
 #include <iostream>
 #include <math.h>
+#include <vector>
 
 #include <conduit_blueprint.hpp>
 
@@ -390,6 +391,147 @@ TEST(ascent_multi_topo, adapter_test)
     delete collection;
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_data_adapter, conversion_cache)
+{
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    Node data;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data["domain"]);
+    data["domain/state/domain_id"] = 0;
+
+    // connectivity that already matches vtkm::Id is zero copied, so the
+    // cells can be kept while the connectivity keeps its address
+    Node &n_conn = data["domain/topologies/mesh/elements/connectivity"];
+    Node conn;
+    if(sizeof(vtkm::Id) == 8)
+    {
+        n_conn.to_int64_array(conn);
+    }
+    else
+    {
+        n_conn.to_int32_array(conn);
+    }
+    n_conn.set(conn);
+
+    VTKmConversionCache cache;
+    VTKHCollection* collection =
+      VTKHDataAdapter::BlueprintToVTKHCollection(data, true, &cache);
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 1);
+    delete collection;
+
+    // same topology and coordinates, new field values
+    float64_array braid = data["domain/fields/braid/values"].value();
+    braid[0] = 42.0;
+    collection = VTKHDataAdapter::BlueprintToVTKHCollection(data, true, &cache);
+    EXPECT_EQ(cache.hits(), 1);
+    EXPECT_EQ(cache.misses(), 0);
+
+    Node out_data, verify_info;
+    VTKHDataAdapter::VTKHCollectionToBlueprintDataSet(collection, out_data);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(out_data, verify_info));
+    Node out_braid;
+    out_data.child(0)["fields/braid/values"].to_float64_array(out_braid);
+    EXPECT_EQ(out_braid.as_float64_ptr()[0], 42.0);
+    delete collection;
+
+    // a copy of the mesh lives at new addresses, so it is converted again
+    Node copy;
+    copy.set(data);
+    collection = VTKHDataAdapter::BlueprintToVTKHCollection(copy, true, &cache);
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 1);
+    delete collection;
+
+    // without zero copy the cells are a copy that could go stale if the
+    // connectivity changes in place, so they are converted every time
+    collection = VTKHDataAdapter::BlueprintToVTKHCollection(copy, false, &cache);
+    EXPECT_EQ(cache.misses(), 1);
+    delete collection;
+    collection = VTKHDataAdapter::BlueprintToVTKHCollection(copy, false, &cache);
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 1);
+    delete collection;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_data_adapter, strided_fields)
+{
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    Node data;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data["domain"]);
+    data["domain/state/domain_id"] = 0;
+
+    // pack vel and braid into one array of (u, v, w, braid) tuples and
+    // publish them as views into it, like a code with an array of structs
+    Node &n_fields = data["domain/fields"];
+    const index_t nverts = n_fields["braid/values"].dtype().number_of_elements();
+    std::vector<float64> packed(nverts * 4);
+    float64_array u = n_fields["vel/values/u"].value();
+    float64_array v = n_fields["vel/values/v"].value();
+    float64_array w = n_fields["vel/values/w"].value();
+    float64_array braid = n_fields["braid/values"].value();
+    for(index_t i = 0; i < nverts; ++i)
+    {
+      packed[i * 4 + 0] = u[i];
+      packed[i * 4 + 1] = v[i];
+      packed[i * 4 + 2] = w[i];
+      packed[i * 4 + 3] = braid[i];
+    }
+
+    const index_t stride = 4 * sizeof(float64);
+    n_fields["vel/values/u"].set_external(DataType::float64(nverts, 0, stride),
+                                          packed.data());
+    n_fields["vel/values/v"].set_external(DataType::float64(nverts, 8, stride),
+                                          packed.data());
+    n_fields["vel/values/w"].set_external(DataType::float64(nverts, 16, stride),
+                                          packed.data());
+    n_fields["braid/values"].set_external(DataType::float64(nverts, 24, stride),
+                                          packed.data());
+
+    VTKHCollection* collection =
+      VTKHDataAdapter::BlueprintToVTKHCollection(data, true);
+    Node out_data, verify_info;
+    VTKHDataAdapter::VTKHCollectionToBlueprintDataSet(collection, out_data);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(out_data, verify_info));
+    delete collection;
+
+    Node out_braid, out_v;
+    out_data.child(0)["fields/braid/values"].to_float64_array(out_braid);
+    out_data.child(0)["fields/vel/values/v"].to_float64_array(out_v);
+    ASSERT_EQ(out_braid.dtype().number_of_elements(), nverts);
+    ASSERT_EQ(out_v.dtype().number_of_elements(), nverts);
+    for(index_t i = 0; i < nverts; ++i)
+    {
+      EXPECT_EQ(out_braid.as_float64_ptr()[i], packed[i * 4 + 3]);
+      EXPECT_EQ(out_v.as_float64_ptr()[i], packed[i * 4 + 1]);
+    }
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -17,6 +17,12 @@
 
 #include <iostream>
 #include <math.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -160,6 +166,129 @@ public:
 
 
 
+//-----------------------------------------------------------------------------
+// passes its input through after a short sleep and records how many
+// filters were executing at the same time
+//-----------------------------------------------------------------------------
+static std::atomic<int> g_sleep_active(0);
+static std::atomic<int> g_sleep_max_active(0);
+static std::atomic<int> g_serial_active(0);
+static std::atomic<int> g_serial_max_active(0);
+static std::mutex       g_serial_order_mutex;
+static std::vector<std::string> g_serial_order;
+
+static void
+reset_sleep_counters()
+{
+    g_sleep_active = 0;
+    g_sleep_max_active = 0;
+    g_serial_active = 0;
+    g_serial_max_active = 0;
+    g_serial_order.clear();
+}
+
+static void
+track_max(std::atomic<int> &active, std::atomic<int> &max_active)
+{
+    int curr = ++active;
+    int prev = max_active;
+    while(curr > prev && !max_active.compare_exchange_weak(prev, curr))
+    {
+        // retry
+    }
+}
+
+//-----------------------------------------------------------------------------
+class SleepFilter: public Filter
+{
+public:
+    SleepFilter()
+    : Filter()
+    {}
+
+    virtual ~SleepFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "sleep";
+        i["output_port"] = "true";
+        i["thread_safe"] = "true";
+        i["port_names"].append().set("in");
+    }
+
+    virtual void execute()
+    {
+        track_max(g_sleep_active, g_sleep_max_active);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        g_sleep_active--;
+
+        Node *res = new Node();
+        res->set(input<Node>("in")->to_int());
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+class SerialSleepFilter: public Filter
+{
+public:
+    SerialSleepFilter()
+    : Filter()
+    {}
+
+    virtual ~SerialSleepFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "serial_sleep";
+        i["output_port"] = "true";
+        i["thread_safe"] = "false";
+        i["port_names"].append().set("in");
+    }
+
+    virtual void execute()
+    {
+        track_max(g_serial_active, g_serial_max_active);
+        {
+            std::lock_guard<std::mutex> lock(g_serial_order_mutex);
+            g_serial_order.push_back(name());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        g_serial_active--;
+
+        Node *res = new Node();
+        res->set(input<Node>("in")->to_int());
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+class ThrowFilter: public Filter
+{
+public:
+    ThrowFilter()
+    : Filter()
+    {}
+
+    virtual ~ThrowFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "throw";
+        i["output_port"] = "true";
+        i["thread_safe"] = "true";
+        i["port_names"].append().set("in");
+    }
+
+    virtual void execute()
+    {
+        CONDUIT_ERROR("throw filter always fails");
+    }
+};
+
 //-----------------------------------------------------------------------------
 TEST(ascent_flow_workspace, linear_graph)
 {
@@ -752,3 +881,208 @@ TEST(ascent_flow_workspace, dag_graph_missing_input_error)
 
     Workspace::clear_supported_filter_types();
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, threaded_dag)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+    Workspace::register_filter_type<AddFilter>();
+
+    // eight independent chains of incs, summed pairwise
+    int results[2];
+    for(int t = 0; t < 2; ++t)
+    {
+        Workspace w;
+        w.set_num_threads(t == 0 ? 1 : 4);
+
+        Node p_vs;
+        p_vs["value"].set(int(10));
+        w.graph().add_filter("src","v",p_vs);
+
+        std::vector<std::string> tips;
+        for(int c = 0; c < 8; ++c)
+        {
+            std::string prev = "v";
+            for(int k = 0; k <= c; ++k)
+            {
+                std::ostringstream oss;
+                oss << "inc_" << c << "_" << k;
+                w.graph().add_filter("inc",oss.str());
+                w.graph().connect(prev,oss.str(),"in");
+                prev = oss.str();
+            }
+            tips.push_back(prev);
+        }
+
+        int count = 0;
+        while(tips.size() > 1)
+        {
+            std::vector<std::string> next;
+            for(size_t i = 0; i < tips.size(); i += 2)
+            {
+                std::ostringstream oss;
+                oss << "add_" << count++;
+                w.graph().add_filter("add",oss.str());
+                w.graph().connect(tips[i],oss.str(),"a");
+                w.graph().connect(tips[i+1],oss.str(),"b");
+                next.push_back(oss.str());
+            }
+            tips = next;
+        }
+
+        w.execute();
+        results[t] = w.registry().fetch<Node>(tips[0])->to_int();
+        w.registry().consume(tips[0]);
+    }
+
+    // 8 * 10 + (1 + 2 + ... + 8)
+    EXPECT_EQ(results[0],116);
+    EXPECT_EQ(results[1],results[0]);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, threaded_overlap_and_serialize)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<SleepFilter>();
+    Workspace::register_filter_type<SerialSleepFilter>();
+
+    reset_sleep_counters();
+
+    Workspace w;
+    w.set_num_threads(4);
+    EXPECT_EQ(w.num_threads(),4);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+    Filter *f_src = w.graph().add_filter("src","v",p_vs);
+    // filters that don't declare thread_safe are serialized
+    EXPECT_FALSE(f_src->thread_safe());
+
+    // independent branches off the same source
+    for(int b = 0; b < 4; ++b)
+    {
+        std::ostringstream oss;
+        oss << b;
+        Filter *f_sleep = w.graph().add_filter("sleep","sleep_" + oss.str());
+        EXPECT_TRUE(f_sleep->thread_safe());
+        w.graph().connect("v","sleep_" + oss.str(),"in");
+        w.graph().add_filter("serial_sleep","serial_" + oss.str());
+        w.graph().connect("sleep_" + oss.str(),"serial_" + oss.str(),"in");
+    }
+
+    // the serial filters run in the order of the sequential plan
+    Node travs;
+    w.traversals(travs);
+    std::vector<std::string> expected;
+    NodeConstIterator travs_itr = travs.children();
+    while(travs_itr.has_next())
+    {
+        NodeConstIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            trav_itr.next();
+            if(trav_itr.name().find("serial_") == 0)
+            {
+                expected.push_back(trav_itr.name());
+            }
+        }
+    }
+
+    w.execute();
+
+    EXPECT_GT(g_sleep_max_active.load(),1);
+    EXPECT_EQ(g_serial_max_active.load(),1);
+    EXPECT_EQ(g_serial_order,expected);
+
+    for(int b = 0; b < 4; ++b)
+    {
+        std::ostringstream oss;
+        oss << "serial_" << b;
+        EXPECT_EQ(w.registry().fetch<Node>(oss.str())->to_int(),10);
+        w.registry().consume(oss.str());
+    }
+
+    EXPECT_THROW(w.set_num_threads(0),conduit::Error);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, threaded_error)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<SleepFilter>();
+    Workspace::register_filter_type<ThrowFilter>();
+
+    Workspace w;
+    w.set_num_threads(3);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+    w.graph().add_filter("src","v",p_vs);
+    w.graph().add_filter("sleep","s1");
+    w.graph().add_filter("throw","t1");
+    w.graph().add_filter("sleep","s2");
+    w.graph().connect("v","s1","in");
+    w.graph().connect("v","t1","in");
+    w.graph().connect("t1","s2","in");
+
+    // errors raised on a worker are rethrown by execute
+    EXPECT_THROW(w.execute(),conduit::Error);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, cached_plan_tracks_graph_changes)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+
+    Workspace w;
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+    w.graph().add_filter("src","v1",p_vs);
+    w.graph().add_filter("inc","a");
+    w.graph().connect("v1","a","in");
+
+    EXPECT_EQ(w.plan_compile_count(),0);
+
+    // repeated executes reuse the compiled plan
+    for(int i = 0; i < 3; ++i)
+    {
+        w.execute();
+        EXPECT_EQ(w.registry().fetch<Node>("a")->to_int(),11);
+        w.registry().consume("a");
+        EXPECT_EQ(w.plan_compile_count(),1);
+    }
+
+    // growing the graph invalidates it
+    w.graph().add_filter("inc","b");
+    w.graph().connect("a","b","in");
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),12);
+    w.registry().consume("b");
+    EXPECT_EQ(w.plan_compile_count(),2);
+
+    // and the new plan is reused in turn
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),12);
+    w.registry().consume("b");
+    EXPECT_EQ(w.plan_compile_count(),2);
+
+    // resetting the workspace invalidates it too
+    w.reset();
+    w.graph().add_filter("src","v1",p_vs);
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("v1")->to_int(),10);
+    w.registry().consume("v1");
+    EXPECT_EQ(w.plan_compile_count(),3);
+
+    Workspace::clear_supported_filter_types();
+}
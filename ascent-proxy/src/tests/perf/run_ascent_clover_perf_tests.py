@@ -8,7 +8,9 @@
 #
 # purpose:
 #  Helper that executes parameterized cloverleaf runs to gather performance
-#  data.
+#  data. Tests of type "replay" instead feed recorded blueprint snapshots
+#  of a proxy app through ascent_replay to benchmark the surrogate modes
+#  without running the simulation.
 #
 ###############################################################################
 
@@ -48,6 +50,9 @@ def mpiexec_cmd(ntasks):
 def clover_cmd():
     return opts["clover_cmd"]
 
+def replay_cmd():
+    return opts["replay_cmd"]
+
 def gen_clover_input_deck(side_ncells=100,
                           ascent_freq=10,
                           end_step=100):
@@ -109,9 +114,119 @@ def run_clover(tag, test_opts):
     # change back to starting dir
     os.chdir("..")
 
+# python extract scripts that implement each python surrogate mode,
+# found in the proxy app's build dir
+surrogate_scripts = {"pickle": "auto_io.py",
+                     "shared_memory": "auto_mem.py"}
+
+def surrogate_actions(app, mode):
+    """ Actions that train the surrogate with the given mode. """
+    if mode == "native":
+        extract = {"type": "surrogate",
+                   "params": {"expression": app["expression"],
+                              "lags": 4,
+                              "learning_rate": 1.0e-7,
+                              "epochs": 100}}
+    else:
+        extract = {"type": "python",
+                   "params": {"file": surrogate_scripts[mode]}}
+    return [{"action": "add_extracts", "extracts": {"e1": extract}}]
+
+def stats(vals):
+    """ Mean and max of a list, None when there is nothing to report. """
+    if not vals:
+        return None
+    return {"mean": sum(vals) / len(vals), "max": max(vals)}
+
+def summarize_replay(timings_file):
+    """ Digests the per cycle output of ascent_replay --timings. """
+    if not os.path.isfile(timings_file):
+        return {"status": "failed"}
+    cycles = json.load(open(timings_file)).get("cycles", [])
+    res = {"status": "ok",
+           "cycles": len(cycles),
+           "execute": stats([c["execute"] for c in cycles]),
+           "max_rss_kb": max([c["max_rss_kb"] for c in cycles] or [0])}
+    # per phase timings and errors are only reported by the native
+    # surrogate, the python modes are covered by the execute time
+    train = []
+    predict = []
+    abs_error = []
+    rel_error = []
+    for c in cycles:
+        for e in c.get("extracts", {}).values():
+            if "timings" in e:
+                train.append(e["timings"]["train"])
+                predict.append(e["timings"]["predict"])
+            if "abs_error" in e:
+                abs_error.append(e["abs_error"])
+            if "rel_error" in e:
+                rel_error.append(e["rel_error"])
+    res["train"] = stats(train)
+    res["predict"] = stats(predict)
+    res["abs_error"] = stats(abs_error)
+    res["rel_error"] = stats(rel_error)
+    return res
+
+def yaml_lines(data, indent=0):
+    """ Minimal yaml writer for nested dicts, json scalars are valid yaml. """
+    res = []
+    for k, v in data.items():
+        if isinstance(v, dict):
+            res.append("{}{}:".format(" " * indent, k))
+            res.extend(yaml_lines(v, indent + 2))
+        else:
+            res.append("{}{}: {}".format(" " * indent, k, json.dumps(v)))
+    return res
+
+def run_replay(tag, test_opts):
+    app_name = test_opts["app"]
+    app = opts["apps"][app_name]
+    snapshots = sorted(glob.glob(pjoin(app["snapshots"], "*.root")))
+    if not snapshots:
+        print("[no snapshots found in '{}', skipping {}]".format(app["snapshots"], tag))
+        return
+    # setup unique run-dir using tag
+    rdir = "_test_" + tag
+    if not os.path.isdir(rdir):
+        os.mkdir(rdir)
+    os.chdir(rdir)
+    open("cycles.txt","w").write("\n".join(snapshots) + "\n")
+    if "ntasks" in test_opts.keys():
+        ntasks = test_opts["ntasks"]
+    else:
+        ntasks = 1
+    modes = test_opts.get("modes", ["pickle", "shared_memory", "native"])
+    summary = {}
+    for mode in modes:
+        # the pickle mode keeps its model in the working dir
+        if os.path.isfile("state.pkl"):
+            os.remove("state.pkl")
+        if mode in surrogate_scripts:
+            shutil.copyfile(pjoin(app["scripts"], surrogate_scripts[mode]),
+                            surrogate_scripts[mode])
+        actions_file = "ascent_actions_" + mode + ".json"
+        json.dump(surrogate_actions(app, mode), open(actions_file, "w"), indent=2)
+        timings_file = "timings_" + mode + ".json"
+        if os.path.isfile(timings_file):
+            os.remove(timings_file)
+        sexe(mpiexec_cmd(ntasks) + " " + replay_cmd() +
+             " --cycles=cycles.txt" +
+             " --actions=" + actions_file +
+             " --timings=" + timings_file, echo=True)
+        summary[mode] = summarize_replay(timings_file)
+    res = "\n".join(yaml_lines({app_name: summary})) + "\n"
+    open("surrogate_perf_summary.yaml", "w").write(res)
+    print(res)
+    # change back to starting dir
+    os.chdir("..")
+
 def run_tests():
     for k,v in opts["tests"].items():
-        run_clover(k, v)
+        if v.get("type", "clover") == "replay":
+            run_replay(k, v)
+        else:
+            run_clover(k, v)
 
 def post_results():
     res_dirs = glob.glob("_test*")
@@ -156,7 +271,8 @@ def parse_args():
 def main():
     parse_args()
     run_tests()
-    post_results()
+    if opts.get("post_results", True):
+        post_results()
 
 if __name__ == "__main__":
     main()
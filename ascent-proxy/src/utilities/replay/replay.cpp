@@ -16,7 +16,13 @@
 
 #include <fstream>
 #include <vector>
+#include <map>
 #include <algorithm>
+#include <cmath>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
 
 #if defined(ASCENT_REPLAY_MPI)
 #include <mpi.h>
@@ -42,11 +48,15 @@ void usage()
   std::cout<<"  --cycles  : a text file containing a list of root files, one per line.\n";
   std::cout<<"              Each file will be loaded and sent to Ascent in order.\n";
   std::cout<<"  --actions : a yaml file containing ascent actions. Default value\n";
-  std::cout<<"              is 'ascent_actions.yaml'.\n\n";
+  std::cout<<"              is 'ascent_actions.yaml'.\n";
+  std::cout<<"  --timings : write per cycle timings, peak memory, and surrogate\n";
+  std::cout<<"              metrics to this file (yaml, or json if the name ends\n";
+  std::cout<<"              with .json).\n\n";
   std::cout<<"======================== Examples =========================\n";
   std::cout<<"./ascent_replay --root=clover.cycle_000060.root\n";
   std::cout<<"./ascent_replay --root=clover.cycle_000060.root --actions=my_actions.yaml\n";
   std::cout<<"srun -n 4 ascent_replay_mpi --cycles=cycles_file\n";
+  std::cout<<"./ascent_replay --cycles=cycles_file --timings=timings.yaml\n";
   std::cout<<"\n\n";
 }
 
@@ -55,6 +65,7 @@ struct Options
   std::string m_actions_file = "ascent_actions.yaml";
   std::string m_root_file;
   std::string m_cycles_file;
+  std::string m_timings_file;
 
   void parse(int argc, char** argv)
   {
@@ -72,6 +83,10 @@ struct Options
       {
         m_actions_file = get_arg(argv[i]);
       }
+      else if(contains(argv[i], "--timings="))
+      {
+        m_timings_file = get_arg(argv[i]);
+      }
       else
       {
         bad_arg(argv[i]);
@@ -242,6 +257,83 @@ void load_actions(const std::string &file_name, int mpi_comm_id, conduit::Node &
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// peak resident set size of this process in kilobytes
+long
+max_rss_kb()
+{
+#if !defined(_WIN32)
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#if defined(__APPLE__)
+    // bytes on macOS
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+  }
+#endif
+  return -1;
+}
+
+//---------------------------------------------------------------------------//
+// copies the metrics of model extracts out of ascent's info. the error
+// of a surrogate is measured against the prediction it made last cycle
+void
+extract_metrics(const conduit::Node &info,
+                std::map<std::string, double> &predictions,
+                conduit::Node &metrics)
+{
+  if(!info.has_child("extracts"))
+  {
+    return;
+  }
+  const conduit::Node &extracts = info["extracts"];
+  for(int i = 0; i < extracts.number_of_children(); ++i)
+  {
+    const conduit::Node &extract = extracts.child(i);
+    if(!extract.has_child("type") || !extract.has_child("name"))
+    {
+      continue;
+    }
+    const std::string type = extract["type"].as_string();
+    const std::string name = extract["name"].as_string();
+    conduit::Node &res = metrics[name];
+    res["type"] = type;
+    if(type == "surrogate")
+    {
+      if(extract.has_child("timings"))
+      {
+        res["timings"] = extract["timings"];
+      }
+      if(extract.has_child("value"))
+      {
+        const double value = extract["value"].to_float64();
+        res["value"] = value;
+        res["loss"] = extract["loss"];
+        if(predictions.find(name) != predictions.end())
+        {
+          const double error = std::abs(value - predictions[name]);
+          res["abs_error"] = error;
+          if(value != 0.0)
+          {
+            res["rel_error"] = error / std::abs(value);
+          }
+        }
+      }
+      const double prediction = extract["prediction"].to_float64();
+      res["prediction"] = prediction;
+      predictions[name] = prediction;
+    }
+    else if(type == "pod")
+    {
+      res["rank"] = extract["rank"];
+      res["residual"] = extract["residual"];
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 int
 main(int argc, char *argv[])
@@ -298,6 +390,9 @@ main(int argc, char *argv[])
   ascent::Ascent ascent;
   ascent.open(ascent_opts);
 
+  conduit::Node timings;
+  std::map<std::string, double> predictions;
+
   for(int i = 0; i < time_steps.size(); ++i)
   {
     if(rank == 0)
@@ -337,10 +432,53 @@ main(int argc, char *argv[])
       std::cout<< "[" << i << "]: Publish --: "<<publish_time<<"\n";
       std::cout<< "[" << i << "]: Execute --: "<<execute_time<<"\n";
     }
+
+    if(options.m_timings_file != "")
+    {
+      long rss = max_rss_kb();
+#if defined(ASCENT_REPLAY_MPI)
+      MPI_Allreduce(MPI_IN_PLACE, &rss, 1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD);
+#endif
+      if(rank == 0)
+      {
+        conduit::Node &entry = timings["cycles"].append();
+        entry["root_file"] = time_steps[i];
+        if(replay_data.number_of_children() > 0 &&
+           replay_data.child(0).has_path("state/cycle"))
+        {
+          entry["cycle"] = replay_data.child(0)["state/cycle"].to_int64();
+        }
+        entry["load"] = load_time;
+        entry["publish"] = publish_time;
+        entry["execute"] = execute_time;
+        entry["max_rss_kb"] = (conduit::int64) rss;
+
+        conduit::Node info;
+        ascent.info(info);
+        extract_metrics(info, predictions, entry["extracts"]);
+      }
+    }
   }
 
   ascent.close();
 
+  if(options.m_timings_file != "" && rank == 0)
+  {
+    timings["actions_file"] = options.m_actions_file;
+    timings["num_ranks"] = comm_size;
+    std::string curr,next;
+    std::string protocol = "yaml";
+    conduit::utils::rsplit_string(options.m_timings_file,
+                                  ".",
+                                  curr,
+                                  next);
+    if(curr == "json")
+    {
+      protocol = "json";
+    }
+    timings.save(options.m_timings_file, protocol);
+  }
+
 #if defined(ASCENT_REPLAY_MPI)
   MPI_Finalize();
 #endif
@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: session2yaml.cpp
+///
+//-----------------------------------------------------------------------------
+#include <conduit.hpp>
+#include <expressions/ascent_session_log.hpp>
+
+void usage()
+{
+  std::cout<<"usage   : session2yaml --session=session_name [--output=output.yaml]\n";
+  std::cout<<"Examples:\n";
+  std::cout<<"  ./session2yaml --session=ascent_session\n";
+  std::cout<<"  ./session2yaml --session=my_run/ascent_session --output=free_bananas.yaml\n";
+  std::cout<<"\n";
+  std::cout<<"Reads session_name.session_log and its index, and writes the\n";
+  std::cout<<"expression results (by default to session_name.yaml)\n";
+
+  std::cout<<"\n\n";
+}
+
+struct Options
+{
+  std::string m_output_name = "";
+  std::string m_session_name = "";
+
+  void parse(int argc, char** argv)
+  {
+    for(int i = 1; i < argc; ++i)
+    {
+      if(contains(argv[i], "--session="))
+      {
+        m_session_name = get_arg(argv[i]);
+      }
+      else if(contains(argv[i], "--output="))
+      {
+        m_output_name = get_arg(argv[i]);
+      }
+      else
+      {
+        bad_arg(argv[i]);
+      }
+    }
+    if(m_session_name == "")
+    {
+      std::cerr<<"You must specify '--session'. Bailing...\n";
+      usage();
+      exit(1);
+    }
+    if(m_output_name == "")
+    {
+      m_output_name = m_session_name + ".yaml";
+    }
+  }
+
+std::vector<std::string> &split(const std::string &s,
+                                char delim,
+                                std::vector<std::string> &elems)
+{
+  std::stringstream ss(s);
+  std::string item;
+
+  while (std::getline(ss, item, delim))
+  {
+   elems.push_back(item);
+  }
+  return elems;
+}
+
+std::vector<std::string> split(const std::string &s, char delim)
+{
+  std::vector<std::string> elems;
+  split(s, delim, elems);
+  return elems;
+}
+  std::string get_arg(const char *arg)
+  {
+    std::vector<std::string> parse;
+    std::string s_arg(arg);
+    std::string res;
+
+    parse = split(s_arg, '=');
+
+    if(parse.size() != 2)
+    {
+      bad_arg(arg);
+    }
+    else
+    {
+      res = parse[1];
+    }
+    return res;
+  }
+
+bool contains(const std::string haystack, std::string needle)
+{
+  std::size_t found = haystack.find(needle);
+  return (found != std::string::npos);
+}
+
+void bad_arg(std::string bad_arg)
+{
+  std::cerr<<"Invalid argument \""<<bad_arg<<"\"\n";
+  usage();
+  exit(0);
+}
+
+};
+
+int main (int argc, char *argv[])
+
+{
+  Options options;
+  options.parse(argc, argv);
+
+  using ascent::runtime::expressions::SessionLog;
+  if(!SessionLog::to_yaml(options.m_session_name, options.m_output_name))
+  {
+    std::cerr<<"No session log found at '"
+             <<SessionLog::log_file(options.m_session_name)<<"'\n";
+    return 1;
+  }
+
+  return 0;
+}